@@ -0,0 +1,95 @@
+#ifndef BLE_ADV_H
+#define BLE_ADV_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================
+// BLE ADVERTISING DATA PARSER  (single pass, zero copy)
+//
+// Walks the raw AD structures of an advertisement (plus scan response, which
+// NimBLE appends to the same payload) once and fills a fixed struct. Nothing
+// is copied or allocated: name, manufacturer data, service data and 128-bit
+// UUIDs are pointers into the caller's payload and are only valid while it
+// is. Kept free of Arduino / NimBLE types so the host benchmark in
+// tools/bench/ compiles the exact same code.
+//
+// 32- and 128-bit UUIDs built on the Bluetooth base UUID are short 16-bit
+// UUIDs written long; bleAdvShortUuid() folds them back so a classifier
+// keyed on 16-bit UUIDs sees them too.
+// ============================================================
+
+#define BLE_ADV_MAX_UUID16   12
+#define BLE_ADV_MAX_UUID32   4
+#define BLE_ADV_MAX_UUID128  4
+#define BLE_ADV_MAX_SVC_DATA 4
+
+// AD types (Bluetooth Core Supplement, Part A)
+#define BLE_AD_FLAGS            0x01
+#define BLE_AD_UUID16_MORE      0x02
+#define BLE_AD_UUID16_ALL       0x03
+#define BLE_AD_UUID32_MORE      0x04
+#define BLE_AD_UUID32_ALL       0x05
+#define BLE_AD_UUID128_MORE     0x06
+#define BLE_AD_UUID128_ALL      0x07
+#define BLE_AD_NAME_SHORT       0x08
+#define BLE_AD_NAME_COMPLETE    0x09
+#define BLE_AD_TX_POWER         0x0A
+#define BLE_AD_SVC_DATA16       0x16
+#define BLE_AD_SVC_DATA32       0x20
+#define BLE_AD_SVC_DATA128      0x21
+#define BLE_AD_MANUFACTURER     0xFF
+
+struct BleSvcData {
+    uint8_t        uuidBits;    // 16, 32 or 128
+    uint32_t       uuid;        // 16 / 32-bit UUID (0 for 128-bit)
+    const uint8_t* uuid128;     // 128-bit UUID, little-endian as sent
+    const uint8_t* data;        // payload after the UUID
+    uint8_t        len;
+};
+
+struct BleAdv {
+    uint8_t        flags = 0;
+    bool           hasFlags = false;
+    int8_t         txPower = 0;
+    bool           hasTxPower = false;
+
+    uint16_t       uuid16[BLE_ADV_MAX_UUID16];
+    uint8_t        n16 = 0;
+    uint32_t       uuid32[BLE_ADV_MAX_UUID32];
+    uint8_t        n32 = 0;
+    const uint8_t* uuid128[BLE_ADV_MAX_UUID128];    // 16 bytes each, little-endian
+    uint8_t        n128 = 0;
+
+    BleSvcData     svcData[BLE_ADV_MAX_SVC_DATA];
+    uint8_t        nSvcData = 0;
+
+    const uint8_t* mfr = nullptr;   // manufacturer data, including the company ID
+    uint8_t        mfrLen = 0;
+    const char*    name = nullptr;  // not NUL-terminated
+    uint8_t        nameLen = 0;
+    bool           nameComplete = false;
+
+    uint8_t        dropped = 0;     // UUIDs / service data past the fixed slots
+    bool           malformed = false;
+
+    bool     hasCompanyId() const { return mfr && mfrLen >= 2; }
+    uint16_t companyId() const { return (uint16_t)(mfr[0] | (mfr[1] << 8)); }
+};
+
+// Parse len bytes of AD structures into out (reset first). Stops at the first
+// structure that runs past the end and sets out.malformed; everything before
+// it is kept. Returns false only for a malformed payload.
+bool bleAdvParse(const uint8_t* data, size_t len, BleAdv& out);
+
+// 16-bit form of a 32-bit or 128-bit (little-endian) UUID if it sits on the
+// Bluetooth base UUID, else 0
+uint16_t bleAdvShortUuid32(uint32_t uuid);
+uint16_t bleAdvShortUuid128(const uint8_t* uuid);
+
+// Every service UUID the advert carries that has a 16-bit form — UUID list
+// entries of all three sizes, then service data UUIDs — deduplicated.
+// Returns the count written (at most max).
+size_t bleAdvShortUuids(const BleAdv& adv, uint16_t* out, size_t max);
+
+#endif
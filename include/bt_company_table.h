@@ -0,0 +1,33 @@
+#ifndef BT_COMPANY_TABLE_H
+#define BT_COMPANY_TABLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================
+// BT SIG COMPANY TABLE  (dense, flash-resident)
+//
+// Every assigned Bluetooth SIG company ID resolves with one array index:
+// BT_COMPANY_INDEX[id] is the offset of the name in BT_COMPANY_POOL, in
+// 2-byte units, 0 = unassigned. Both arrays are const, so on the ESP32 they
+// stay in flash and are read through the cache-mapped rodata segment — no
+// heap, no SD access, nothing to load at boot. ~8 KB index + ~78 KB pool.
+//
+// src/bt_company_table.cpp is generated by tools/build_bt_db.py from the SIG
+// list (the same source as btcompany.bin), with the old RAM fallback names
+// merged in for any ID the list lacks. /btcompany.bin on the SD card is now
+// only consulted for IDs assigned after the firmware was built.
+// ============================================================
+
+extern const uint16_t BT_COMPANY_ID_LIMIT;      // highest ID in the table + 1
+extern const uint16_t BT_COMPANY_INDEX[];
+extern const char     BT_COMPANY_POOL[];
+
+// Company name for a SIG ID, or nullptr if the ID is not in the table
+static inline const char* btCompanyName(uint16_t id) {
+    if (id >= BT_COMPANY_ID_LIMIT) return nullptr;
+    uint16_t off = BT_COMPANY_INDEX[id];
+    return off ? BT_COMPANY_POOL + ((size_t)off << 1) : nullptr;
+}
+
+#endif
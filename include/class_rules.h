@@ -0,0 +1,120 @@
+#ifndef CLASS_RULES_H
+#define CLASS_RULES_H
+
+#include <Arduino.h>
+#include <vector>
+#include "oui_database.h"
+#include "keyword_matcher.h"
+
+// ============================================================
+// CLASSIFICATION RULES  (compiled decision table)
+//
+// checkOUI() extracts a fixed feature vector from each frame once (OUI
+// match, address type, BT company ID, service UUIDs, keyword hits in the
+// company name and SSID / local name), then runs it through an ordered
+// table of rules. Each rule is up to four (feature, op, value) tests ANDed
+// together and one action. Actions write the running category, priority
+// and relevance back into the vector, so later rules can test what earlier
+// ones decided ("category == unknown").
+//
+// Cost per frame is fixed by the table: rules x conditions integer compares,
+// no strings. Service UUID tests compile to a bit test — every UUID a rule
+// mentions gets a slot, and the frame's UUIDs become one bitmask up front.
+// Built-in rules live in main.cpp; /classify.json on the SD card adds more.
+// ============================================================
+
+#define CLASS_RULE_MAX_CONDS 4
+#define CLASS_SVC_SLOTS      16      // distinct service UUIDs across all rules
+#define CLASS_MAX_RULES      128
+#define CLASS_KEEP           0xFF    // action field: leave unchanged
+#define CLASS_NO_COMPANY     0xFFFF  // CF_COMPANY_ID when the frame has none
+
+enum ClassFeature : uint8_t {
+    CF_CATEGORY = 0,    // running result; starts from the OUI record
+    CF_PRIORITY,        // running result
+    CF_RELEVANCE,       // running result
+    CF_PREFIX_BITS,     // OUI match length: 0 none, 24 / 28 / 36
+    CF_LOCAL_ADDR,      // 1 = locally administered (randomised) MAC
+    CF_PUBLIC_ADDR,     // 1 = BLE public address type
+    CF_BLE,             // 1 = BLE, 0 = WiFi
+    CF_COMPANY_ID,      // BT SIG company ID from manufacturer data
+    CF_SVC_MASK,        // bit i = the frame carries service UUID slot i
+    CF_COMPANY_KW,      // category of the company-name keyword hit, 0 = none
+    CF_NAME_KW,         // category of the SSID / BLE-name keyword hit, 0 = none
+    CF_COUNT
+};
+
+enum ClassOp : uint8_t {
+    CO_EQ = 0,
+    CO_NE,
+    CO_GE,
+    CO_LE,
+    CO_ANY,             // feature & value != 0 (service UUID slots)
+};
+
+// Where an action takes category / priority from
+enum ClassSource : uint8_t {
+    CS_RULE = 0,        // the rule's own fields
+    CS_COMPANY_KEYWORD, // the matched company-name keyword's payload
+    CS_NAME_KEYWORD,    // the matched SSID / BLE-name keyword's payload
+};
+
+#define CR_DROP              0x01    // discard the frame (stops evaluation)
+#define CR_STOP              0x02    // no further rules after this one fires
+#define CR_PRIORITY_MAX      0x04    // priority = max(current, new)
+#define CR_RELEVANCE_FROM_PRI 0x08   // relevance HIGH for priority >= 4 (PRIORITY_HIGH), else MEDIUM
+
+struct ClassCond {
+    uint8_t  feature;
+    uint8_t  op;
+    uint16_t value;
+};
+
+struct ClassRule {
+    ClassCond cond[CLASS_RULE_MAX_CONDS];
+    uint8_t  nCond;
+    uint8_t  source;            // ClassSource
+    uint8_t  flags;             // CR_*
+    uint8_t  category;          // CS_RULE: DeviceCategory or CLASS_KEEP
+    uint8_t  priority;          // CS_RULE: 1-5 or CLASS_KEEP
+    uint8_t  relevance;         // RelevanceLevel or CLASS_KEEP
+    char     id[20];            // for the serial log
+};
+
+struct ClassFeatures {
+    uint16_t v[CF_COUNT];
+    int16_t  companyKw = -1;    // KeywordMatcher index behind CF_COMPANY_KW
+    int16_t  nameKw = -1;       // KeywordMatcher index behind CF_NAME_KW
+};
+
+#define CLASS_MAX_FIRED 4
+struct ClassOutcome {
+    bool    drop = false;
+    uint8_t fired = 0;                  // rules that fired (first CLASS_MAX_FIRED logged)
+    uint8_t firedRule[CLASS_MAX_FIRED];
+};
+
+class ClassRuleSet {
+public:
+    void clear();
+    // Slot bit for a service UUID a condition tests; 0 if the slots are full
+    uint16_t svcBit(uint16_t uuid);
+    bool add(const ClassRule& r);
+
+    // The frame's service UUIDs as a CF_SVC_MASK value
+    uint16_t svcMask(const uint16_t* uuids, size_t n) const;
+
+    // One pass over the table. Updates f.v[CF_CATEGORY / PRIORITY / RELEVANCE].
+    ClassOutcome evaluate(ClassFeatures& f, const KeywordMatcher& companyKw,
+                          const KeywordMatcher& nameKw) const;
+
+    const ClassRule& rule(int i) const { return rules[i]; }
+    size_t size() const { return rules.size(); }
+
+private:
+    std::vector<ClassRule> rules;
+    uint16_t svcUuids[CLASS_SVC_SLOTS];
+    uint8_t  svcCount = 0;
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef FOLLOWER_TRACKER_H
+#define FOLLOWER_TRACKER_H
+
+#include <Arduino.h>
+
+// ============================================================
+// FOLLOWER / CO-PRESENCE TRACKER
+//
+// The "tail check": which devices keep turning up with us over hours?
+// Time is cut into FOLLOWER_BUCKET_SEC buckets and each MAC scores one point
+// per bucket it is seen in; a per-bucket bitmap of MAC hashes lets only the
+// first sighting in a bucket into the sketch. Counting every MAC exactly would
+// grow without bound, so the points live in a Space-Saving sketch of
+// FOLLOWER_SLOTS counters. A device is only sure to keep its slot while its
+// share of all (MAC, bucket) points stays above 1/FOLLOWER_SLOTS — i.e. while
+// fewer than about FOLLOWER_SLOTS distinct MACs turn up per bucket. Above
+// that, one-off passers-by (and rotating random BLE addresses) can push even
+// a constant companion out.
+//
+// Memory is fixed (~12 KB) whatever the session length.
+// ============================================================
+
+#define FOLLOWER_SLOTS          256     // distinct MACs per bucket the sketch is sized for
+#define FOLLOWER_SEEN_BITS      4096    // per-bucket de-duplication bitmap (512 B)
+#define FOLLOWER_LIST_MAX       32      // most followers reported by /api/followers
+#define FOLLOWER_BUCKET_SEC     300     // 5-minute presence buckets
+#define FOLLOWER_MIN_BUCKETS    3       // need 3 distinct buckets to be listed
+#define FOLLOWER_FULL_SPAN      12      // buckets (1 h) before the score reaches full weight
+#define FOLLOWER_VENDOR_LEN     20
+
+struct FollowerInfo {
+    char     mac[18];               // "AA:BB:CC:DD:EE:FF"
+    char     vendor[FOLLOWER_VENDOR_LEN];
+    uint8_t  score;                 // 0-100: share of buckets present, weighted by span
+    bool     isBLE;
+    int8_t   lastRssi;
+    uint16_t buckets;               // guaranteed (lower-bound) buckets present
+    uint32_t firstSeenSec;          // uptime seconds, start of first bucket
+    uint32_t lastSeenSec;           // uptime seconds of the most recent sighting
+};
+
+// Account one sighting. Repeats inside the same bucket are free. Safe to
+// call from any task.
+void followerRecord(const String& mac, const String& vendor, int8_t rssi, bool isBLE);
+
+// Copy out up to `max` followers (>= FOLLOWER_MIN_BUCKETS), best score first.
+// Returns the number written.
+int followerTop(FollowerInfo* out, int max);
+
+#endif
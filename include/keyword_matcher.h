@@ -0,0 +1,68 @@
+#ifndef KEYWORD_MATCHER_H
+#define KEYWORD_MATCHER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// ============================================================
+// KEYWORD MATCHER  (case-insensitive Aho–Corasick)
+//
+// A keyword set is compiled once (at load) into an automaton that finds
+// every keyword in a string in a single left-to-right pass, however many
+// keywords there are. Used for the BLE company, SSID and correlation-group
+// keyword tables, which can be extended from /keywords.json on the SD card.
+//
+// Matching keeps the old table semantics: when several keywords occur, the
+// one added first wins (table order = precedence), not the leftmost one.
+//
+// Memory: 26 bytes per keyword, 12 per distinct keyword prefix (node + edge)
+// and a 512-byte root row — about 5 KB for the built-in sets, 30 KB for 300.
+// Plain C++ so the host benchmark in tools/bench/ builds the same code.
+// ============================================================
+
+#define KEYWORD_MAX_LEN      23      // per keyword, bytes
+#define KEYWORD_MAX_PATTERNS 1024    // per set; keeps node IDs within uint16_t
+
+struct KeywordInfo {
+    char     keyword[24];
+    uint8_t  category;          // DeviceCategory
+    uint8_t  priority;
+};
+
+class KeywordMatcher {
+public:
+    void clear();
+    // Queue a keyword (ASCII, matched case-insensitively). False if empty or too long.
+    bool add(const char* keyword, uint8_t category, uint8_t priority);
+    // Compile queued keywords into the automaton. Call once after the last add().
+    void build();
+
+    // Index of the highest-precedence keyword found in `text`, or -1.
+    int match(const char* text) const;
+    int match(const char* text, size_t len) const;
+
+    const KeywordInfo& info(int i) const { return patterns[i]; }
+    size_t size() const { return patterns.size(); }
+    size_t nodeCount() const { return nodes.size(); }
+
+private:
+    struct Node {
+        uint16_t firstEdge;     // into `edges`, sorted by ch
+        uint16_t edgeCount;
+        uint16_t fail;          // longest proper suffix that is also a prefix
+        uint16_t out;           // best pattern ending here or at any suffix, +1 (0 = none)
+    };
+    struct Edge {
+        uint8_t  ch;
+        uint16_t next;
+    };
+    std::vector<KeywordInfo> patterns;
+    std::vector<Node> nodes;
+    std::vector<Edge> edges;
+    uint16_t rootNext[256];     // root transitions, direct-indexed: most bytes of a miss land here
+
+    uint16_t step(uint16_t state, uint8_t c) const;
+};
+
+#endif
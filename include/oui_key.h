@@ -0,0 +1,112 @@
+#ifndef OUI_KEY_H
+#define OUI_KEY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================
+// PACKED OUI KEYS
+//
+// An OUI "AA:BB:CC" packs into the low 24 bits of a uint32_t (0x00AABBCC),
+// so tables keyed by OUI can be flat sorted arrays of integers instead of
+// String-keyed trees. Kept free of Arduino types so the host benchmark in
+// tools/bench/ compiles the exact same code.
+// ============================================================
+
+#define OUI_KEY_INVALID 0xFFFFFFFFUL
+
+// Parse the first three hex octets of a MAC/OUI string ("AA:BB:CC...",
+// "aa-bb-cc", "AABBCC"). Returns OUI_KEY_INVALID if fewer than 6 digits.
+static inline uint32_t ouiKey(const char* s) {
+    uint32_t key = 0;
+    int digits = 0;
+    for (; *s && digits < 6; s++) {
+        char c = *s;
+        uint32_t v;
+        if (c >= '0' && c <= '9')      v = c - '0';
+        else if (c >= 'A' && c <= 'F') v = c - 'A' + 10;
+        else if (c >= 'a' && c <= 'f') v = c - 'a' + 10;
+        else if (c == ':' || c == '-') continue;
+        else break;
+        key = (key << 4) | v;
+        digits++;
+    }
+    return digits == 6 ? key : OUI_KEY_INVALID;
+}
+
+// Branchless binary search over a sorted key array: the loop body is one
+// compare feeding a conditional move, always log2(n) iterations, so there is
+// no mispredict on hit/miss patterns. Returns the index of `key` or -1.
+static inline int ouiKeyFind(const uint32_t* keys, size_t n, uint32_t key) {
+    if (!n) return -1;
+    const uint32_t* base = keys;
+    while (n > 1) {
+        size_t half = n / 2;
+        base = (base[half] <= key) ? base + half : base;
+        n -= half;
+    }
+    return *base == key ? (int)(base - keys) : -1;
+}
+
+// ── Longer prefixes (IEEE MA-M / MA-S) ───────────────────────────────────
+// MA-L assigns 24-bit OUIs; MA-M and MA-S carve 28- and 36-bit blocks out of
+// a parent OUI for smaller vendors (many camera and bodycam makers). A MAC is
+// packed whole into 48 bits; a prefix of `bits` is then mac >> (48 - bits),
+// so every tier is again a flat sorted integer array.
+
+#define MAC_KEY_INVALID 0xFFFFFFFFFFFFFFFFULL
+
+// Parse up to 12 hex digits ("AA:BB:CC:DD:E", "aabbccdde"). Returns the value
+// left-aligned in 48 bits and stores the number of bits given (4 per digit).
+static inline uint64_t macPrefix(const char* s, uint8_t* bits) {
+    uint64_t v = 0;
+    int digits = 0;
+    for (; *s && digits < 12; s++) {
+        char c = *s;
+        uint64_t d;
+        if (c >= '0' && c <= '9')      d = c - '0';
+        else if (c >= 'A' && c <= 'F') d = c - 'A' + 10;
+        else if (c >= 'a' && c <= 'f') d = c - 'a' + 10;
+        else if (c == ':' || c == '-') continue;
+        else break;
+        v = (v << 4) | d;
+        digits++;
+    }
+    *bits = (uint8_t)(digits * 4);
+    return digits ? v << (48 - digits * 4) : 0;
+}
+
+// Full MAC -> 48-bit key, MAC_KEY_INVALID if fewer than 12 digits
+static inline uint64_t macKey(const char* s) {
+    uint8_t bits;
+    uint64_t v = macPrefix(s, &bits);
+    return bits == 48 ? v : MAC_KEY_INVALID;
+}
+
+// True for the prefix lengths IEEE assigns (MA-L, MA-M, MA-S)
+static inline bool prefixBitsValid(uint8_t bits) { return bits == 24 || bits == 28 || bits == 36; }
+
+// "AA:BB:CC:DD:E" for a 36-bit prefix key, "AA:BB:CC:D" for 28, "AA:BB:CC" for 24
+static inline void formatPrefix(char* out, size_t n, uint64_t key, uint8_t bits) {
+    static const char hex[] = "0123456789ABCDEF";
+    size_t o = 0;
+    for (int d = 0; d < bits / 4 && o + 1 < n; d++) {
+        if (d && !(d & 1) && o + 2 < n) out[o++] = ':';
+        out[o++] = hex[(key >> (bits - 4 * (d + 1))) & 0xF];
+    }
+    if (n) out[o] = 0;
+}
+
+// ouiKeyFind() over 64-bit keys, for the 28- and 36-bit tiers
+static inline int prefixKeyFind(const uint64_t* keys, size_t n, uint64_t key) {
+    if (!n) return -1;
+    const uint64_t* base = keys;
+    while (n > 1) {
+        size_t half = n / 2;
+        base = (base[half] <= key) ? base + half : base;
+        n -= half;
+    }
+    return *base == key ? (int)(base - keys) : -1;
+}
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef PORTAL_LATENCY_H
+#define PORTAL_LATENCY_H
+
+#include <Arduino.h>
+
+// ============================================================
+// PORTAL LATENCY  (what a dashboard user actually waits)
+//
+// The dashboard times each refresh (detections + status fetch pair) in the
+// browser and reports it on its next /api/status poll as ?rtt=<ms>. Timing
+// on the device would miss the part that matters: while the radio is off
+// the AP's channel, requests never reach the server at all. Samples sit in
+// a small ring with their arrival time; summaries are taken over the
+// samples newer than a given moment.
+// ============================================================
+
+#define PORTAL_LAT_SAMPLES   64
+#define PORTAL_LAT_MAX_MS    30000   // a refresh that took longer than this is a dead client
+
+struct PortalLatency {
+    uint16_t count;
+    uint16_t p50Ms;
+    uint16_t p95Ms;
+    uint16_t maxMs;
+};
+
+// Safe to call from any task
+void portalLatencyAdd(uint32_t ms);
+
+// Summary of samples received at or after sinceMs (millis()); returns count
+uint16_t portalLatencySummary(uint32_t sinceMs, PortalLatency* out);
+
+#endif
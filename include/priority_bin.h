@@ -0,0 +1,80 @@
+#ifndef PRIORITY_BIN_H
+#define PRIORITY_BIN_H
+
+#include <Arduino.h>
+
+// ============================================================
+// COMPILED PRIORITY DATABASE  (/priority.bin)
+//
+// priority.json compiled on the host by tools/build_priority_bin.py so the
+// firmware can load it with one read and no parsing. All integers are
+// little-endian; the image is laid out as:
+//
+//   PriorityBinHeader
+//   uint16_t            groupNames[groupCount]   string offsets, group ID = index + 1
+//   PriorityBinEntry    entries[entryCount]      sorted by (bits, key)
+//   PriorityBinRule     rules[ruleCount]         group masks already compiled
+//   char                strings[stringsSize]     NUL-terminated, offset 0 = ""
+//
+// The image is treated as stale (and priority.json loaded instead) when the
+// .json on the card differs in size from the one compiled, or was written
+// after the .bin — so hand edits to the JSON are never silently ignored.
+//
+// The compiler applies the same limits as the JSON loader (63 groups,
+// 4 group_min pairs, rules without a group condition dropped), so both
+// paths produce identical tables.
+// ============================================================
+
+#define PRIORITY_BIN_PATH     "/priority.bin"
+#define PRIORITY_BIN_MAGIC    0x42495250UL   // "PRIB"
+#define PRIORITY_BIN_VERSION  2            // 2: MA-M / MA-S prefixes
+#define PRIORITY_BIN_MAX_SIZE (64 * 1024)    // sanity cap before allocating the read buffer
+
+struct PriorityBinHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize;        // sizeof(PriorityBinHeader)
+    uint16_t entryCount;
+    uint16_t ruleCount;
+    uint8_t  groupCount;        // excluding the implicit "no group" ID 0
+    uint8_t  entrySize;         // sizeof(PriorityBinEntry)
+    uint8_t  ruleSize;          // sizeof(PriorityBinRule)
+    uint8_t  reserved;
+    uint32_t stringsSize;
+    uint32_t totalSize;         // whole file, catches truncated copies
+    uint32_t sourceSize;        // size of the priority.json it was built from
+};
+static_assert(sizeof(PriorityBinHeader) == 28, "PriorityBinHeader is an on-card format");
+
+struct PriorityBinEntry {
+    uint32_t key;               // prefix key (mac >> (48 - bits)), low 32 bits: OUI as 0x00AABBCC
+    uint16_t labelOff;
+    uint16_t contextOff;
+    uint8_t  groupId;
+    uint8_t  priority;
+    uint16_t confidence;        // x 10000
+    uint8_t  bits;              // 24 (MA-L), 28 (MA-M) or 36 (MA-S)
+    uint8_t  keyHigh;           // prefix key bits 32-35, MA-S only
+    uint16_t reserved;
+};
+static_assert(sizeof(PriorityBinEntry) == 16, "PriorityBinEntry is an on-card format");
+
+struct PriorityBinRule {
+    uint64_t anyMask;
+    uint64_t allMask;
+    uint64_t excludeMask;
+    uint16_t idOff;
+    uint16_t nameOff;
+    uint16_t descOff;
+    uint16_t levelOff;
+    uint16_t minDevices;
+    uint16_t windowSec;
+    float    minScore;
+    uint8_t  minGroup[4];
+    uint8_t  minCount[4];
+    uint8_t  minPairs;
+    uint8_t  reserved[7];
+};
+static_assert(sizeof(PriorityBinRule) == 56, "PriorityBinRule is an on-card format");
+
+#endif
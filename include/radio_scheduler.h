@@ -0,0 +1,64 @@
+#ifndef RADIO_SCHEDULER_H
+#define RADIO_SCHEDULER_H
+
+#include <Arduino.h>
+
+// ============================================================
+// RADIO SCHEDULER  (BLE + WiFi on the shared 2.4 GHz radio)
+//
+// The ESP32 has one RF front end; the coexistence arbiter time-slices it
+// between the BLE controller and the WiFi MAC. BLE scans continuously and
+// WiFi promiscuous capture stays on between channel sweeps, so both
+// protocols listen for most of every cycle instead of taking turns. The
+// share policy sets which side the arbiter favours when both want the air.
+//
+// Every listener reports when it is on and what it hears; the scheduler
+// turns that into per-radio duty cycle (share of wall time actually
+// listening) and event rates per stats window (one scan cycle).
+// ============================================================
+
+enum RadioShare : uint8_t {
+    RADIO_SHARE_BALANCED = 0,   // arbiter alternates fairly
+    RADIO_SHARE_WIFI,           // WiFi wins contention (BLE gets the gaps)
+    RADIO_SHARE_BLE,            // BLE wins contention
+    RADIO_SHARE_COUNT
+};
+
+enum RadioUse : uint8_t {
+    RADIO_BLE = 0,              // continuous BLE scan (on-air = window / interval)
+    RADIO_WIFI_SNIFF,           // promiscuous capture, hopping or parked
+    RADIO_WIFI_SCAN,            // active WiFi.scanNetworks() sweep
+    RADIO_USE_COUNT
+};
+
+struct RadioDuty {
+    float    dutyPct;           // share of the last window spent listening
+    float    dutyAvgPct;        // smoothed over recent windows
+    float    eventsPerSec;      // adverts / frames / networks, last window
+    uint32_t activeMs;          // listening time since boot
+    uint32_t events;            // since boot
+    uint32_t dropped;           // events lost (sighting queue full) since boot
+};
+
+void        radioSetShare(RadioShare share);     // applies the coexistence preference
+RadioShare  radioShare();
+const char* radioShareName(RadioShare share);
+bool        radioShareParse(const char* name, RadioShare* out);
+const char* radioUseName(RadioUse r);
+
+// Listener on / off. airShare is the fraction of "on" time really spent
+// receiving (BLE scan window / interval); 1 for WiFi.
+void radioOn(RadioUse r, float airShare = 1.0f);
+void radioOff(RadioUse r);
+bool radioIsOn(RadioUse r);
+
+// Account events. Safe from any task, including radio callbacks.
+void     radioCount(RadioUse r, uint32_t n = 1);
+void     radioDrop(RadioUse r);
+uint32_t radioEvents(RadioUse r);
+
+// Close the current stats window (end of a scan cycle)
+void radioWindowClose();
+void radioDuty(RadioUse r, RadioDuty* out);
+
+#endif
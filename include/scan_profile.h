@@ -0,0 +1,65 @@
+#ifndef SCAN_PROFILE_H
+#define SCAN_PROFILE_H
+
+#include <Arduino.h>
+
+// ============================================================
+// SCAN PROFILES
+//
+// A ScanMode selects a whole parameter set: how often the scan cycle runs,
+// the BLE scan duty, the WiFi hop dwell and whether capture stays on
+// between sweeps, how often the SD log is written and how often the display
+// redraws on its own. Which radios run is left to the CONFIG toggles. Average current is estimated from
+// the radio duty each profile implies; the device counts detections for the
+// time each profile is active, so yield and cost can be compared
+// (GET /api/profiles, tools/profile_bench.py).
+// ============================================================
+
+enum ScanMode : uint8_t {
+    SCAN_QUICK = 0,             // fastest refresh, BLE listening 100 %
+    SCAN_NORMAL = 1,            // the long-standing defaults
+    SCAN_POWER_SAVE = 2,        // long cycles, short sweeps, radios mostly idle
+    SCAN_MODE_COUNT
+};
+
+struct ScanProfile {
+    uint16_t cycleMs;           // scan cycle interval
+    uint16_t bleIntervalMs;
+    uint16_t bleWindowMs;
+    uint16_t hopDwellMs;        // base dwell: 1/6/11 get 2x, one pass = 16 x dwell
+    bool     wifiPark;          // keep capturing on the AP channel between sweeps
+    uint16_t logFlushMs;        // SD log + session index write cadence
+    uint16_t displayRefreshMs;  // periodic redraw
+};
+
+// Current model (mA): ESP32 datasheet figures plus the CYD backlight.
+// BLE and WiFi share one receiver, so it draws PROFILE_MA_RX whenever
+// either is listening.
+#define PROFILE_MA_BASE        45   // CPU at 240 MHz, both cores mostly idle
+#define PROFILE_MA_BACKLIGHT   40   // at full brightness
+#define PROFILE_MA_RX          95   // RF receive
+#define PROFILE_MA_SD          30   // SD card during a write burst
+#define PROFILE_SD_BURST_MS    20   // one log flush
+#define PROFILE_MA_REDRAW      30   // CPU + SPI during a full-screen redraw
+#define PROFILE_REDRAW_MS      50
+
+const ScanProfile& scanProfile(ScanMode mode);
+const char* scanModeName(ScanMode mode);
+bool        scanModeParse(const char* name, ScanMode* out);
+
+// Estimated average draw. With the web portal up the soft-AP keeps the
+// WiFi receiver on whatever the profile does.
+float scanProfileEstimateMa(ScanMode mode, bool portal, uint8_t brightness);
+
+// Yield accounting: time each profile has been active and what it found
+struct ScanProfileStats {
+    uint32_t activeMs;
+    uint32_t newDevices;        // first sightings
+    uint32_t sightings;         // every classified sighting
+};
+
+void scanProfileActivate(ScanMode mode);
+void scanProfileNoteDetection(bool newDevice);
+void scanProfileStats(ScanMode mode, ScanProfileStats* out);
+
+#endif
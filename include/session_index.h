@@ -0,0 +1,64 @@
+#ifndef SESSION_INDEX_H
+#define SESSION_INDEX_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+// ============================================================
+// SESSION CATALOGUE  (/sessions/index.bin)
+//
+// One fixed-size summary record per boot session, so sessions can be listed
+// and compared without opening any CSV. The running session's record is
+// kept up to date in RAM and rewritten in place; it is marked closed when
+// the device sleeps.
+//
+// File layout: 8-byte header { 'SIDX', uint16 version, uint16 record size }
+// followed by SessionSummary records in session order (little-endian).
+// ============================================================
+
+#define SESSION_INDEX_PATH     "/sessions/index.bin"
+#define SESSION_INDEX_MAGIC    0x58444953UL   // "SIDX"
+#define SESSION_INDEX_VERSION  1
+#define SESSION_TOP_VENDORS    3
+#define SESSION_VENDOR_LEN     20
+
+#define SESSION_FLAG_CLOSED    0x01
+#define SESSION_FLAG_SATURATED 0x02            // MAC bitmap full: uniqueMacs is a lower bound
+
+struct SessionVendor {
+    char     name[SESSION_VENDOR_LEN];
+    uint32_t count;
+};
+
+struct SessionSummary {
+    char     sessionId[10];       // "XXXX-XXXX"
+    uint8_t  maxTier;             // highest priority tier logged
+    uint8_t  flags;               // SESSION_FLAG_*
+    uint32_t startEpoch;          // UTC seconds, 0 if the clock was never synced
+    uint32_t endEpoch;            // UTC seconds at last update, 0 if unsynced
+    uint32_t durationSec;         // uptime-based, valid with or without NTP
+    uint32_t rows;                // CSV rows written
+    uint32_t uniqueMacs;          // linear-counting estimate (see SESSION_FLAG_SATURATED)
+    SessionVendor topVendors[SESSION_TOP_VENDORS];
+};
+static_assert(sizeof(SessionSummary) == 104, "SessionSummary is an on-card format");
+
+// Open (or create) the index and reserve a record slot for this session
+bool sessionIndexBegin(fs::FS& fs, const char* sessionId);
+
+// Account one CSV row once it is on the card. Safe to call from any task; no SD access.
+void sessionIndexRecord(const String& mac, const String& vendor, int priority);
+
+// Rewrite this session's record in place if anything changed since the last
+// flush. `close` marks the session finished (call before sleep/shutdown).
+void sessionIndexFlush(fs::FS& fs, bool close = false);
+
+// Snapshot of the running session's summary
+SessionSummary sessionIndexCurrent();
+
+// Visit every stored summary in order — O(sessions), reads only index.bin.
+// Return false from the callback to stop early.
+typedef bool (*session_index_visitor_t)(const SessionSummary& s, void* ctx);
+int sessionIndexForEach(fs::FS& fs, session_index_visitor_t visit, void* ctx);
+
+#endif
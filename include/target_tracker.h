@@ -0,0 +1,49 @@
+#ifndef TARGET_TRACKER_H
+#define TARGET_TRACKER_H
+
+#include <Arduino.h>
+
+// ============================================================
+// TARGET TRACKER  (hot/cold walk-in on one device)
+//
+// While a target is locked the normal scan cycle is suspended and the
+// radio listens for that one address only: parked on its WiFi channel, or
+// a 100 % window BLE scan behind the controller white list. The radio
+// callbacks feed every RSSI sample straight into an alpha-beta filter
+// (level + trend in dB/s), so the hot/cold screen and the SSE stream can
+// read a smoothed value at 15 Hz instead of one raw sample per cycle.
+// ============================================================
+
+#define TRACK_ALPHA        0.25f   // level gain per sample
+#define TRACK_BETA         0.03f   // trend gain per sample
+#define TRACK_TREND_MAX    20.0f   // dB/s clamp — faster is multipath, not walking
+#define TRACK_FORWARD_MS   1000    // one sample a second also goes on to checkOUI
+#define TRACK_STALE_MS     3000    // no sample for this long: signal lost
+
+struct TrackReading {
+    bool     active;
+    uint8_t  mac[6];            // transmit order (MSB first)
+    bool     isBLE;
+    uint8_t  channel;           // WiFi channel the radio is parked on
+    float    rssi;              // filtered dBm
+    float    trendDbps;         // filtered slope, positive = getting closer
+    int8_t   rawRssi;           // last sample
+    uint32_t samples;
+    float    rateHz;            // smoothed sample rate
+    uint32_t ageMs;             // since the last sample (since lock if none)
+    uint32_t elapsedMs;         // since lock
+};
+
+void trackerStart(const uint8_t* mac, bool isBLE, uint8_t channel);
+void trackerStop();
+bool trackerActive();
+
+// Radio callback side. trackerSample() returns true when this sample is
+// due to be forwarded to the sighting queue as well.
+bool trackerMatch(const uint8_t* mac);
+bool trackerSample(int8_t rssi);
+
+void trackerRead(TrackReading* out);
+bool trackerParseMac(const char* str, uint8_t* mac);     // "AA:BB:CC:DD:EE:FF"
+
+#endif
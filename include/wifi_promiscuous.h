@@ -34,15 +34,101 @@ typedef struct {
     uint8_t payload[0]; // Network data
 } wifi_ieee80211_packet_t;
 
-// Callback function type — now includes SSID extracted from the frame (empty string if none)
-typedef void (*wifi_promiscuous_callback_t)(const uint8_t* addr, int8_t rssi, uint8_t channel, const char* ssid);
+// Callback function type — includes SSID extracted from the frame (empty string if none).
+// fromAP: beacon / probe response, channel is then the AP's advertised channel.
+// rxChannel is always the channel the frame was received on.
+typedef void (*wifi_promiscuous_callback_t)(const uint8_t* addr, int8_t rssi, uint8_t channel,
+                                            uint8_t rxChannel, const char* ssid, bool fromAP);
+
+// ──────────────────────────────────────────────────────────────
+// Channel hopper
+//
+// An esp_timer walks a hop plan — a table of (channel, dwell) steps — in
+// the background, so no task sits in delay() while a channel is captured.
+// Each timer callback switches channel and schedules the next step against
+// an absolute timeline (no cumulative drift). Actual dwell per channel and
+// timer jitter (fire time vs due time) are measured as it goes.
+// ──────────────────────────────────────────────────────────────
+#define WIFI_CHANNELS  13
+#define HOP_PLAN_MAX   64                  // after home returns are inserted
+
+struct HopStep {
+    uint8_t  channel;           // 1-13
+    uint16_t dwellMs;
+};
+
+struct HopChannelStats {
+    uint32_t visits;
+    uint32_t dwellMs;           // actual, summed over visits
+    uint16_t lastDwellMs;       // actual, most recent visit
+    uint16_t planDwellMs;       // per sweep, from the current plan
+    uint32_t frames;            // management frames heard on the channel, hopping or parked
+    uint32_t newMacs;           // of those, first sighting of the MAC this pass
+    uint32_t hits;              // priority >= HIGH detections credited back
+    float    yield;             // smoothed (newMacs + HOP_HIT_WEIGHT x hits) per second of dwell
+};
+
+struct HopperStats {
+    uint32_t hops;
+    uint32_t sweeps;            // completed passes over the plan
+    uint32_t lastSweepMs;       // wall time of the last complete pass
+    uint32_t jitterAvgUs;       // |fire - due|, mean over all hops
+    uint32_t jitterMaxUs;
+    uint8_t  channel;           // current channel
+    bool     active;
+    uint8_t  homeChannel;       // 0 = no home returns
+    uint16_t maxAwayMs;         // bound the plan was built with
+    uint32_t homeReturns;       // hold steps taken since boot
+    uint32_t lastAwayMaxMs;     // longest measured absence from home, last pass
+    HopChannelStats ch[WIFI_CHANNELS + 1];   // [1..13]
+};
 
 // Function prototypes
 void initWiFiPromiscuous();
 void startWiFiPromiscuous(wifi_promiscuous_callback_t callback);
 void stopWiFiPromiscuous();
 void setPromiscuousChannel(uint8_t channel);
-void scanAllChannels(wifi_promiscuous_callback_t callback, int dwell_time_ms);
 void resetDetectionCache();
 
+// Target lock: only frames sent by this MAC reach the callback — every one
+// of them (no per-pass dedupe), data frames included. nullptr clears it.
+void setPromiscuousTarget(const uint8_t* mac);
+
+// Plan edits take effect at the start of the next pass
+void    hopperSetPlan(const HopStep* plan, uint8_t n);
+void    hopperDefaultPlan(uint16_t dwellMs);     // 1/6/11 x2, the rest x1
+uint8_t hopperGetPlan(HopStep* out, uint8_t max);
+
+// Home returns: while the soft-AP has clients, the pass is cut so the radio
+// is never away from the AP's channel for more than maxAwayMs; each return
+// holds there for holdMs so queued client traffic gets through. Steps
+// longer than the bound are split. maxAwayMs 0 turns returns off. Like a
+// plan edit, it takes effect at the start of the next pass.
+void hopperSetHome(uint8_t channel, uint16_t maxAwayMs, uint16_t holdMs);
+
+// One pass over the plan, then park on parkChannel. Returns immediately.
+bool hopperSweep(uint8_t parkChannel);
+// Stop hopping (mid-pass if need be) and park
+void hopperStop(uint8_t parkChannel);
+bool hopperActive();
+void hopperStats(HopperStats* out);
+
+// ──────────────────────────────────────────────────────────────
+// Adaptive dwell
+//
+// Each channel's yield — new MACs plus weighted priority hits per second
+// actually spent there — is smoothed over passes. hopperAdaptPlan() splits
+// a fixed per-pass budget: every channel keeps an exploration floor
+// (explorePct of the budget, shared evenly) so quiet channels are still
+// sampled and can earn time back, the rest goes out in proportion to yield.
+// With no yield data yet it falls back to the default 1/6/11 x2 split.
+// ──────────────────────────────────────────────────────────────
+#define HOP_HIT_WEIGHT       10      // one high-tier device = 10 new MACs
+#define HOP_YIELD_SMOOTHING  0.3f    // EWMA weight of the newest pass
+#define HOP_MIN_DWELL_MS     50      // below this a channel switch costs more than it hears
+#define HOP_MAX_DWELL_MS     1000
+
+void hopperCreditHit(uint8_t channel);           // a priority >= HIGH WiFi detection heard during a hop step
+void hopperAdaptPlan(uint32_t budgetMs, uint8_t explorePct);
+
 #endif
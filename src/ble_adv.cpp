@@ -0,0 +1,113 @@
+#include "ble_adv.h"
+#include <string.h>
+
+// Bluetooth base UUID 0000xxxx-0000-1000-8000-00805F9B34FB, bytes 0-11 in
+// little-endian order; bytes 12-15 hold the 32-bit short form
+static const uint8_t BASE_UUID_LE[12] = {
+    0xFB, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00,
+};
+
+static inline uint16_t le16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static inline uint32_t le32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+bool bleAdvParse(const uint8_t* data, size_t len, BleAdv& out) {
+    out = BleAdv();
+    size_t pos = 0;
+    while (pos < len) {
+        uint8_t fieldLen = data[pos];
+        if (fieldLen == 0) break;                       // early terminator / zero padding
+        if (pos + 1 + fieldLen > len) { out.malformed = true; break; }
+        uint8_t type = data[pos + 1];
+        const uint8_t* v = data + pos + 2;
+        uint8_t n = fieldLen - 1;                       // value bytes after the type
+        pos += 1 + fieldLen;
+
+        switch (type) {
+            case BLE_AD_FLAGS:
+                if (n >= 1) { out.flags = v[0]; out.hasFlags = true; }
+                break;
+            case BLE_AD_UUID16_MORE:
+            case BLE_AD_UUID16_ALL:
+                for (uint8_t i = 0; i + 2 <= n; i += 2) {
+                    if (out.n16 < BLE_ADV_MAX_UUID16) out.uuid16[out.n16++] = le16(v + i);
+                    else out.dropped++;
+                }
+                break;
+            case BLE_AD_UUID32_MORE:
+            case BLE_AD_UUID32_ALL:
+                for (uint8_t i = 0; i + 4 <= n; i += 4) {
+                    if (out.n32 < BLE_ADV_MAX_UUID32) out.uuid32[out.n32++] = le32(v + i);
+                    else out.dropped++;
+                }
+                break;
+            case BLE_AD_UUID128_MORE:
+            case BLE_AD_UUID128_ALL:
+                for (uint8_t i = 0; i + 16 <= n; i += 16) {
+                    if (out.n128 < BLE_ADV_MAX_UUID128) out.uuid128[out.n128++] = v + i;
+                    else out.dropped++;
+                }
+                break;
+            case BLE_AD_NAME_SHORT:
+            case BLE_AD_NAME_COMPLETE:
+                // A complete name (usually in the scan response) beats a short one
+                if (!out.name || (type == BLE_AD_NAME_COMPLETE && !out.nameComplete)) {
+                    out.name = (const char*)v;
+                    out.nameLen = n;
+                    out.nameComplete = (type == BLE_AD_NAME_COMPLETE);
+                }
+                break;
+            case BLE_AD_TX_POWER:
+                if (n >= 1) { out.txPower = (int8_t)v[0]; out.hasTxPower = true; }
+                break;
+            case BLE_AD_SVC_DATA16:
+            case BLE_AD_SVC_DATA32:
+            case BLE_AD_SVC_DATA128: {
+                uint8_t bytes = type == BLE_AD_SVC_DATA16 ? 2 : type == BLE_AD_SVC_DATA32 ? 4 : 16;
+                if (n < bytes) break;
+                if (out.nSvcData >= BLE_ADV_MAX_SVC_DATA) { out.dropped++; break; }
+                BleSvcData& sd = out.svcData[out.nSvcData++];
+                sd.uuidBits = bytes * 8;
+                sd.uuid = bytes == 2 ? le16(v) : bytes == 4 ? le32(v) : 0;
+                sd.uuid128 = bytes == 16 ? v : nullptr;
+                sd.data = v + bytes;
+                sd.len = n - bytes;
+                break;
+            }
+            case BLE_AD_MANUFACTURER:
+                if (!out.mfr) { out.mfr = v; out.mfrLen = n; }
+                break;
+            default:
+                break;
+        }
+    }
+    return !out.malformed;
+}
+
+uint16_t bleAdvShortUuid32(uint32_t uuid) {
+    return uuid <= 0xFFFF ? (uint16_t)uuid : 0;
+}
+
+uint16_t bleAdvShortUuid128(const uint8_t* uuid) {
+    if (memcmp(uuid, BASE_UUID_LE, sizeof(BASE_UUID_LE)) != 0) return 0;
+    return bleAdvShortUuid32(le32(uuid + 12));
+}
+
+static inline void addUnique(uint16_t u, uint16_t* out, size_t& n, size_t max) {
+    if (!u || n >= max) return;
+    for (size_t i = 0; i < n; i++) if (out[i] == u) return;
+    out[n++] = u;
+}
+
+size_t bleAdvShortUuids(const BleAdv& adv, uint16_t* out, size_t max) {
+    size_t n = 0;
+    for (uint8_t i = 0; i < adv.n16; i++)  addUnique(adv.uuid16[i], out, n, max);
+    for (uint8_t i = 0; i < adv.n32; i++)  addUnique(bleAdvShortUuid32(adv.uuid32[i]), out, n, max);
+    for (uint8_t i = 0; i < adv.n128; i++) addUnique(bleAdvShortUuid128(adv.uuid128[i]), out, n, max);
+    for (uint8_t i = 0; i < adv.nSvcData; i++) {
+        const BleSvcData& sd = adv.svcData[i];
+        addUnique(sd.uuidBits == 128 ? bleAdvShortUuid128(sd.uuid128) : bleAdvShortUuid32(sd.uuid), out, n, max);
+    }
+    return n;
+}
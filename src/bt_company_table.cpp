@@ -0,0 +1,4333 @@
+// Generated by tools/build_bt_db.py - do not edit.
+// Bluetooth SIG company identifiers; see include/bt_company_table.h.
+
+#include "bt_company_table.h"
+
+const uint16_t BT_COMPANY_ID_LIMIT = 4235;
+
+const uint16_t BT_COMPANY_INDEX[4235] = {
+        1,     7,    17,    23,    28,    35,    38,    43,    47,    52,    65,    80,
+       87,    95,   107,   120,   131,   141,   148,   154,   163,   178,   182,   192,
+      197,   206,   221,   229,   242,   253,   258,   263,   269,   277,   284,   292,
+      307,   311,   316,   324,   332,   341,   347,   360,   364,   379,   388,   396,
+      408,   418,   426,   440,   446,   461,   474,   489,   500,   511,   526,   541,
+      551,   561,   569,   581,   591,   603,   618,   633,   644,   651,   666,   674,
+      679,   694,   703,   716,   727,   733,   748,   758,   763,   774,   787,   795,
+      802,   812,   821,   836,   851,   857,   870,   884,   899,   913,   928,   939,
+      947,   957,   968,   976,   984,   998,     0,  1003,  1009,  1017,  1028,  1038,
+     1047,     0,  1062,  1077,  1082,  1089,  1097,  1112,  1121,  1126,  1141,  1154,
+     1166,  1172,  1178,  1191,     0,  1202,  1216,  1231,  1239,  1254,  1261,  1266,
+     1279,  1289,  1298,  1304,  1318,  1322,  1330,  1334,  1349,  1355,  1363,  1370,
+     1385,  1398,  1413,  1422,  1436,  1448,  1458,  1469,  1479,  1486,  1501,  1505,
+     1520,  1527,  1534,  1543,  1548,  1563,  1574,  1587,  1595,  1600,  1609,  1618,
+     1628,  1638,  1649,  1656,  1671,  1682,  1695,  1702,  1706,  1719,  1732,  1737,
+     1752,  1765,  1773,  1783,  1789,  1804,  1816,  1831,  1845,  1853,  1862,  1870,
+     1884,  1899,  1914,  1920,  1925,  1933,  1947,  1952,  1958,  1963,  1967,  1970,
+     1976,  1985,  1998,  2007,  2012,  2019,  2032,  2047,     0,  2062,  2077,  2088,
+     2102,  2117,  2128,  2133,  2141,  2150,  2160,  2165,  2176,  2180,  2186,  2193,
+     2203,  2213,     0,  2228,  2236,  2245,  2253,  2262,  2274,  2286,  2295,  2310,
+     2319,  2326,  2339,  2349,  2359,  2366,  2373,  2382,  2394,     0,  2404,  2413,
+     2420,  2430,  2440,  2453,  2463,  2475,  2481,  2491,  2501,  2516,  2531,  2546,
+     2552,  2567,  2571,  2578,  2583,  2595,  2604,  2608,  2623,  2635,  2643,  2649,
+        0,  2664,  2670,  2679,  2691,     0,  2702,  2712,  2726,  2729,  2734,  2742,
+     2749,  2755,  2769,  2776,  2782,  2788,  2792,  2800,  2813,  2823,  2832,  2847,
+     2851,  2863,  2872,  2878,  2887,  2898,  2909,  2914,  2925,  2938,  2945,  2952,
+     2963,  2968,  2981,  2992,  2997,  3012,  3019,     0,  3024,  3039,  3047,  3057,
+     3064,  3071,  3080,  3084,  3093,  3103,  3110,  3119,  3125,  3132,  3147,  3155,
+     3163,  3173,  3177,  3192,  3197,  3206,  3210,  3217,  3232,  3239,  3247,  3252,
+     3265,  3273,  3281,  3294,  3301,  3304,  3307,  3316,  3325,  3340,  3353,  3361,
+     3376,  3383,  3389,  3401,  3405,  3410,  3417,  3423,  3431,  3443,  3455,  3470,
+     3477,  3484,  3493,  3499,  3505,  3518,  3532,  3541,  3547,  3559,  3564,  3570,
+     3579,  3592,  3607,  3615,  3621,     0,  3625,  3634,  3644,  3649,  3662,  3677,
+     3688,  3692,  3704,     0,  3710,  3725,  3733,  3741,  3753,  3767,  3770,  3779,
+     3786,  3801,  3811,  3817,  3825,  3835,  3841,  3845,  3853,  3868,  3871,  3880,
+     3883,  3893,  3905,  3914,  3925,  3929,  3935,  3949,  3960,  3971,     0,  3985,
+     3999,  4012,  4022,  4027,  4033,  4042,  4050,  4060,  4073,  4078,  4084,  4094,
+     4109,  4116,  4125,  4135,     0,  4150,  4158,     0,  4167,  4178,  4184,  4191,
+     4199,  4208,  4212,  4222,  4229,  4236,  4251,  4264,  4266,  4278,  4287,  4296,
+     4304,  4311,  4316,     0,  4325,  4334,  4344,  4357,  4367,  4374,  4387,  4402,
+     4411,  4416,     0,  4421,  4429,  4439,  4449,     0,     0,     0,  4464,     0,
+     4479,  4494,  4502,  4509,  4524,  4530,  4545,  4551,  4563,  4574,  4586,  4592,
+     4601,  4616,  4624,  4630,  4639,  4649,  4664,  4677,  4692,  4707,  4712,  4718,
+        0,     0,  4723,  4733,  4739,  4746,  4756,  4763,  4776,     0,  4790,  4803,
+     4810,  4814,  4829,  4839,  4844,  4859,  4870,  4874,     0,  4882,  4889,  4900,
+     4910,  4917,  4921,  4928,  4941,  4950,  4962,  4970,  4984,  4990,  5002,  5009,
+     5020,  5030,  5039,  5052,  5058,  5069,  5073,     0,  5079,  5094,  5098,  5109,
+     5124,  5139,  5144,  5151,  5158,  5164,  5170,  5179,     0,  5194,  5201,  5210,
+     5224,  5235,     0,  5241,  5247,  5253,  5261,  5272,  5280,     0,  5291,  5296,
+     5301,  5311,  5322,  5337,  5352,  5363,  5373,  5383,  5389,  5394,  5409,  5418,
+     5433,  5439,  5443,  5458,  5473,  5488,  5502,  5511,     0,  5522,  5528,  5542,
+     5549,  5554,  5562,  5575,  5583,  5587,  5597,  5601,  5616,  5630,  5637,  5645,
+     5654,  5664,  5670,  5681,  5686,  5694,  5698,  5713,  5719,  5730,  5745,  5752,
+     5756,  5763,  5778,  5786,  5796,  5805,  5809,  5814,  5825,  5835,  5845,  5852,
+        0,  5862,  5868,  5873,  5881,     0,  5888,  5896,  5909,  5915,     0,  5923,
+     5928,  5934,  5941,  5944,  5952,  5957,  5971,  5978,  5989,  6002,  6012,  6022,
+     6034,     0,  6046,  6052,  6055,  6066,  6077,  6086,  6101,  6108,  6113,  6119,
+     6126,  6141,  6150,  6159,  6170,  6183,  6188,  6196,  6203,  6210,  6225,  6235,
+     6246,  6256,  6266,  6280,  6289,  6295,  6301,  6316,  6330,  6337,  6346,  6357,
+     6372,  6383,  6397,  6405,  6420,  6424,  6431,  6441,     0,  6451,  6461,  6476,
+     6479,  6481,  6488,  6494,  6505,  6511,  6520,  6528,  6542,  6546,  6559,  6564,
+     6578,  6592,  6607,  6618,  6631,  6643,  6652,  6658,  6672,  6680,  6695,  6699,
+     6710,  6724,  6739,  6747,  6756,  6766,  6774,  6788,  6799,  6808,  6818,  6824,
+     6831,  6837,  6846,     0,  6856,  6863,     0,  6878,  6892,     0,  6907,  6922,
+     6933,  6941,  6953,  6962,  6971,  6979,  6984,  6995,  7008,  7015,  7021,  7025,
+     7040,  7045,     0,  7053,  7060,  7069,  7074,  7088,  7095,  7105,  7118,  7132,
+     7146,  7157,  7167,  7182,  7186,  7197,  7204,  7210,  7219,     0,     0,  7233,
+     7244,  7250,  7259,  7274,  7283,  7290,  7296,  7307,  7311,  7321,  7331,  7336,
+     7341,  7353,     0,  7366,  7372,  7379,  7386,  7390,  7400,  5989,  7405,  7414,
+     7426,  7431,  7443,  7449,  7463,  7471,  7484,  7494,  7509,  7514,  7523,  7537,
+        0,  7547,     0,  7551,  7558,  7569,     0,  7582,  7595,  7607,  7613,  7628,
+     7641,  7652,  7662,  7673,  7682,  7690,  7701,  7712,  7718,  7727,  7729,  7738,
+     7742,  7752,  7759,  7768,  7774,  7786,  7796,     0,  7811,  7818,  7824,  7833,
+     7845,  7849,  7857,  7870,  7876,     0,  7885,  7894,  7901,  7910,  7915,  7930,
+     7935,  7944,  7959,  7963,  7972,  7984,  7991,  7999,  8014,  8024,  8033,  8045,
+        0,  8055,  8070,  8077,  8086,  8097,  8108,  8118,  8121,  8127,  8133,  8141,
+     8147,  8155,  8163,  8165,     0,  8173,  8178,  8184,  8192,  8201,  8210,  8213,
+     8228,  8237,  8252,  8262,  8271,  8282,  8290,  8300,  8315,  8323,  8338,  8344,
+     8349,     0,  8356,  8364,     0,  8378,  8380,  8387,  8402,  8410,  8425,  8439,
+     8454,  8463,  8470,  8474,  8480,  8488,  8500,  8515,  8519,  8526,  8530,  8541,
+     8552,  8561,  8574,  8581,  8593,  8604,  8616,  8621,  8636,  8646,  8654,  8669,
+     8675,  8687,  8699,  8707,  8713,  8719,  8726,  8741,  8752,  8760,  8771,  8780,
+     8785,  8793,  8802,  8809,  8817,  8822,  8835,  8845,  8857,  8871,  8885,  8891,
+     8900,  8906,  8910,  8920,  8932,  8947,  8962,  8968,  8975,  8983,  8994,  9003,
+     9012,  9015,  9028,     0,  9037,  9048,  9054,  9065,  9072,  9080,  9094,  9107,
+     9113,  9121,  9128,  9134,  9139,  9153,  9161,  9175,  9187,  9194,     0,  9208,
+     9216,  9224,  9229,  9240,  9248,  9257,  9272,  9282,  9294,  9308,  9314,  9317,
+        0,     0,  9327,  9332,     0,  9340,  9347,  9357,  9369,  9377,  9392,  9405,
+     9414,  9422,  9432,  9437,  9446,  9455,  9470,  9477,  9492,  9500,  9506,  9512,
+     9524,  9530,  9536,  9544,  9550,  9557,  9564,  9572,  9578,  9587,  9598,  9613,
+     9621,  9627,  9638,  9646,     0,  9655,  9665,  9675,  9685,     0,  9693,  9701,
+     9714,  9723,  9733,  9740,  9755,  9765,  9773,  9780,  9785,  9795,  9805,  9811,
+     9826,  9838,  9848,  9859,  9869,  9884,  9889,  9900,  9907,     0,  9919,     0,
+     9929,  9939,  9954,  9960,  9974,  9979,  9989,  9999, 10009, 10022,     0, 10037,
+    10043, 10049, 10054, 10061, 10068, 10083, 10098, 10104, 10115, 10123, 10128, 10137,
+    10145, 10156,     0, 10161, 10173, 10188, 10198, 10213, 10228, 10235, 10240, 10248,
+        0, 10256, 10265,     0, 10280, 10292, 10298, 10313, 10325, 10340, 10351,     0,
+    10356, 10363, 10372, 10384, 10393, 10399, 10414, 10425, 10433,     0, 10448, 10459,
+    10468, 10479, 10491, 10496, 10502, 10506, 10517, 10523,     0,     0, 10530, 10540,
+    10549, 10564, 10579, 10588, 10601,     0, 10608, 10614, 10624, 10631, 10636, 10650,
+        0, 10665, 10680, 10692, 10706, 10715, 10722, 10735, 10746, 10752, 10767, 10781,
+    10788, 10801, 10808, 10814, 10824, 10837, 10846, 10856, 10871, 10880, 10894, 10900,
+    10910, 10925, 10935, 10945,     0, 10954, 10965, 10973, 10988, 10998, 11003, 11015,
+    11022, 11035, 11042, 11048, 11055, 11066, 11076, 11087, 11099, 11114, 11122, 11137,
+    11148, 11156,     0, 11164, 11171, 11177, 11182,     0, 11197, 11208, 11221, 11236,
+    11249,     0, 11259, 11263, 11271, 11278, 11283, 11298, 11307, 11315, 11325, 11333,
+    11348, 11362, 11368, 11375, 11390, 11400, 11406, 11416, 11427, 11433, 11439, 11448,
+    11455, 11461, 11468, 11471, 11476, 11488, 11498, 11505, 11512, 11518, 11526, 11541,
+    11555, 11566, 11578, 11583, 11593, 11599, 11610, 11615, 11625, 11631, 11638,     0,
+    11646, 11649, 11659, 11669, 11676, 11686, 11694, 11701, 11708, 11723, 11738, 11753,
+    11760, 11771, 11776, 11786, 11792, 11798, 11804, 11811, 11819, 11826, 11835, 11846,
+    11858, 11869, 11884, 11896, 11908, 11913, 11925, 11933, 11937, 11952, 11956, 11963,
+    11970, 11978, 11985, 11995, 12004,     0, 12013, 12026, 12041, 12056, 12071, 12078,
+    12093, 12108, 12112, 12125,     0, 12129, 12133, 12140, 12150, 12161, 12173, 12181,
+    12194, 12202, 12209, 12218, 12230, 12233, 12242, 12254, 12269, 12279, 12286, 12295,
+    12306,     0, 12313, 12328, 12343,     0, 12350, 12359, 12367, 12379, 12394, 12400,
+    12407, 12422, 12429, 12435, 12450, 12464, 12474, 12483, 12494,     0, 12509, 12516,
+    12531, 12542, 12553, 12558,     0, 12573, 12584, 12597, 12610, 12625, 12637, 12641,
+    12648, 12656, 12665, 12676, 12689, 12703, 12718, 12733, 12748, 12753, 12763, 12768,
+    12782, 12790, 12798, 12806, 12814, 12821, 12829, 12840, 12853, 12864, 12875, 12882,
+    12896, 12911, 12926, 12937, 12952, 12964, 12969, 12981, 12986, 12999, 13003, 13011,
+    13017, 13031, 13034, 13044, 13051, 13057, 13072, 13084, 13095, 13109, 13115, 13127,
+    13142, 13152, 13167, 13172, 13182, 13194,     0, 13203, 13218, 13228, 13236, 13245,
+    13252, 13266,     0, 13276, 13288, 13293, 13304, 13312, 13320, 13329, 13336, 13341,
+    13347, 13360, 13365, 13378, 13387, 13397, 13403, 13418, 13424, 13432, 13447, 13462,
+    13477, 13485, 13492, 13500, 13515, 13524, 13534, 13543, 13556, 13567, 13578, 13590,
+    13596, 13600, 13608, 13620, 13634, 13643,     0, 13653, 13658, 13661, 13672, 13682,
+    13686, 13693, 13697, 13703, 13710, 13715, 13730, 13745, 13751, 13758, 13763, 13767,
+    13775, 13785, 13796, 13809,     0, 13820, 13835, 13841, 13853, 13860, 13871, 13876,
+    13888, 13897, 13905, 13911, 13924, 13935, 13941, 13948, 13958, 13972, 13985, 14000,
+    14015, 14029, 14040, 14053, 14065, 14075, 14085, 14097, 14103, 14109, 14117,     0,
+    14125, 14132, 14142, 14147, 14152, 14157,     0, 14165, 14175, 14181, 14196, 14200,
+    14209, 14217, 14227, 14240, 14247, 14254, 14259, 14274, 14287, 14300, 14315, 14324,
+    14333, 14348, 14362, 14372, 14380, 14389, 14404, 14418, 14428, 14438, 14440, 14455,
+    14459, 14469, 14482, 14497, 14505, 14514, 14518, 14533, 14545, 14552, 14561, 14576,
+    14582, 14594, 14601, 14616, 14626, 14634, 14646, 14655, 14665, 14675, 14682, 14686,
+    14695, 14706, 14717, 14730, 14745, 14756, 14770, 14785, 14799, 14809, 14819, 14830,
+    14838, 14843, 14854, 14866, 14876, 14887, 14897, 14900, 14911,     0, 14915, 14930,
+    14942, 14952, 14964, 14979, 14986, 14992,     0, 15002, 15017, 15028, 15037, 15045,
+    15051, 15059, 15070, 15078, 15084, 15099, 15104, 15114,     0,     0, 15129, 15135,
+    15144, 15155, 15163, 15172, 15180, 15191, 15203, 15215, 15225, 15236, 15243, 15249,
+    15259,     0, 15264, 15276, 15290, 15305, 15315, 15323, 15329, 15337, 15346, 15356,
+    15371, 15386, 15401, 15407, 15421, 15436, 15448, 15454, 15464, 15473, 15482,     0,
+    15497, 15504, 15512, 15526, 15533, 15541, 15547, 15555, 15570, 15574, 15578,     0,
+    15584, 15590, 15602, 15611, 15625, 15633, 15643, 15653, 15659, 15674, 15680, 15695,
+    15702, 15717, 15725,     0, 15732, 15743, 15758,     0, 15765, 15780, 15787, 15799,
+    15814, 15820, 15835, 15847, 15858, 15873, 15883, 15890, 15900, 15906, 15921, 15933,
+    15940, 15943, 15951, 15962, 15967, 15980, 15994, 16004, 16013, 16016,     0, 16023,
+    16032, 16044, 16054, 16062, 16075, 16087, 16099, 16107, 16121, 16135, 16143, 16148,
+    16155, 16170, 16185, 16190, 16200, 16207, 16213, 16228, 16243, 16252, 16259, 16274,
+    16289, 16301, 16309, 16324, 16336, 16351, 16361, 16367, 16379, 16385, 16389, 16403,
+    16411, 16422, 16430,     0, 16435, 16446, 16454, 16468, 16472, 16480, 16488, 16503,
+    16518, 16525, 16536, 16551, 16561, 16576, 16585,     0, 16593, 16604, 16616, 16629,
+    16635, 16644, 16649, 16662, 16677, 16690, 16696, 16704, 16714, 16726, 16739, 16747,
+    16753, 16765, 16778, 16789,     0, 16800, 16815, 16823,     0, 16838, 16842, 16846,
+    16850, 16854, 16861, 16873, 16885, 16900, 16915, 16926,     0, 16941, 16951, 16961,
+    16970, 16985, 17000, 17006, 17017, 17025, 17037, 17048, 17056, 17063, 17078, 17086,
+    17098, 17107, 17118, 17125, 17138, 17143, 17151, 17157, 17164, 17179, 17189, 17200,
+    17215, 17228, 17241, 17256, 17271, 17282, 17290, 17302, 17317, 17327, 17339, 17347,
+    17359, 17369, 17377, 17392, 17394, 17401, 17408,     0, 17423, 17432, 17441, 17448,
+    17463, 17475, 17490, 17498, 17513, 17524, 17532,     0, 17545, 17553, 17565, 17578,
+    17587, 17598, 17604, 17615, 17627, 17633, 17646, 17653, 17662, 17673, 17683, 17690,
+    17698, 17705, 17713, 17728, 17743, 17751, 17760, 17768, 17778, 17793, 17806,     0,
+    17812, 17827, 17837, 17847, 17853, 17859, 17874, 17882, 17897, 17904, 17919, 17934,
+    17949, 17958, 17969, 17977, 17989, 18003, 18012, 18023, 18038, 18041, 18052, 18061,
+    18067, 18075, 18088, 18100, 18106,     0, 18111, 18116, 18126, 18138, 18146, 18154,
+    18164, 18174, 18183, 18193, 18208, 18219, 18234, 18249, 18258, 18273, 18288, 18302,
+    18310, 18322, 18332, 18338, 18353, 18364, 18374, 18384, 18391, 18402, 18410, 18423,
+    18434, 18449, 18455,  1436, 18469, 18476, 18482, 18491, 18500, 18509, 18520, 18528,
+    18536, 18542, 18550, 18556, 18571, 18581, 18594, 18603, 18618, 18633, 18648, 18663,
+    18673, 18680, 18695, 18705, 18713, 18719, 18726, 18730, 18739, 18742, 18754, 18762,
+    18770, 18781, 18789, 18797, 18812, 18827, 18834, 18839, 18851, 18856, 18861, 18867,
+    18879, 18888, 18899, 18913, 18928, 18933, 18937, 18946, 18960, 18965, 18975, 18983,
+    18986, 19001, 19016, 19028, 19035, 19050, 19062, 19072, 19078, 19086, 19093, 19104,
+    19109, 19124, 19139, 19150, 19165, 19179, 19191, 19197,     0, 19203, 19209, 19218,
+    19226, 19238, 19251, 19257, 19272, 19284, 19291, 19306, 19317, 19324, 19332, 19339,
+    19346, 19358, 19373, 19388, 19403, 19414, 19424, 19430, 19439, 19452, 19465, 19468,
+    19476, 19481, 19486, 19496, 19507, 19522, 19529, 19537, 19548, 19557, 19238, 19567,
+    19573, 19578, 19582, 19587, 19602, 19609, 19624,     0, 19633, 19644, 19655, 19661,
+    19676, 19682, 19697, 19704, 19719, 19731, 19746, 19755, 19765, 19778, 19787, 19802,
+    19809, 19817, 19830, 19845, 19857, 19866, 19879, 19886, 19890, 19904, 19914, 19919,
+    19923, 19930, 19936, 19945, 19960, 19967, 19972, 19979, 19988,     0, 20003, 20016,
+    20031, 20044, 20048, 20055, 20070, 20080,     0, 20091, 20105, 20117, 20131, 20146,
+    20154, 20158, 20165, 20175, 20190, 20197, 20206, 20221, 20231, 20246, 20259, 20266,
+    20278, 20290, 20301, 20313, 20319,     0, 20334, 20346, 20355, 20365, 20373, 20386,
+    20398, 20407, 20417, 20425, 20435, 20450, 20458, 20472, 20487, 20496, 20502, 20517,
+    20521, 20536, 20542, 20550, 20560, 20568, 20578, 20591, 20599, 20613, 20622, 20629,
+        0, 20637, 20645, 20655, 20667, 20681, 20687, 20700, 20712, 20725, 20728, 20737,
+    20752, 20762, 20770, 20779, 20787, 20801,     0, 20804, 20812, 20815, 20825, 20840,
+    20850, 20865, 20869, 20883, 20894, 20903, 20918, 20933, 20945, 20952, 20962, 20977,
+    20991, 20995, 21010, 21025, 21040, 21049, 21064, 21075, 21090, 21096, 21109, 21114,
+    21129, 21144, 21159, 21174, 21189, 21197, 21209, 21218, 21231, 21236, 21247, 21256,
+    21269, 21284, 21288, 21303, 21311, 21319, 21329, 21343, 21351, 21366, 21374, 21389,
+    21397, 21412, 21420, 21430, 21434, 21449, 21464, 21479, 21492, 21498, 21509, 21519,
+    21534, 21548, 21556, 21564, 21573, 21580, 21588, 21603,     0, 21612, 21620, 21635,
+    21644, 21659, 21671, 21686, 21691, 21695, 21710, 21725, 21729, 21739, 21754, 21758,
+    21765, 21780, 21791, 21799, 21802, 21810, 21818, 21823, 21832, 21845, 21853, 21868,
+    21874, 21880, 21893, 21903, 21913, 21922, 21934,     0, 21948, 21956, 21969, 21984,
+    21999, 22010, 22022, 22028, 22042, 22049, 22055, 22064, 22079, 22084, 22087, 22099,
+    22106, 22109, 22117, 22121, 22131, 22139,     0, 22146, 22099, 22160, 22174, 22182,
+    22192, 22204, 22210, 22219, 22225, 22240, 22252, 22260, 22275, 22285, 22300, 22307,
+    22314, 22325, 22332, 22343, 22357, 22367, 22369, 22384, 22389, 22392, 22407, 22416,
+    22429, 22442, 22453, 22462, 22470, 22482, 22487, 22496, 22503, 22518, 22533, 22541,
+    22551, 22558, 22567, 22575, 22584, 22599, 22614, 22619, 22633,     0, 22639, 22643,
+    22653, 22661, 22667, 22682, 22695, 22702, 22715, 22724, 22729, 22744, 22751, 22758,
+    22772, 22784, 22790, 22799, 22809, 22821, 22830, 22845, 22851, 22862, 22877, 22892,
+    22899, 22908, 22920, 22933, 22941, 22944, 22951, 22956, 22967, 22978, 22982, 22985,
+    23000, 23008, 23023, 23037, 23045, 23055, 23068, 23079, 23090, 23097, 23112, 23118,
+    23125, 23134, 23139, 23150, 23160, 23164, 23179, 23191, 23199, 23203, 23210, 23215,
+    23225,     0, 23233, 23242, 23252, 23260, 23272,     0, 23287, 23293, 23308, 23323,
+    23327, 23342, 23353, 23361, 23372, 23377, 23389, 23404,     0, 23417, 23425, 23437,
+    23445, 23449, 23454, 23465, 23477, 23490, 23497, 23502, 23515, 23530, 23536, 23541,
+    23552, 23559, 23574, 23582, 23597, 23611, 23626, 23641, 23651, 23657, 23672, 23687,
+    23695, 23700, 23712, 23727, 23731, 23739, 23745, 23755, 23767, 23776, 23788, 23803,
+    23811,     0, 23815, 23826, 23833, 23848, 23857, 23867, 23876, 23886, 23891, 23904,
+    23917, 23924, 23929, 23937, 23946, 23961, 23968, 23976, 23984, 23990, 23993, 23998,
+    24011, 24026, 24037, 24049, 24057, 24071, 24085, 24092, 24106, 24120, 24135, 24145,
+    24152, 24167,     0, 24182, 24190, 24195, 24201, 24214, 24218, 24227, 24235, 24248,
+    24259, 24274, 24283, 24292, 24306, 24312,     0, 24316,     0, 24331, 24340, 24350,
+    24365, 24372, 24385, 24400, 24411, 24420, 24431, 24439, 24454, 24469, 24484, 24494,
+    24508, 24516, 24519, 24532, 24542, 24554, 24565, 24568, 24583, 24591, 24599, 24614,
+    24625, 24639,     0, 24651, 24655, 24670, 24679,     0, 24689, 24698,     0, 24704,
+    24719, 24730, 24740, 24751, 24764, 24768, 24779, 24788, 24795, 24798, 24806, 24816,
+    24822, 24829, 24841, 24853, 24861, 24876, 24882, 24889, 24895, 24900, 24915, 24930,
+    24938, 24945, 24960, 24964, 24971, 24979, 24994, 25005, 25020, 25030, 25036, 25051,
+    25058, 25066, 25077, 25085, 25090, 25105, 25119, 25130, 25138, 25144,     0, 25150,
+    25154, 25160, 25175, 25187, 25192, 25207,     0, 25220, 25232, 25245, 25260, 25268,
+    25276, 25282, 25297, 25307, 25314, 25324, 25331, 25345, 25354, 25362, 25372, 25383,
+    25389, 25399, 25413, 25423, 25434, 25448, 25460, 25467, 25480, 25491, 25493, 25502,
+    25509, 25524, 25530, 25545, 25554, 25563, 25578, 25593, 25600, 25604, 25612, 25621,
+    25636, 25645, 25651, 25666, 25681, 25685, 25700, 25714, 25723, 25732, 25747, 25760,
+    25773, 25788, 25795, 25801, 25811, 25824, 25837, 25845, 25853, 25859, 25865, 25879,
+        0,     0,     0, 25891, 25896, 25903, 25908, 25913, 25928, 25935, 25943, 25952,
+    25959, 25974, 25981, 25989, 26004, 26016, 26024, 26039, 26044, 26059, 26071, 26078,
+    26082, 26095, 26100, 26115, 26125, 26140, 26150, 26164, 26173, 26188, 26202, 26217,
+        0, 26232, 26240, 26246, 26254, 26269, 26274, 26289, 26296, 26300, 26311, 26326,
+    26332, 26344, 26353, 26366, 26370, 26374, 26382, 26395, 26403, 26410, 26421, 26432,
+    26445, 26451, 26461, 26465, 26480,     0, 26489, 26498, 26512, 26527, 26534, 26548,
+    26563, 26567,     0, 26582, 26586, 26595, 26609, 26618, 26629, 26633, 26646, 26656,
+    26663, 26678, 26682, 26686, 26701, 26709, 26723, 26735, 26750, 26762, 26769, 26780,
+    26789, 26800, 26807, 26809, 26820, 26834,     0, 26847, 26857, 26864, 26875, 26880,
+    26891, 26897, 26905, 26914, 26922, 26931, 26940, 26945, 26960, 26975, 26990, 27005,
+    27020,     0,     0, 27029,     0, 27044, 27059, 27068, 27075, 27085, 27093, 27101,
+    27111, 27126, 27141, 27156, 27171, 27175, 27179, 27182, 27193, 27201, 27209,     0,
+    27216, 27231, 27238, 27245, 27258, 27260, 27270, 27277, 27291, 27300, 27313, 27328,
+    27335, 27342, 27351, 27357, 27364, 27368, 27373, 27385, 27394, 27406, 27416, 27423,
+    27431, 27446, 27452, 27464, 27479, 27483, 27495, 27505, 27520, 27533, 27541, 27553,
+    27568,     0, 27573, 27581, 27593, 27600, 27615,     0, 27630, 27637, 27648, 27659,
+    27669, 27683, 27696, 27704, 27719, 27729, 27742, 27754, 27765, 27773, 27784, 27793,
+    27808, 27814, 27823, 27830, 27842, 27848, 27863, 27873, 27880, 27891, 27903, 27915,
+    27922, 27931, 27940, 27945, 27957,     0, 27972, 27980, 27987, 27996, 28004, 28010,
+    28015, 28028, 28041, 28056, 28063, 28074, 28081, 28096, 28104, 28109, 28114, 28122,
+    28131, 28137, 28152, 28155, 28166, 28177, 28191, 28206, 28221,     0, 28230, 28236,
+    28244, 28252, 28260, 28263, 28278,     0, 28293, 28301, 28311, 28323, 28338, 28346,
+    28360, 28367, 28382, 28397, 28406, 28415, 28426, 28435, 28443, 28454, 28460, 28474,
+        0, 28484, 28491, 28497, 28506,     0, 28518, 28530, 28542, 28557, 28565, 28574,
+    28583, 28589, 28604, 28612, 28617, 28627, 28638, 28646, 28655, 28670, 28676, 28691,
+    28697, 28706, 28713, 28723, 28728, 28735, 28750, 28753, 28767, 28774, 28781, 28789,
+    28798, 28802, 28814, 28829, 28844, 28847, 28860, 28869, 28873, 28884, 28899, 28905,
+    28911, 28924, 28936, 28951, 28959, 28966, 28979, 28986, 29001, 29016, 29029, 29034,
+    29041, 29051, 29057, 29072, 29083, 29093,     0, 29108, 29117, 29127,     0, 29136,
+    29146, 29156, 29162, 29170, 29182, 29189, 29200, 29212, 29222, 29229, 29244, 29259,
+    29271, 29284, 29292, 29298, 29305, 29320, 29335, 29348, 29361, 29374, 29381, 29388,
+    29394, 29405, 29412, 29425, 29434, 29440, 29448, 29458, 29469, 29484, 29495, 29501,
+    29516, 29530, 29536, 29546, 29561, 29572,     0, 29579, 29588, 29598, 29612, 29627,
+    29633, 29641, 29648, 29653, 29659, 29670, 29685, 29695, 29710, 29715,     0, 29730,
+    29739, 29754, 29769, 29784, 29798, 29808,     0, 29816, 29828, 29843, 29853, 29856,
+    29867, 29879, 29886, 29901, 29916, 29924, 29939, 29948, 29954, 29961, 29967, 29981,
+    29996, 30001, 30008, 30023, 30030, 30045, 30059, 30068, 30071, 30086, 30094, 30099,
+    30109, 30124, 30131, 30142, 30154, 30158, 30169, 30175, 30181, 30196, 30210, 30216,
+    30227, 30233, 30248, 30263, 30278, 30290, 30305, 30315, 30320, 30329, 30336, 30351,
+    30357, 30372, 30382, 30395,     0, 30410, 30420, 30435, 30443, 30448,     0, 30453,
+    30468, 30480, 30486, 30499, 30506, 30521, 30534, 30549, 30556, 30561, 30576, 30586,
+    30600, 30611, 30626, 30633, 30648, 30663, 30676, 30683, 30688, 30703, 30713, 30728,
+    30740, 30748, 30761, 30769, 30784, 30790,     0, 30803, 30818, 30827, 30841, 30852,
+    30860, 30875, 30886, 30900, 30907, 30922, 30935, 30948, 30963, 30978, 30986, 30994,
+    30999, 31014,     0, 31018, 31024, 31031, 31046, 31056, 31068, 31077, 31083, 31098,
+    31106,     0, 31115, 31123, 31131, 31138, 31142, 31157, 31164, 31174, 31189, 31198,
+    31207, 31217, 31227, 31236, 31251, 31257, 31272, 31282, 31296,     0, 31308, 31319,
+    31333, 31348, 31351, 31364, 31370, 31378, 31390, 31396, 31403, 31409, 31420, 31429,
+    31436, 31446, 31457, 31466, 31481, 31491, 31506, 31520, 31525, 31538, 31553, 31566,
+    31572, 31587, 31595, 31610, 31624, 31639, 31647, 31654, 31664, 31679, 31694, 31709,
+    31715, 31719, 31729, 31740, 31753, 31767, 31774, 31782, 31793, 31807, 31815, 31830,
+    31845, 31853, 31859, 31874, 31889, 31895, 31910, 31922,     0, 31934, 31940, 31955,
+    31961, 31976, 31983, 31995, 32006, 32016, 32027, 32035, 32050, 32060, 32075, 32085,
+        0, 32097, 32104, 32110, 32125, 32140, 32155, 32163, 32169, 32173, 32186, 32198,
+    32213, 32222, 32237, 32246, 32261, 32271, 32277, 32290, 32305, 32310, 32317, 32332,
+    32344, 32351, 32366, 32374, 32382, 32391, 32402, 32413, 32419, 32434, 32443, 32456,
+    32460, 32466, 32480, 32483, 32498, 32508, 32522, 32535,     0, 32550, 32557, 32568,
+    32581, 32596, 32608, 32618, 32630, 32635, 32642, 32653,     0, 32662, 32677, 32692,
+    32707, 32718, 32724, 32739, 32745, 32758, 32764, 32775, 32781, 32785, 32794, 32801,
+    32808, 32813, 32823, 32833, 32845, 32852, 32861, 32876, 32880,     0, 32892, 32901,
+    32913, 32927, 32942, 32947, 32962, 32975, 32979, 32992, 33004, 33019, 33027, 33038,
+    33053, 33068, 33072, 33083, 33092, 33107, 33118, 33128, 33141, 33156, 33158, 33162,
+    33175, 33190, 33198, 33213, 33219, 33225, 33232, 33247, 33257, 33260, 33270, 33280,
+    33295, 33305, 33310, 33321,     0, 33334, 33345, 33355, 33365, 33380, 33385, 33400,
+    33415, 33423, 33438, 33447, 33460, 33466, 33479, 33491, 33504, 33511, 33521, 33533,
+    33538, 33553, 33561, 33569, 33584, 33598, 33613, 33627, 33639, 33648, 33659, 33668,
+    33683, 33698, 33710, 33725, 33740, 33755, 33763, 33770, 33777, 33792, 33807, 33817,
+    33832, 33836, 33849, 33855, 33862, 33872,     0, 33883, 33898, 33913,     0, 33923,
+    33937, 33946, 33957, 33972, 33976, 33991, 34003, 34018, 34031, 34046, 34059, 34066,
+    34079, 34093, 34099, 34110, 34116, 34131, 34134, 34139, 34154, 34164, 34179, 34194,
+    34202, 34209, 34220, 34235, 34244, 34255, 34269, 34282, 34285, 34297, 34309, 34324,
+    34330, 34345, 34352, 34363, 34378, 34383, 34398, 34405, 34420, 34425, 34432, 34436,
+    34446, 34453, 34464, 34478, 34493, 34498, 34503, 34508, 34520, 34535, 34550, 34562,
+    34577, 34592, 34600, 34605, 34620, 34635, 34648, 34654, 34658, 34670, 34685, 34696,
+    34702, 34713, 34724, 34739, 34754, 34760, 34774, 34784, 34788, 34798, 34813, 34820,
+    34828, 34843, 34855, 34870, 34879, 34885, 34900, 34906, 34921, 34927,     0, 34934,
+    34942, 34950, 34958, 34966, 34981, 34990, 35005, 35020, 35029, 35044, 35053, 35058,
+    35063, 35069, 35084, 35094, 35100, 35112, 35127, 35139, 35146, 35154, 35163, 35178,
+    35190, 35201, 35205, 35217, 35222, 35236, 35251, 35257, 35266, 35279, 35286, 35291,
+    35302, 35306, 35313, 35320, 35328, 35336, 35344, 35350, 35365, 35376, 35382, 35397,
+    35408, 35416, 35431, 35438, 35449, 35464, 35479, 35485, 35493, 35508, 35518, 35527,
+    35536, 35548, 35557, 35572, 35582, 35589, 35597, 35608, 35616, 35625, 35638, 35649,
+    35661, 35667, 35675, 35681, 35692, 35707, 35722, 35737, 35748, 35755, 35760, 35769,
+    35780, 35795, 35808, 35815, 35826, 35831, 35838, 35844, 35859, 35874, 35880, 35895,
+    35905, 35912, 35925, 35940, 35952, 35964, 35978, 35992, 36006, 36014, 36027, 36033,
+    36045, 36060, 36069, 36082, 36089, 36104, 36113, 36128, 36137, 36144, 36153, 36163,
+    36178, 36186, 36201, 36210, 36224, 36237, 36245, 36260, 36269, 36279, 36291, 36298,
+        0, 36303, 36314, 36329, 36342, 36356, 36364, 36372, 36381, 36389, 36395, 36409,
+    36424, 36433, 36448, 36463, 36469, 36479, 36494, 36509, 36522, 36530, 36539, 36548,
+    36563, 36578, 36590, 36605, 36611, 36626, 36636, 36644, 36650, 36657, 36666, 36677,
+    36687, 36694, 36709, 36718, 36727, 36740, 36755, 36761, 36776, 36791, 36798, 36813,
+    36828, 36840, 36855, 36867, 36882, 36892, 36903, 36917, 36927, 36936, 36944, 36958,
+    36966, 36975, 36990, 37000, 37004, 37019, 37025, 37038, 37051, 37064, 37070, 37085,
+    37096, 37111, 37121, 37131, 37145, 37159, 37164, 37177, 37192, 37207, 37217, 37232,
+    37245, 37260, 37265, 37280, 37288, 37303, 37309, 37324, 37331, 37346, 37361, 37376,
+    37388, 37402, 37409, 37423, 37435, 37450, 37462, 37471, 37486, 37501, 37508, 37523,
+    37529, 37539, 37549, 37564, 37571, 37578, 37583, 37591, 37606, 37610, 37624, 37633,
+    37640, 37646, 37654, 37667, 37675, 37690, 37696, 37704, 37711, 37719, 37732, 37738,
+    37749, 37755, 37770, 37785, 37792, 37798, 37802, 37817, 37827, 37842, 37856, 37863,
+    37871, 37879, 37894, 37903, 37910, 37921, 37934, 37942, 37954, 37964, 37972, 37978,
+    37990, 38005, 38020, 38029, 38039, 38048, 38063, 38070, 38083, 38089, 38098, 38113,
+    38127, 38140, 38147, 38157, 38171, 38175, 38190, 38201, 38216, 38221, 38232, 38243,
+    38251, 38266, 38276, 38291, 38306, 38315, 38325, 38330, 38341, 38353, 38360, 38366,
+    38377, 38384, 38399, 38407, 38417, 38432, 38447, 38462, 38473, 38484, 38495, 38500,
+    38507, 38522, 38537, 38543, 38556, 38571, 38581, 38590, 38596, 38611, 38620, 38630,
+    38640, 38651, 38666, 38672, 38678, 38686, 38693, 38701, 38709, 38716, 38723, 38727,
+    38734, 38744, 38753,     0, 38767,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+        0,     0, 38782,     0,     0, 38792, 38798, 38809, 38813, 38820, 38835, 38850,
+    38865, 38872, 38887, 38894, 38909, 38917, 38932, 38947, 38954, 38967, 38978, 38992,
+    39007, 39022, 39031, 39039, 39048, 39056, 39063, 39070, 39079, 39094, 39109, 39118,
+    39129, 39142, 39152, 39159, 39173, 39183, 39198, 39208, 39221, 39234, 39249, 39254,
+    39269, 39278, 39286, 39289, 39303, 39313, 39326, 39334, 39346, 39353, 39357, 39369,
+    39384, 39391, 39402, 39407, 39422, 39430, 39445, 39451, 39461, 39470, 39477, 39492,
+    39506, 39516, 39531, 39546, 39554, 39559, 39574, 39585, 39597, 39605, 39620,
+};
+
+const char BT_COMPANY_POOL[79255] =
+    "\000\000"
+    "Ericsson AB\000"
+    "Nokia Mobile Phones\000"
+    "Intel Corp.\000"
+    "IBM Corp.\000"
+    "Toshiba Corp.\000"
+    "3Com\000\000"
+    "Microsoft\000"
+    "Lucent\000\000"
+    "Motorola\000\000"
+    "Infineon Technologies AG\000\000"
+    "Qualcomm Technologies Interna\000"
+    "Silicon Wave\000\000"
+    "Digianswer A/S\000\000"
+    "Texas Instruments Inc.\000\000"
+    "Parthus Technologies Inc.\000"
+    "Broadcom Corporation\000\000"
+    "Mitel Semiconductor\000"
+    "Widcomm, Inc.\000"
+    "Zeevo, Inc.\000"
+    "Atmel Corporation\000"
+    "Mitsubishi Electric Corporati\000"
+    "RTX A/S\000"
+    "KC Technology Inc.\000\000"
+    "Newlogic\000\000"
+    "Transilica, Inc.\000\000"
+    "Rohde & Schwarz GmbH & Co. KG\000"
+    "TTPCom Limited\000\000"
+    "Signia Technologies, Inc.\000"
+    "Conexant Systems Inc.\000"
+    "Qualcomm\000\000"
+    "Inventel\000\000"
+    "AVM Berlin\000\000"
+    "BandSpeed, Inc.\000"
+    "Mansella Ltd\000\000"
+    "NEC Corporation\000"
+    "WavePlus Technology Co., Ltd.\000"
+    "Alcatel\000"
+    "NXP B.V.\000\000"
+    "C Technologies\000\000"
+    "Open Interface\000\000"
+    "R F Micro Devices\000"
+    "Hitachi Ltd\000"
+    "Symbol Technologies, Inc.\000"
+    "Tenovis\000"
+    "Macronix International Co. Lt\000"
+    "GCT Semiconductor\000"
+    "Norwood Systems\000"
+    "MewTel Technology Inc.\000\000"
+    "ST Microelectronics\000"
+    "Synopsys, Inc.\000\000"
+    "Red-M (Communications) Ltd\000\000"
+    "Commil Ltd\000\000"
+    "Computer Access Technology Co\000"
+    "Eclipse (HQ Espana) S.L.\000\000"
+    "Renesas Electronics Corporati\000"
+    "Mobilian Corporation\000\000"
+    "Syntronix Corporation\000"
+    "Integrated System Solution Co\000"
+    "Panasonic Holdings Corporatio\000"
+    "Gennum Corporation\000\000"
+    "BlackBerry Limited\000\000"
+    "IPextreme, Inc.\000"
+    "Systems and Chips, Inc\000\000"
+    "Bluetooth SIG, Inc\000\000"
+    "Seiko Epson Corporation\000"
+    "Integrated Silicon Solution T\000"
+    "CONWISE Technology Corporatio\000"
+    "PARROT AUTOMOTIVE SAS\000"
+    "Socket Mobile\000"
+    "Atheros Communications, Inc.\000\000"
+    "MediaTek, Inc.\000\000"
+    "Bluegiga\000\000"
+    "Marvell Technology Group Ltd.\000"
+    "3DSP Corporation\000\000"
+    "Accel Semiconductor Ltd.\000\000"
+    "AUMOVIO Systems, Inc.\000"
+    "Apple, Inc.\000"
+    "Staccato Communications, Inc.\000"
+    "Avago Technologies\000\000"
+    "APT Ltd.\000\000"
+    "SiRF Technology, Inc.\000"
+    "Tzero Technologies, Inc.\000\000"
+    "J&M Corporation\000"
+    "Free2move AB\000\000"
+    "3DiJoy Corporation\000\000"
+    "Plantronics, Inc.\000"
+    "Sony Ericsson Mobile Communic\000"
+    "Harman International Industri\000"
+    "Vizio, Inc.\000"
+    "Nordic Semiconductor ASA\000\000"
+    "EM Microelectronic-Marin SA\000"
+    "Ralink Technology Corporation\000"
+    "Belkin International, Inc.\000\000"
+    "Realtek Semiconductor Corpora\000"
+    "Stonestreet One, LLC\000\000"
+    "Wicentric, Inc.\000"
+    "RivieraWaves S.A.S\000\000"
+    "RDA Microelectronics\000\000"
+    "Gibson Guitars\000\000"
+    "MiCommand Inc.\000\000"
+    "Band XI International, LLC\000\000"
+    "HP, Inc.\000\000"
+    "GN Hearing\000\000"
+    "General Motors\000\000"
+    "A&D Engineering, Inc.\000"
+    "LTIMINDTREE LIMITED\000"
+    "Polar Electro OY\000\000"
+    "Beautiful Enterprise Co., Ltd\000"
+    "Summit Data Communications, I\000"
+    "Sound ID\000\000"
+    "Monster, LLC\000\000"
+    "connectBlue AB\000\000"
+    "ShangHai Super Smart Electron\000"
+    "Group Sense Ltd.\000\000"
+    "Zomm, LLC\000"
+    "Samsung Electronics Co. Ltd.\000\000"
+    "Creative Technology Ltd.\000\000"
+    "Laird Connectivity LLC\000\000"
+    "Nike, Inc.\000\000"
+    "lesswire AG\000"
+    "MStar Semiconductor, Inc.\000"
+    "Hanlynn Technologies\000\000"
+    "Seers Technology Co., Ltd.\000\000"
+    "Sports Tracking Technologies\000\000"
+    "Autonet Mobile\000\000"
+    "DeLorme Publishing Company, I\000"
+    "WuXi Vimicro\000\000"
+    "DSEA A/S\000\000"
+    "TimeKeeping Systems, Inc.\000"
+    "Ludus Helsinki Ltd.\000"
+    "BlueRadios, Inc.\000\000"
+    "Equinux AG\000\000"
+    "Garmin International, Inc.\000\000"
+    "Ecotest\000"
+    "GN Hearing A/S\000\000"
+    "Jawbone\000"
+    "Topcon Positioning Systems, L\000"
+    "Gimbal Inc.\000"
+    "Zscan Software\000\000"
+    "Quintic Corp\000\000"
+    "Telit Wireless Solutions GmbH\000"
+    "Funai Electric Co., Ltd.\000\000"
+    "Advanced PANMOBIL systems Gmb\000"
+    "ThinkOptics, Inc.\000"
+    "Universal Electronics, Inc.\000"
+    "Airoha Technology Corp.\000"
+    "NEC Lighting, Ltd.\000\000"
+    "ODM Technology, Inc.\000\000"
+    "ConnecteDevice Ltd.\000"
+    "zero1.tv GmbH\000"
+    "i.Tech Dynamic Global Distrib\000"
+    "Alpwise\000"
+    "Jiangsu Toppower Automotive E\000"
+    "Colorfy, Inc.\000"
+    "Geoforce Inc.\000"
+    "Bose Corporation\000\000"
+    "Suunto Oy\000"
+    "Kensington Computer Products\000\000"
+    "SR-Medizinelektronik\000\000"
+    "Vertu Corporation Limited\000"
+    "Meta Watch Ltd.\000"
+    "LINAK A/S\000"
+    "OTL Dynamics LLC\000\000"
+    "Panda Ocean Inc.\000\000"
+    "Visteon Corporation\000"
+    "ARP Devices Limited\000"
+    "MARELLI EUROPE S.P.A.\000"
+    "CAEN RFID srl\000"
+    "Ingenieur-Systemgruppe Zahn G\000"
+    "Green Throttle Games\000\000"
+    "Peter Systemtechnik GmbH\000\000"
+    "Omegawave Oy\000\000"
+    "Cinetix\000"
+    "Passif Semiconductor Corp\000"
+    "Saris Cycling Group, Inc\000\000"
+    "Bekey A/S\000"
+    "Clarinox Technologies Pty. Lt\000"
+    "BDE Technology Co., Ltd.\000\000"
+    "Swirl Networks\000\000"
+    "Meso international\000\000"
+    "TreLab Ltd\000\000"
+    "Qualcomm Innovation Center, I\000"
+    "Johnson Controls, Inc.\000\000"
+    "Starkey Hearing Technologies\000\000"
+    "S-Power Electronics Limited\000"
+    "Ace Sensor Inc\000\000"
+    "Aplix Corporation\000"
+    "AAMP of America\000"
+    "Stalmart Technology Limited\000"
+    "AMICCOM Electronics Corporati\000"
+    "Shenzhen Excelsecu Data Techn\000"
+    "Geneq Inc.\000\000"
+    "adidas AG\000"
+    "LG Electronics\000\000"
+    "Onset Computer Corporation\000\000"
+    "Selfly BV\000"
+    "Quuppa Oy.\000\000"
+    "GeLo Inc\000\000"
+    "Evluma\000\000"
+    "MC10\000\000"
+    "Binauric SE\000"
+    "Beats Electronics\000"
+    "Microchip Technology Inc.\000"
+    "Eve Systems GmbH\000\000"
+    "ARCHOS SA\000"
+    "Dexcom, Inc.\000\000"
+    "Polar Electro Europe B.V.\000"
+    "Renesas Design Netherlands B.\000"
+    "Taixingbang Technology (HK) C\000"
+    "Austco Communication Systems\000\000"
+    "Timex Group USA, Inc.\000"
+    "Qualcomm Technologies, Inc.\000"
+    "Qualcomm Connected Experience\000"
+    "Voyetra Turtle Beach\000\000"
+    "txtr GmbH\000"
+    "Snuza (Pty) Ltd\000"
+    "Procter & Gamble\000\000"
+    "Hosiden Corporation\000"
+    "Muzik LLC\000"
+    "Misfit Wearables Corp\000"
+    "Google\000\000"
+    "Danlers Ltd\000"
+    "Semilink Inc\000\000"
+    "inMusic Brands, Inc\000"
+    "L.S. Research, Inc.\000"
+    "Eden Software Consultants Ltd\000"
+    "KS Technologies\000"
+    "ACTS Technologies\000"
+    "Vtrack Systems\000\000"
+    "Nielsen-Kellerman\000"
+    "Server Technology Inc.\000\000"
+    "BioResearch Associates\000\000"
+    "Jolly Logic, LLC\000\000"
+    "Above Average Outcomes, Inc.\000\000"
+    "Bitsplitters GmbH\000"
+    "PayPal, Inc.\000\000"
+    "Witron Technology Limited\000"
+    "Morse Project Inc.\000\000"
+    "Kent Displays Inc.\000\000"
+    "Nautilus Inc.\000"
+    "Smartifier Oy\000"
+    "Elcometer Limited\000"
+    "VSN Technologies, Inc.\000\000"
+    "AceUni Corp., Ltd.\000\000"
+    "Crystal Alarm AB\000\000"
+    "KOUKAAM a.s.\000\000"
+    "Delphi Corporation\000\000"
+    "ValenceTech Limited\000"
+    "Stanley Black and Decker\000\000"
+    "Typo Products, LLC\000\000"
+    "TomTom International BV\000"
+    "Fugoo, Inc.\000"
+    "Keiser Corporation\000\000"
+    "Bang & Olufsen A/S\000\000"
+    "PLUS Location Systems Pty Ltd\000"
+    "Ubiquitous Computing Technolo\000"
+    "Innovative Yachtter Solutions\000"
+    "Demant A/S\000\000"
+    "Chicony Electronics Co., Ltd.\000"
+    "Atus BV\000"
+    "Codegate Ltd\000\000"
+    "ERi, Inc\000\000"
+    "Transducers Direct, LLC\000"
+    "DENSO TEN Limited\000"
+    "Audi AG\000"
+    "HiSilicon Technologies CO., L\000"
+    "Nippon Seiki Co., Ltd.\000\000"
+    "Steelseries ApS\000"
+    "Visybl Inc.\000"
+    "Openbrain Technologies, Co.,\000\000"
+    "e.solutions\000"
+    "10AK Technologies\000"
+    "Wimoto Technologies Inc\000"
+    "Radius Networks, Inc.\000"
+    "Qualcomm Labs, Inc.\000"
+    "Hewlett Packard Enterprise\000\000"
+    "Baidu\000"
+    "Arendi AG\000"
+    "Skoda Auto a.s.\000"
+    "Volkswagen AG\000"
+    "Porsche AG\000\000"
+    "Sino Wealth Electronic Ltd.\000"
+    "AirTurn, Inc.\000"
+    "Kinsa, Inc\000\000"
+    "HID Global\000\000"
+    "SEAT es\000"
+    "Promethean Ltd.\000"
+    "Salutica Allied Solutions\000"
+    "GPSI Group Pty Ltd\000\000"
+    "Nimble Devices Oy\000"
+    "Changzhou Yongse Infotech  Co\000"
+    "SportIQ\000"
+    "TEMEC Instruments B.V.\000\000"
+    "Sony Corporation\000\000"
+    "ASSA ABLOY\000\000"
+    "Clarion Co. Inc.\000\000"
+    "Warehouse Innovations\000"
+    "Cypress Semiconductor\000"
+    "MADS Inc\000\000"
+    "Blue Maestro Limited\000\000"
+    "Resolution Products, Ltd.\000"
+    "Aireware LLC\000\000"
+    "Silvair, Inc.\000"
+    "Prestigio Plaza Ltd.\000\000"
+    "NTEO Inc.\000"
+    "Focus Systems Corporation\000"
+    "Tencent Holdings Ltd.\000"
+    "Allegion\000\000"
+    "Murata Manufacturing Co., Ltd\000"
+    "WirelessWERX\000\000"
+    "Nod, Inc.\000"
+    "Alpine Electronics (China) Co\000"
+    "FedEx Services\000\000"
+    "Grape Systems Inc.\000\000"
+    "Bkon Connect\000\000"
+    "Lintech GmbH\000\000"
+    "Novatel Wireless\000\000"
+    "Ciright\000"
+    "Mighty Cast, Inc.\000"
+    "Ambimat Electronics\000"
+    "Perytons Ltd.\000"
+    "Tivoli Audio, LLC\000"
+    "Master Lock\000"
+    "Mesh-Net Ltd\000\000"
+    "HUIZHOU DESAY SV AUTOMOTIVE C\000"
+    "Tangerine, Inc.\000"
+    "B&W Group Ltd.\000\000"
+    "Pioneer Corporation\000"
+    "OnBeep\000\000"
+    "Vernier Software & Technology\000"
+    "ROL Ergo\000\000"
+    "Pebble Technology\000"
+    "NETATMO\000"
+    "Accumulate AB\000"
+    "Anhui Huami Information Techn\000"
+    "Inmite s.r.o.\000"
+    "ChefSteps, Inc.\000"
+    "micas AG\000\000"
+    "Biomedical Research Ltd.\000\000"
+    "Pitius Tec S.L.\000"
+    "Estimote, Inc.\000\000"
+    "Unikey Technologies, Inc.\000"
+    "Timer Cap Co.\000"
+    "AwoX\000\000"
+    "yikes\000"
+    "MADSGlobalNZ Ltd.\000"
+    "PCH International\000"
+    "Qingdao Yeelink Information T\000"
+    "Milwaukee Electric Tools\000\000"
+    "MISHIK Pte Ltd\000\000"
+    "Ascensia Diabetes Care US Inc\000"
+    "Spicebox LLC\000\000"
+    "emberlight\000\000"
+    "Copeland Cold Chain LP\000\000"
+    "Qblinks\000"
+    "MYSPHERA\000\000"
+    "LifeScan Inc\000\000"
+    "Volantic AB\000"
+    "Podo Labs, Inc\000\000"
+    "Roche Diabetes Care AG\000\000"
+    "Amazon.com Services LLC\000"
+    "Connovate Technology Private\000\000"
+    "Kocomojo, LLC\000"
+    "Everykey Inc.\000"
+    "Dynamic Controls\000\000"
+    "SentriLock\000\000"
+    "I-SYST inc.\000"
+    "CASIO COMPUTER CO., LTD.\000\000"
+    "LAPIS Semiconductor Co.,Ltd\000"
+    "Telemonitor, Inc.\000"
+    "taskit GmbH\000"
+    "Mercedes-Benz Group AG\000\000"
+    "BatAndCat\000"
+    "BluDotz Ltd\000"
+    "XTel Wireless ApS\000"
+    "Gigaset Technologies GmbH\000"
+    "Gecko Health Innovations, Inc\000"
+    "HOP Ubiquitous\000\000"
+    "Walt Disney\000"
+    "Nectar\000\000"
+    "CORE Lighting Ltd\000"
+    "Seraphim Sense Ltd\000\000"
+    "Unico RBC\000"
+    "Physical Enterprises Inc.\000"
+    "Able Trend Technology Limited\000"
+    "Konica Minolta, Inc.\000\000"
+    "Wilo SE\000"
+    "Extron Design Services\000\000"
+    "Google LLC\000\000"
+    "Intelletto Technologies Inc.\000\000"
+    "FDK CORPORATION\000"
+    "Cloudleaf, Inc\000\000"
+    "Maveric Automation LLC\000\000"
+    "Acoustic Stream Corporation\000"
+    "Zuli\000\000"
+    "Paxton Access Ltd\000"
+    "WiSilica Inc.\000"
+    "VENGIT Korlatolt Felelossegu\000\000"
+    "SALTO SYSTEMS S.L.\000\000"
+    "TRON Forum\000\000"
+    "CUBETECH s.r.o.\000"
+    "Cokiya Incorporated\000"
+    "CVS Health\000\000"
+    "Ceruus\000\000"
+    "Strainstall Ltd\000"
+    "Channel Enterprises (HK) Ltd.\000"
+    "FIAMM\000"
+    "GIGALANE.CO.,LTD\000\000"
+    "EROAD\000"
+    "MSA Innovation, LLC\000"
+    "Icon Health and Fitness\000"
+    "Wille Engineering\000"
+    "ENERGOUS CORPORATION\000\000"
+    "Taobao\000\000"
+    "Canon Inc.\000\000"
+    "Geophysical Technology Inc.\000"
+    "Meta Platforms, Inc.\000\000"
+    "Trividia Health, Inc.\000"
+    "FlightSafety International\000\000"
+    "Sunrise Micro Devices, Inc.\000"
+    "Star Micronics Co., Ltd.\000\000"
+    "Netizens Sp. z o.o.\000"
+    "Nymi Inc.\000"
+    "Nytec, Inc.\000"
+    "Trineo Sp. z o.o.\000"
+    "Nest Labs Inc.\000\000"
+    "LM Technologies Ltd\000"
+    "General Electric Company\000\000"
+    "i+D3 S.L.\000"
+    "HANA Micron\000"
+    "Stages Cycling LLC\000\000"
+    "Cochlear Bone Anchored Soluti\000"
+    "SenionLab AB\000\000"
+    "Syszone Co., Ltd\000\000"
+    "Pulsate Mobile Ltd.\000"
+    "Hongkong OnMicro Electronics\000\000"
+    "BRADATECH Corp.\000"
+    "Transenergooil AG\000"
+    "DME Microelectronics\000\000"
+    "Bitcraze AB\000"
+    "HASWARE Inc.\000\000"
+    "Abiogenix Inc.\000\000"
+    "Poly-Control ApS\000\000"
+    "Avi-on\000\000"
+    "Laerdal Medical AS\000\000"
+    "Fetch My Pet\000\000"
+    "Sam Labs Ltd.\000"
+    "Chengdu Synwing Technology Lt\000"
+    "HOUWA SYSTEM DESIGN, k.k.\000"
+    "BSH\000"
+    "Primus Inter Pares Ltd\000\000"
+    "August Home, Inc\000\000"
+    "Gill Electronics\000\000"
+    "Sky Wave Design\000"
+    "Newlab S.r.l.\000"
+    "ELAD srl\000\000"
+    "G-wearables inc.\000\000"
+    "Code Corporation\000\000"
+    "Savant Systems LLC\000\000"
+    "Logitech International SA\000"
+    "Innblue Consulting\000\000"
+    "iParking Ltd.\000"
+    "Koninklijke Philips N.V.\000\000"
+    "Minelab Electronics Pty Limit\000"
+    "Bison Group Ltd.\000\000"
+    "Widex A/S\000"
+    "Jolla Ltd\000"
+    "Caterpillar Inc\000"
+    "Freedom Innovations\000"
+    "Dynamic Devices Ltd\000"
+    "Technology Solutions (UK) Ltd\000"
+    "Advanced Application Design,\000\000"
+    "Spreadtrum Communications Sha\000"
+    "CuteCircuit LTD\000"
+    "Valeo Service\000"
+    "Fullpower Technologies, Inc.\000\000"
+    "KloudNation\000"
+    "Zebra Technologies Corporatio\000"
+    "Itron, Inc.\000"
+    "The University of Tokyo\000"
+    "UTC Fire and Security\000"
+    "Cool Webthings Limited\000\000"
+    "DJO Global\000\000"
+    "Gelliner Limited\000\000"
+    "Anyka (Guangzhou) Microelectr\000"
+    "Medtronic Inc.\000\000"
+    "Gozio Inc.\000\000"
+    "Form Lifting, LLC\000"
+    "Wahoo Fitness, LLC\000\000"
+    "Kontakt Micro-Location Sp. z\000\000"
+    "Radio Systems Corporation\000"
+    "Freescale Semiconductor, Inc.\000"
+    "Verifone Systems Pte Ltd. Tai\000"
+    "AR Timing\000"
+    "Rigado LLC\000\000"
+    "Kemppi Oy\000"
+    "Otter Products, LLC\000"
+    "STEMP Inc.\000\000"
+    "LumiGeek LLC\000\000"
+    "InvisionHeart Inc.\000\000"
+    "Macnica Inc.\000\000"
+    "Jaguar Land Rover Limited\000"
+    "CoroWare Technologies, Inc\000\000"
+    "Omron Healthcare Co., LTD\000"
+    "Comodule GMBH\000"
+    "ikeGPS\000\000"
+    "Telink Semiconductor Co. Ltd\000\000"
+    "Interplan Co., Ltd\000\000"
+    "Wyler AG\000\000"
+    "IK Multimedia Production srl\000\000"
+    "Lukoton Experience Oy\000"
+    "MTI Ltd\000"
+    "Tech4home, Lda\000\000"
+    "DOTT Limited\000\000"
+    "Blue Speck Labs, LLC\000\000"
+    "Cisco Systems, Inc\000\000"
+    "Mobicomm Inc\000\000"
+    "Edamic\000\000"
+    "Goodnet, Ltd\000\000"
+    "Luster Leaf Products  Inc\000"
+    "Manus Machina BV\000\000"
+    "Mobiquity Networks Inc\000\000"
+    "Praxis Dynamics\000"
+    "Philip Morris Products S.A.\000"
+    "Comarch SA\000\000"
+    "Nestl\303\251 Nespresso S.A.\000\000"
+    "Merlinia A/S\000\000"
+    "LifeBEAM Technologies\000"
+    "Twocanoes Labs, LLC\000"
+    "Muoverti Limited\000\000"
+    "Stamer Musikanlagen GMBH\000\000"
+    "Tesla, Inc.\000"
+    "Pharynks Corporation\000\000"
+    "Lupine\000\000"
+    "Siemens AG\000\000"
+    "Foster Electric Company, Ltd\000\000"
+    "ETA SA\000\000"
+    "x-Senso Solutions Kft\000"
+    "Shenzhen SuLong Communication\000"
+    "FengFan (BeiJing) Technology\000\000"
+    "Qrio Inc\000\000"
+    "Pitpatpet Ltd\000"
+    "MSHeli s.r.l.\000"
+    "Trakm8 Ltd\000\000"
+    "JIN CO, Ltd\000"
+    "Alatech Tehnology\000"
+    "Beijing CarePulse Electronic\000\000"
+    "ViCentra B.V.\000"
+    "Raven Industries\000\000"
+    "WaveWare Technologies Inc.\000\000"
+    "Argenox Technologies\000\000"
+    "Bragi GmbH\000\000"
+    "Masimo Corp\000"
+    "Iotera Inc\000\000"
+    "Endress+Hauser\000\000"
+    "ACKme Networks, Inc.\000\000"
+    "FiftyThree Inc.\000"
+    "Parker Hannifin Corp\000\000"
+    "Uwatec AG\000"
+    "Orlan LLC\000"
+    "Blue Clover Devices\000"
+    "M-Way Solutions GmbH\000\000"
+    "Microtronics Engineering GmbH\000"
+    "Schneider Schreibger\303\244te GmbH\000"
+    "Sapphire Circuits LLC\000"
+    "Lumo Bodytech Inc.\000\000"
+    "UKC Technosolution\000\000"
+    "Xicato Inc.\000"
+    "Playbrush\000"
+    "Dai Nippon Printing Co., Ltd.\000"
+    "G24 Power Limited\000"
+    "AdBabble Local Commerce Inc.\000\000"
+    "Devialet SA\000"
+    "ALTYOR\000\000"
+    "University of Applied Science\000"
+    "Five Interactive, LLC dba Zen\000"
+    "NetEase\357\274\210Hangzhou\357\274\211Network\000\000"
+    "Lexmark International Inc.\000\000"
+    "Fluke Corporation\000"
+    "Yardarm Technologies\000\000"
+    "SECVRE GmbH\000"
+    "Glacial Ridge Technologies\000\000"
+    "Identiv, Inc.\000"
+    "DDS, Inc.\000"
+    "SMK Corporation\000"
+    "Schawbel Technologies LLC\000"
+    "XMI Systems SA\000\000"
+    "Cerevo\000\000"
+    "Torrox GmbH & Co KG\000"
+    "Gemalto\000"
+    "DEKA Research & Development C\000"
+    "Domster Tadeusz Szydlowski\000\000"
+    "Technogym SPA\000"
+    "FLEURBAEY BVBA\000\000"
+    "Aptcode Solutions\000"
+    "LSI ADL Technology\000\000"
+    "Animas Corp\000"
+    "Alps Alpine Co., Ltd.\000"
+    "OCEASOFT\000\000"
+    "Motsai Research\000"
+    "Geotab\000\000"
+    "E.G.O. Elektro-Geraetebau Gmb\000"
+    "bewhere inc\000"
+    "Johnson Outdoors Inc\000\000"
+    "steute Schaltgerate GmbH & Co\000"
+    "Ekomini inc.\000\000"
+    "DEFA AS\000"
+    "Aseptika Ltd\000\000"
+    "HUAWEI Technologies Co., Ltd.\000"
+    "HabitAware, LLC\000"
+    "ruwido austria gmbh\000"
+    "ITEC corporation\000\000"
+    "StoneL\000\000"
+    "Sonova AG\000"
+    "Maven Machines, Inc.\000\000"
+    "Synapse Electronics\000"
+    "WOWTech Canada Ltd.\000"
+    "RF Code, Inc.\000"
+    "Wally Ventures S.L.\000"
+    "SK Telecom\000\000"
+    "Jetro AS\000\000"
+    "Code Gears LTD\000\000"
+    "NANOLINK APS\000\000"
+    "RF Digital Corp\000"
+    "Church & Dwight Co., Inc\000\000"
+    "Multibit Oy\000"
+    "CliniCloud Inc\000\000"
+    "Blue Bite\000"
+    "ELIAS GmbH\000\000"
+    "Sivantos GmbH\000"
+    "Petzl\000"
+    "storm power ltd\000"
+    "EISST Ltd\000"
+    "Inexess Technology Simma KG\000"
+    "Currant, Inc.\000"
+    "C2 Development, Inc.\000\000"
+    "Blue Sky Scientific, LLC\000\000"
+    "ALOTTAZS LABS, LLC\000\000"
+    "Kupson spol. s r.o.\000"
+    "Areus Engineering GmbH\000\000"
+    "Impossible Camera GmbH\000\000"
+    "Sera4 Ltd.\000\000"
+    "Itude\000"
+    "Pacific Lock Company\000\000"
+    "Tendyron Corporation\000\000"
+    "Robert Bosch GmbH\000"
+    "Illuxtron international B.V.\000\000"
+    "miSport Ltd.\000\000"
+    "Chargelib\000"
+    "Doppler Lab\000"
+    "BBPOS Limited\000"
+    "RTB Elektronik GmbH & Co. KG\000\000"
+    "Rx Networks, Inc.\000"
+    "WeatherFlow, Inc.\000"
+    "Technicolor USA Inc.\000\000"
+    "Bestechnic(Shanghai),Ltd\000\000"
+    "Raden Inc\000"
+    "Oura Health Oy\000\000"
+    "CLABER S.P.A.\000"
+    "Hyginex, Inc.\000"
+    "HANSHIN ELECTRIC RAILWAY CO.,\000"
+    "Schneider Electric\000\000"
+    "Oort Technologies LLC\000"
+    "Chrono Therapeutics\000"
+    "Rinnai Corporation\000\000"
+    "Swissprime Technologies AG\000\000"
+    "YOKOWO CO., LTD.\000\000"
+    "Genevac Ltd\000"
+    "Chemtronics\000"
+    "Seguro Technology Sp. z o.o.\000\000"
+    "Redbird Flight Simulations\000\000"
+    "Dash Robotics\000"
+    "LINE Corporation\000\000"
+    "Guillemot Corporation\000"
+    "Techtronic Power Tools Techno\000"
+    "Wilson Sporting Goods\000"
+    "Lenovo (Singapore) Pte Ltd.\000"
+    "Ayatan Sensors\000\000"
+    "Electronics Tomorrow Limited\000\000"
+    "OneSpan\000"
+    "PayRange Inc.\000"
+    "ABOV Semiconductor\000\000"
+    "AINA-Wireless Inc.\000\000"
+    "BMA ergonomics b.v.\000"
+    "Teva Branded Pharmaceutical P\000"
+    "Anima\000"
+    "3M\000\000"
+    "Empatica Srl\000\000"
+    "Afero, Inc.\000"
+    "Powercast Corporation\000"
+    "Secuyou ApS\000"
+    "OMRON Corporation\000"
+    "Send Solutions\000\000"
+    "NIPPON SYSTEMWARE CO.,LTD.\000\000"
+    "Neosfar\000"
+    "Fliegl Agrartechnik GmbH\000\000"
+    "Gilvader\000\000"
+    "Digi International Inc (R)\000\000"
+    "DeWalch Technologies, Inc.\000\000"
+    "Flint Rehabilitation Devices,\000"
+    "Samsung SDS Co., Ltd.\000"
+    "Blur Product Development\000\000"
+    "University of Michigan\000\000"
+    "Victron Energy BV\000"
+    "NTT docomo\000\000"
+    "Carmanah Technologies Corp.\000"
+    "Bytestorm Ltd.\000\000"
+    "Espressif Systems (Shanghai)\000\000"
+    "Unwire\000\000"
+    "Connected Yard, Inc.\000\000"
+    "American Music Environments\000"
+    "Sensogram Technologies, Inc.\000\000"
+    "Fujitsu Limited\000"
+    "Ardic Technology\000\000"
+    "Delta Systems, Inc\000\000"
+    "HTC Corporation\000"
+    "Citizen Holdings Co., Ltd.\000\000"
+    "SMART-INNOVATION.inc\000\000"
+    "Blackrat Software\000"
+    "The Idea Cave, LLC\000\000"
+    "GoPro, Inc.\000"
+    "AuthAir, Inc\000\000"
+    "Vensi, Inc.\000"
+    "Indagem Tech LLC\000\000"
+    "Intemo Technologies\000"
+    "Runteq Oy Ltd\000"
+    "IMAGINATION TECHNOLOGIES LTD\000\000"
+    "Clarius Mobile Health Corp.\000"
+    "Shanghai Frequen Microelectro\000"
+    "Lierda Science & Technology G\000"
+    "Silicon Laboratories\000\000"
+    "World Moto Inc.\000"
+    "Giatec Scientific Inc.\000\000"
+    "Loop Devices, Inc\000"
+    "IACA electronique\000"
+    "Oura Health Ltd\000"
+    "Swipp ApS\000"
+    "Life Laboratory Inc.\000\000"
+    "FUJI INDUSTRIAL CO.,LTD.\000\000"
+    "Surefire, LLC\000"
+    "Dolby Labs\000\000"
+    "Ellisys\000"
+    "Magnitude Lighting Converters\000"
+    "Hilti AG\000\000"
+    "Devdata S.r.l.\000\000"
+    "Shortcut Labs\000"
+    "SGL Italia S.r.l.\000"
+    "PEEQ DATA\000"
+    "Ducere Technologies Pvt Ltd\000"
+    "DiveNav, Inc.\000"
+    "RIIG AI Sp. z o.o.\000\000"
+    "Thermo Fisher Scientific\000\000"
+    "AG Measurematics Pvt. Ltd.\000\000"
+    "CHUO Electronics CO., LTD.\000\000"
+    "Aspenta International\000"
+    "Eugster Frismag AG\000\000"
+    "Wurth Elektronik eiSos GmbH &\000"
+    "HQ Inc\000\000"
+    "Lab Sensor Solutions\000\000"
+    "Enterlab ApS\000\000"
+    "Eyefi, Inc.\000"
+    "MetaSystem S.p.A.\000"
+    "SONO ELECTRONICS. CO., LTD\000\000"
+    "Rotor Bike Components\000"
+    "Astro, Inc.\000"
+    "Amotus Solutions\000\000"
+    "Healthwear Technologies (Chan\000"
+    "Essex Electronics\000"
+    "Grundfos A/S\000\000"
+    "Eargo, Inc.\000"
+    "Electronic Design Lab\000"
+    "ESYLUX\000\000"
+    "NIPPON SMT.CO.,Ltd\000\000"
+    "BM innovations GmbH\000"
+    "indoormap\000"
+    "OttoQ Inc\000"
+    "North Pole Engineering\000\000"
+    "3flares Technologies Inc.\000"
+    "Mul-T-Lock\000\000"
+    "Airthings ASA\000"
+    "Enlighted Inc\000"
+    "GISTIC\000\000"
+    "AJP2 Holdings, LLC\000\000"
+    "COBI GmbH\000"
+    "Appception, Inc.\000\000"
+    "Courtney Thorne Limited\000"
+    "Virtuosys\000"
+    "TPV Technology Limited\000\000"
+    "Monitra SA\000\000"
+    "Automation Components, Inc.\000"
+    "Letsense s.r.l.\000"
+    "Etesian Technologies LLC\000\000"
+    "GERTEC BRASIL LTDA.\000"
+    "Drekker Development Pty. Ltd.\000"
+    "Whirl Inc\000"
+    "Locus Positioning\000"
+    "Acuity Brands Lighting, Inc\000"
+    "Prevent Biometrics\000\000"
+    "VersaMe\000"
+    "Libratone A/S\000"
+    "HM Electronics, Inc.\000\000"
+    "TASER International, Inc.\000"
+    "Heartland Payment Systems\000"
+    "Bitstrata Systems Inc.\000\000"
+    "Pieps GmbH\000\000"
+    "iRiding(Xiamen)Technology Co.\000"
+    "Alpha Audiotronics, Inc.\000\000"
+    "TOPPAN FORMS CO.,LTD.\000"
+    "Sigma Designs, Inc.\000"
+    "Spectrum Brands, Inc.\000"
+    "Polymap Wireless\000\000"
+    "MagniWare Ltd.\000\000"
+    "Novotec Medical GmbH\000\000"
+    "Phillips-Medisize A/S\000"
+    "Matrix Inc.\000"
+    "Eaton Corporation\000"
+    "KYS\000"
+    "Naya Health, Inc.\000"
+    "Acromag\000"
+    "Insulet Corporation\000"
+    "Wellinks Inc.\000"
+    "ON Semiconductor\000\000"
+    "FREELAP SA\000\000"
+    "Favero Electronics Srl\000\000"
+    "BioMech Sensor LLC\000\000"
+    "BOLTT Sports technologies Pri\000"
+    "Metormote AB\000\000"
+    "littleBits\000\000"
+    "SetPoint Medical\000\000"
+    "BRControls Products BV\000\000"
+    "Zipcar\000\000"
+    "AirBolt Pty Ltd\000"
+    "MOTIVE TECHNOLOGIES, INC.\000"
+    "Motiv, Inc.\000"
+    "Wazombi Labs O\303\234\000\000"
+    "Nixie Labs, Inc.\000\000"
+    "AppNearMe Ltd\000"
+    "Holman Industries\000"
+    "Expain AS\000"
+    "Electronic Temperature Instru\000"
+    "Plejd AB\000\000"
+    "Propeller Health\000\000"
+    "Shenzhen iMCO Electronic Tech\000"
+    "Algoria\000"
+    "Apption Labs Inc.\000"
+    "Cronologics Corporation\000"
+    "MICRODIA Ltd.\000"
+    "lulabytes S.L.\000\000"
+    "Soci\303\251t\303\251 des Produits Nestl\000\000"
+    "LLC \"MEGA-F service\000"
+    "Sharp Corporation\000"
+    "Precision Outcomes Ltd\000\000"
+    "Kronos Incorporated\000"
+    "Embedded Electronic Solutions\000"
+    "Aterica Inc.\000\000"
+    "BluStor PMC, Inc.\000"
+    "Kapsch TrafficCom AB\000\000"
+    "ActiveBlu Corporation\000"
+    "Kohler Mira Limited\000"
+    "Noke\000\000"
+    "Appion Inc.\000"
+    "Resmed Ltd\000\000"
+    "Crownstone B.V.\000"
+    "Xiaomi Inc.\000"
+    "INFOTECH s.r.o.\000"
+    "Thingsquare AB\000\000"
+    "T&D\000"
+    "LAVAZZA S.p.A.\000\000"
+    "SDATAWAY\000\000"
+    "BLOKS GmbH\000\000"
+    "LEGO System A/S\000"
+    "Thetatronics Ltd\000\000"
+    "Nikon Corporation\000"
+    "NeST\000\000"
+    "South Silicon Valley Microele\000"
+    "ALE International\000"
+    "CareView Communications, Inc.\000"
+    "SchoolBoard Limited\000"
+    "Molex Corporation\000"
+    "IVT Wireless Limited\000\000"
+    "Alpine Labs LLC\000"
+    "Candura Instruments\000"
+    "SmartMovt Technology Co., Ltd\000"
+    "Token Zero Ltd\000\000"
+    "ACE CAD Enterprise Co., Ltd.\000\000"
+    "Medela, Inc\000"
+    "AeroScout\000"
+    "Esrille Inc.\000\000"
+    "Exon Sp. z o.o.\000"
+    "Meizu Technology Co., Ltd.\000\000"
+    "XiQ\000"
+    "Allswell Inc.\000"
+    "Comm-N-Sense Corp DBA Verigo\000\000"
+    "VIBRADORM GmbH\000\000"
+    "Otodata Wireless Network Inc.\000"
+    "Propagation Systems Limited\000"
+    "Midwest Instruments & Control\000"
+    "Alpha Nodus, inc.\000"
+    "petPOMM, Inc\000\000"
+    "Mattel\000\000"
+    "Airbly Inc.\000"
+    "A-Safe Limited\000\000"
+    "FREDERIQUE CONSTANT SA\000\000"
+    "Maxscend Microelectronics Com\000"
+    "Abbott\000\000"
+    "ASB Bank Ltd\000\000"
+    "amadas\000\000"
+    "Applied Science, Inc.\000"
+    "iLumi Solutions Inc.\000\000"
+    "Arch Systems Inc.\000"
+    "Ember Technologies, Inc.\000\000"
+    "Snapchat Inc\000\000"
+    "Casambi Technologies Oy\000"
+    "Pico Technology Inc.\000\000"
+    "St. Jude Medical, Inc.\000\000"
+    "Intricon\000\000"
+    "Structural Health Systems, In\000"
+    "Avvel International\000"
+    "Gallagher Group\000"
+    "In2things Automation Pvt. Ltd\000"
+    "SYSDEV Srl\000\000"
+    "Vonkil Technologies Ltd\000"
+    "Wynd Technologies, Inc.\000"
+    "CONTRINEX S.A.\000\000"
+    "MIRA, Inc.\000\000"
+    "Watteam Ltd\000"
+    "Density Inc.\000\000"
+    "IOT Pot India Private Limited\000"
+    "Sigma Connectivity AB\000"
+    "PEG PEREGO SPA\000\000"
+    "Wyzelink Systems Inc.\000"
+    "Yota Devices LTD\000\000"
+    "FINSECUR\000\000"
+    "Zen-Me Labs Ltd\000"
+    "3IWare Co., Ltd.\000\000"
+    "EnOcean GmbH\000\000"
+    "Instabeat, Inc\000\000"
+    "Nima Labs\000"
+    "Andreas Stihl AG & Co. KG\000"
+    "Nathan Rhoades LLC\000\000"
+    "Grob Technologies, LLC\000\000"
+    "Actions Technology Co.,Ltd\000\000"
+    "SPD Development Company Ltd\000"
+    "Sensoan Oy\000\000"
+    "Qualcomm Life Inc\000"
+    "Chip-ing AG\000"
+    "ffly4u\000\000"
+    "IoT Instruments Oy\000\000"
+    "TRUE Fitness Technology\000"
+    "Reiner Kartengeraete GmbH & C\000"
+    "SHENZHEN LEMONJOY TECHNOLOGY\000\000"
+    "Hello Inc.\000\000"
+    "Ozo Edu, Inc.\000"
+    "Jigowatts Inc.\000\000"
+    "BASIC MICRO.COM,INC.\000\000"
+    "CUBE TECHNOLOGIES\000"
+    "foolography GmbH\000\000"
+    "CLINK\000"
+    "Hestan Smart Cooking Inc.\000"
+    "WindowMaster A/S\000\000"
+    "PAL Technologies Ltd\000\000"
+    "WHERE, Inc.\000"
+    "Iton Technology Corp.\000"
+    "Owl Labs Inc.\000"
+    "Rockford Corp.\000\000"
+    "Becon Technologies Co.,Ltd.\000"
+    "Vyassoft Technologies Inc\000"
+    "Nox Medical\000"
+    "Kimberly-Clark\000\000"
+    "Trimble Inc.\000\000"
+    "Littelfuse\000\000"
+    "Withings\000\000"
+    "i-developer IT Beratung UG\000\000"
+    "Relations Inc.\000\000"
+    "Sears Holdings Corporation\000\000"
+    "Gantner Electronic GmbH\000"
+    "Authomate Inc\000"
+    "Vertex International, Inc.\000\000"
+    "Swiss Audio SA\000\000"
+    "ToGetHome Inc.\000\000"
+    "RYSE INC.\000"
+    "ZF OPENMATICS s.r.o.\000\000"
+    "Jana Care Inc.\000\000"
+    "Senix Corporation\000"
+    "NorthStar Battery Company, LL\000"
+    "SKF (U.K.) Limited\000\000"
+    "CO-AX Technology, Inc.\000\000"
+    "Fender Musical Instruments\000\000"
+    "Luidia Inc\000\000"
+    "SEFAM\000"
+    "Wireless Cables Inc\000"
+    "SODA GmbH\000"
+    "Fatigue Science\000"
+    "Novalogy LTD\000\000"
+    "Friday Labs Limited\000"
+    "OrthoAccel Technologies\000"
+    "WaterGuru, Inc.\000"
+    "Benning Elektrotechnik und El\000"
+    "Dell Computer Corporation\000"
+    "Kopin Corporation\000"
+    "TecBakery GmbH\000\000"
+    "Backbone Labs, Inc.\000"
+    "DELSEY SA\000"
+    "Chargifi Limited\000\000"
+    "Trainesense Ltd.\000\000"
+    "Unify Software and Solutions\000\000"
+    "Husqvarna AB\000\000"
+    "Focus fleet and fuel manageme\000"
+    "SmallLoop, LLC\000\000"
+    "Prolon Inc.\000"
+    "BD Medical\000\000"
+    "iMicroMed Incorporated\000\000"
+    "Ticto N.V.\000\000"
+    "Meshtech AS\000"
+    "MemCachier Inc.\000"
+    "Danfoss A/S\000"
+    "SnapStyk Inc.\000"
+    "Alticor Inc.\000\000"
+    "Silk Labs, Inc.\000"
+    "Pillsy Inc.\000"
+    "Hatch Baby, Inc.\000\000"
+    "Blocks Wearables Ltd.\000"
+    "Drayson Technologies (Europe)\000"
+    "eBest IOT Inc.\000\000"
+    "Helvar Ltd\000\000"
+    "Radiance Technologies\000"
+    "Nuheara Limited\000"
+    "Appside co., ltd.\000"
+    "Coiler Corporation\000\000"
+    "Thermomedics, Inc.\000\000"
+    "Tentacle Sync GmbH\000\000"
+    "Valencell, Inc.\000"
+    "SECOM CO., LTD.\000"
+    "Tucker International LLC\000\000"
+    "Metanate Limited\000\000"
+    "Kobian Canada Inc.\000\000"
+    "NETGEAR, Inc.\000"
+    "Fabtronics Australia Pty Ltd\000\000"
+    "Grand Centrix GmbH\000\000"
+    "1UP USA.com llc\000"
+    "SHIMANO INC.\000\000"
+    "Nain Inc.\000"
+    "LifeStyle Lock, LLC\000"
+    "VEGA Grieshaber KG\000\000"
+    "Xtrava Inc.\000"
+    "TTS Tooltechnic Systems AG &\000\000"
+    "Teenage Engineering AB\000\000"
+    "Tunstall Nordic AB\000\000"
+    "Svep Design Center AB\000"
+    "Qorvo Utrecht B.V.\000\000"
+    "Sphinx Electronics GmbH & Co\000\000"
+    "Atomation\000"
+    "Nemik Consulting Inc\000\000"
+    "RF INNOVATION\000"
+    "Mini Solution Co., Ltd.\000"
+    "2048450 Ontario Inc\000"
+    "Delta T Corporation\000"
+    "Boston Scientific Corporation\000"
+    "Nuviz, Inc.\000"
+    "Real Time Automation, Inc.\000\000"
+    "Kolibree\000\000"
+    "vhf elektronik GmbH\000"
+    "Bonsai Systems GmbH\000"
+    "Fathom Systems Inc.\000"
+    "Bellman & Symfon Group AB\000"
+    "International Forte Group LLC\000"
+    "Codenex Oy\000\000"
+    "Kynesim Ltd\000"
+    "Palago AB\000"
+    "INSIGMA INC.\000\000"
+    "PMD Solutions\000"
+    "Qingdao Realtime Technology C\000"
+    "BEGA Gantenbrink-Leuchten KG\000\000"
+    "Pambor Ltd.\000"
+    "Develco Products A/S\000\000"
+    "iDesign s.r.l.\000\000"
+    "TiVo Corp\000"
+    "Control-J Pty Ltd\000"
+    "Steelcase, Inc.\000"
+    "iApartment co., ltd.\000\000"
+    "Icom inc.\000"
+    "Blue Spark Technologies\000"
+    "FarSite Communications Limite\000"
+    "mywerk system GmbH\000\000"
+    "Sinosun Technology Co., Ltd.\000\000"
+    "MIYOSHI ELECTRONICS CORPORATI\000"
+    "POWERMAT LTD\000\000"
+    "Occly LLC\000"
+    "OurHub Dev IvS\000\000"
+    "Pro-Mark, Inc.\000\000"
+    "Quintrax Limited\000\000"
+    "POS Tuning Udo Vosshenrich Gm\000"
+    "Revol Technologies Inc\000\000"
+    "SKIDATA AG\000\000"
+    "DEV TECNOLOGIA INDUSTRIA, COM\000"
+    "Centrica Connected Home\000"
+    "Automotive Data Solutions Inc\000"
+    "Igarashi Engineering\000\000"
+    "Taelek Oy\000"
+    "Vectronix AG\000\000"
+    "S-Labs Sp. z o.o.\000"
+    "Companion Medical, Inc.\000"
+    "BlueKitchen GmbH\000\000"
+    "Matting AB\000\000"
+    "SOREX - Wireless Solutions Gm\000"
+    "ADC Technology, Inc.\000\000"
+    "Lynxemi Pte Ltd\000"
+    "SENNHEISER electronic GmbH &\000\000"
+    "Polymorphic Labs LLC\000\000"
+    "Cochlear Limited\000\000"
+    "METER Group, Inc. USA\000"
+    "Ruuvi Innovations Ltd.\000\000"
+    "Situne AS\000"
+    "nVisti, LLC\000"
+    "DyOcean\000"
+    "Uhlmann & Zacher GmbH\000"
+    "AND!XOR LLC\000"
+    "Popper Pay AB\000"
+    "ovrEngineered, LLC\000\000"
+    "GT-tronics HK Ltd\000"
+    "Herbert Waldmann GmbH & Co. K\000"
+    "Guangzhou FiiO Electronics Te\000"
+    "Vinetech Co., Ltd\000"
+    "Dallas Logic Corporation\000\000"
+    "BioTex, Inc.\000\000"
+    "LINKIO SAS\000\000"
+    "Harbortronics, Inc.\000"
+    "Undagrid B.V.\000"
+    "Shure Inc\000"
+    "ERM Electronic Systems LTD\000\000"
+    "BIOROWER Handelsagentur GmbH\000\000"
+    "Kartographers Technologies Pv\000"
+    "The Shadow on the Moon\000\000"
+    "mobike (Hong Kong) Limited\000\000"
+    "Inuheat Group AB\000\000"
+    "Swiftronix AB\000"
+    "Diagnoptics Technologies\000\000"
+    "Analog Devices, Inc.\000\000"
+    "Soraa Inc.\000\000"
+    "CSR Building Products Limited\000"
+    "Crestron Electronics, Inc.\000\000"
+    "Neatebox Ltd\000\000"
+    "Draegerwerk AG & Co. KGaA\000"
+    "AlbynMedical\000\000"
+    "Averos FZCO\000"
+    "VIT Initiative, LLC\000"
+    "Statsports International\000\000"
+    "Sospitas, s.r.o.\000\000"
+    "Dmet Products Corp.\000"
+    "Mantracourt Electronics Limit\000"
+    "TeAM Hutchins AB\000\000"
+    "Seibert Williams Glass, LLC\000"
+    "Insta GmbH\000\000"
+    "Svantek Sp. z o.o.\000\000"
+    "Shanghai Flyco Electrical App\000"
+    "Thornwave Labs Inc\000\000"
+    "Steiner-Optik GmbH\000\000"
+    "Novo Nordisk A/S\000\000"
+    "Safetech Products LLC\000"
+    "GOOOLED S.R.L.\000\000"
+    "DOM Sicherheitstechnik GmbH &\000"
+    "Olympus Corporation\000"
+    "KTS GmbH\000\000"
+    "Anloq Technologies Inc.\000"
+    "Queercon, Inc\000"
+    "TASKA PROSTHETICS LIMITED\000"
+    "Gooee Limited\000"
+    "LUGLOC LLC\000\000"
+    "Blincam, Inc.\000"
+    "FUJIFILM Corporation\000\000"
+    "RM Acquisition LLC\000\000"
+    "Franceschi Marina snc\000"
+    "Engineered Audio, LLC.\000\000"
+    "IOTTIVE (OPC) PRIVATE LIMITED\000"
+    "4MOD Technology\000"
+    "Lutron Electronics Co., Inc.\000\000"
+    "Emerson Electric Co.\000\000"
+    "Guardtec, Inc.\000\000"
+    "REACTEC LIMITED\000"
+    "Under Armour\000\000"
+    "Woodenshark\000"
+    "Avack Oy\000\000"
+    "Smart Solution Technology, In\000"
+    "STABILO International\000"
+    "Busch Jaeger Elektro GmbH\000"
+    "Pacific Bioscience Laboratori\000"
+    "Bird Home Automation GmbH\000"
+    "Motorola Solutions\000\000"
+    "Auxivia\000"
+    "DaisyWorks, Inc\000"
+    "Kosi Limited\000\000"
+    "Theben AG\000"
+    "InDreamer Techsol Private Lim\000"
+    "Cerevast Medical\000\000"
+    "ZanCompute Inc.\000"
+    "Pirelli Tyre S.P.A.\000"
+    "McLear Limited\000\000"
+    "Shenzhen Goodix Technology Co\000"
+    "Convergence Systems Limited\000"
+    "Interactio\000\000"
+    "Androtec GmbH\000"
+    "Benchmark Drives GmbH & Co. K\000"
+    "SwingLync L. L. C.\000\000"
+    "Tapkey GmbH\000"
+    "Woosim Systems Inc.\000"
+    "Microsemi Corporation\000"
+    "Wiliot LTD.\000"
+    "Polaris IND\000"
+    "Specifi-Kali LLC\000\000"
+    "Locoroll, Inc\000"
+    "PHYPLUS Inc\000"
+    "InPlay, Inc.\000\000"
+    "Hager\000"
+    "Yellowcog\000"
+    "Axes System sp. z o. o.\000"
+    "Garage Smart, Inc.\000\000"
+    "Shake-on B.V.\000"
+    "Vibrissa Inc.\000"
+    "OSRAM GmbH\000\000"
+    "TRSystems GmbH\000\000"
+    "Yichip Microelectronics (Hang\000"
+    "Foundation Engineering LLC\000\000"
+    "UNI-ELECTRONICS, INC.\000"
+    "Brookfield Equinox LLC\000\000"
+    "Soprod SA\000"
+    "9974091 Canada Inc.\000"
+    "FIBRO GmbH\000\000"
+    "RB Controls Co., Ltd.\000"
+    "Footmarks\000"
+    "Amtronic Sverige AB\000"
+    "MAMORIO.inc\000"
+    "Tyto Life LLC\000"
+    "Leica Camera AG\000"
+    "EDPS\000\000"
+    "OFF Line Co., Ltd.\000\000"
+    "Detect Blue Limited\000"
+    "Setec Pty Ltd\000"
+    "Target Corporation\000\000"
+    "IAI Corporation\000"
+    "NS Tech, Inc.\000"
+    "MTG Co., Ltd.\000"
+    "Hangzhou iMagic Technology Co\000"
+    "HONGKONG NANO IC TECHNOLOGIES\000"
+    "Honeywell International Inc.\000\000"
+    "Albrecht JUNG\000"
+    "Lunera Lighting Inc.\000\000"
+    "Lumen UAB\000"
+    "Keynes Controls Ltd\000"
+    "Novartis AG\000"
+    "Geosatis SA\000"
+    "EXFO, Inc.\000\000"
+    "LEDVANCE GmbH\000"
+    "Center ID Corp.\000"
+    "Adolene, Inc.\000"
+    "D&M Holdings Inc.\000"
+    "CRESCO Wireless, Inc.\000"
+    "Nura Operations Pty Ltd\000"
+    "Frontiergadget, Inc.\000\000"
+    "Smart Component Technologies\000\000"
+    "ZTR Control Systems LLC\000"
+    "MetaLogics Corporation\000\000"
+    "Medela AG\000"
+    "OPPLE Lighting Co., Ltd\000"
+    "Savitech Corp.,\000"
+    "prodigy\000"
+    "Screenovate Technologies Ltd\000\000"
+    "TESA SA\000"
+    "CLIM8 LIMITED\000"
+    "Silergy Corp\000\000"
+    "SilverPlus, Inc\000"
+    "Sharknet srl\000\000"
+    "Mist Systems, Inc.\000\000"
+    "MIWA LOCK CO.,Ltd\000"
+    "OrthoSensor, Inc.\000"
+    "Apexar Technologies S.A.\000\000"
+    "LOGICDATA Electronic & Softwa\000"
+    "Knick Elektronische Messgerae\000"
+    "Smart Technologies and Invest\000"
+    "Linough Inc.\000\000"
+    "Advanced Electronic Designs,\000\000"
+    "Carefree Scott Fetzer Co Inc\000\000"
+    "Sensome\000"
+    "FORTRONIK storitve d.o.o.\000"
+    "Sinnoz\000\000"
+    "Sylero\000\000"
+    "Avempace SARL\000"
+    "Nintendo Co., Ltd.\000\000"
+    "National Instruments\000\000"
+    "KROHNE Messtechnik GmbH\000"
+    "Otodynamics Ltd\000"
+    "Arwin Technology Limited\000\000"
+    "benegear, inc.\000\000"
+    "Newcon Optik\000\000"
+    "CANDY HOUSE, Inc.\000"
+    "FRANKLIN TECHNOLOGY INC\000"
+    "Lely\000\000"
+    "Valve Corporation\000"
+    "Hekatron Vertriebs GmbH\000"
+    "PROTECH S.A.S. DI GIRARDI AND\000"
+    "Sarita CareTech APS\000"
+    "Finder S.p.A.\000"
+    "Thalmic Labs Inc.\000"
+    "Steinel Vertrieb GmbH\000"
+    "Beghelli Spa\000\000"
+    "CORE TRANSPORT TECHNOLOGIES N\000"
+    "Xiamen Everesports Goods Co.,\000"
+    "Bodyport Inc.\000"
+    "Flipnavi Co.,Ltd.\000"
+    "Rion Co., Ltd.\000\000"
+    "Long Range Systems, LLC\000"
+    "Redmond Industrial Group LLC\000\000"
+    "VIZPIN INC.\000"
+    "BikeFinder AS\000"
+    "Consumer Sleep Solutions LLC\000\000"
+    "PSIKICK, INC.\000"
+    "AntTail.com\000"
+    "Lighting Science Group Corp.\000\000"
+    "AFFORDABLE ELECTRONICS INC\000\000"
+    "Integral Memroy Plc\000"
+    "Globalstar, Inc.\000\000"
+    "True Wearables, Inc.\000\000"
+    "Wellington Drive Technologies\000"
+    "OMNI Remotes\000\000"
+    "Duracell U.S. Operations Inc.\000"
+    "Toor Technologies LLC\000"
+    "Instinct Performance\000\000"
+    "Beco, Inc\000"
+    "Scuf Gaming International, LL\000"
+    "LYS TECHNOLOGIES LTD\000\000"
+    "Breakwall Analytics, LLC\000\000"
+    "Code Blue Communications\000\000"
+    "Gira Giersiepen GmbH & Co. KG\000"
+    "Hearing Lab Technology\000\000"
+    "LEGRAND\000"
+    "Derichs GmbH\000\000"
+    "ALT-TEKNIK LLC\000\000"
+    "Star Technologies\000"
+    "START TODAY CO.,LTD.\000\000"
+    "Maxim Integrated Products\000"
+    "Fracarro Radioindustrie SRL\000"
+    "Jungheinrich Aktiengesellscha\000"
+    "Meta Platforms Technologies,\000\000"
+    "HENDON SEMICONDUCTORS PTY LTD\000"
+    "Pur3 Ltd\000\000"
+    "Viasat Group S.p.A.\000"
+    "IZITHERM\000\000"
+    "Spaulding Clinical Research\000"
+    "Kohler Company\000\000"
+    "Inor Process AB\000"
+    "My Smart Blinds\000"
+    "RadioPulse Inc\000\000"
+    "rapitag GmbH\000\000"
+    "Lazlo326, LLC.\000\000"
+    "Teledyne Lecroy, Inc.\000"
+    "Dataflow Systems Limited\000\000"
+    "Macrogiga Electronics\000"
+    "Tandem Diabetes Care\000\000"
+    "Polycom, Inc.\000"
+    "Fisher & Paykel Healthcare\000\000"
+    "Dream Devices Technologies Oy\000"
+    "Shanghai Xiaoyi Technology Co\000"
+    "ADHERIUM(NZ) LIMITED\000\000"
+    "Axiomware Systems Incorporate\000"
+    "O. E. M. Controls, Inc.\000"
+    "Kiiroo BV\000"
+    "Telecon Mobile Limited\000\000"
+    "Sonos Inc\000"
+    "Tom Allebrandi Consulting\000"
+    "Monidor\000"
+    "Tramex Limited\000\000"
+    "Nofence AS\000\000"
+    "GoerTek Dynaudio Co., Ltd.\000\000"
+    "INIA\000\000"
+    "CARMATE MFG.CO.,LTD\000"
+    "OV LOOP, INC.\000"
+    "NewTec GmbH\000"
+    "Medallion Instrumentation Sys\000"
+    "CAREL INDUSTRIES S.P.A.\000"
+    "Parabit Systems, Inc.\000"
+    "White Horse Scientific ltd\000\000"
+    "verisilicon\000"
+    "Elecs Industry Co.,Ltd.\000"
+    "Beijing Pinecone Electronics\000\000"
+    "Ambystoma Labs Inc.\000"
+    "Suzhou Pairlink Network Techn\000"
+    "igloohome\000"
+    "Oxford Metrics plc\000\000"
+    "Leviton Mfg. Co., Inc.\000\000"
+    "ULC Robotics Inc.\000"
+    "Real-World-Systems Corporatio\000"
+    "Nalu Medical, Inc.\000\000"
+    "P.I.Engineering\000"
+    "Grote Industries\000\000"
+    "Runtime, Inc.\000"
+    "Codecoup sp. z o.o. sp. k.\000\000"
+    "SELVE GmbH & Co. KG\000"
+    "Lippert Components, INC\000"
+    "SOMFY SAS\000"
+    "TBS Electronics B.V.\000\000"
+    "MHL Custom Inc\000\000"
+    "LucentWear LLC\000\000"
+    "WATTS ELECTRONICS\000"
+    "RJ Brands LLC\000"
+    "V-ZUG Ltd\000"
+    "Biowatch SA\000"
+    "Anova Applied Electronics\000"
+    "Lindab AB\000"
+    "frogblue TECHNOLOGY GmbH\000\000"
+    "Acurable Limited\000\000"
+    "LAMPLIGHT Co., Ltd.\000"
+    "TEGAM, Inc.\000"
+    "Zhuhai Jieli technology Co.,L\000"
+    "modum.io AG\000"
+    "Farm Jenny LLC\000\000"
+    "Toyo Electronics Corporation\000\000"
+    "Applied Neural Research Corp\000\000"
+    "Avid Identification Systems,\000\000"
+    "Petronics Inc.\000\000"
+    "essentim GmbH\000"
+    "QT Medical INC.\000"
+    "VIRTUALCLINIC.DIRECT LIMITED\000\000"
+    "Viper Design LLC\000\000"
+    "Human, Incorporated\000"
+    "stAPPtronics GmbH\000"
+    "Elemental Machines, Inc.\000\000"
+    "Taiyo Yuden Co., Ltd\000\000"
+    "INEO ENERGY& SYSTEMS\000\000"
+    "Motion Instruments Inc.\000"
+    "PressurePro\000"
+    "COWBOY\000\000"
+    "iconmobile GmbH\000"
+    "ACS-Control-System GmbH\000"
+    "Bayerische Motoren Werke AG\000"
+    "Gycom Svenska AB\000\000"
+    "Fuji Xerox Co., Ltd\000"
+    "SIKOM AS\000\000"
+    "beken\000"
+    "The Linux Foundation\000\000"
+    "Try and E CO.,LTD.\000\000"
+    "SeeScan\000"
+    "Clearity, LLC\000"
+    "GS TAG\000\000"
+    "DPTechnics\000\000"
+    "TRACMO, INC.\000\000"
+    "Anki Inc.\000"
+    "Hagleitner Hygiene Internatio\000"
+    "Konami Sports Life Co., Ltd.\000\000"
+    "Arblet Inc.\000"
+    "Masbando GmbH\000"
+    "Innoseis\000\000"
+    "Niko nv\000"
+    "Wellnomics Ltd\000\000"
+    "iRobot Corporation\000\000"
+    "Schrader Electronics\000\000"
+    "Geberit International AG\000\000"
+    "Fourth Evolution Inc\000\000"
+    "FMW electronic Futterer u. Ma\000"
+    "John Deere\000\000"
+    "Rookery Technology Ltd\000\000"
+    "KeySafe-Cloud\000"
+    "BUCHI Labortechnik AG\000"
+    "IQAir AG\000\000"
+    "Triax Technologies Inc\000\000"
+    "Vuzix Corporation\000"
+    "TDK Corporation\000"
+    "Blueair AB\000\000"
+    "Signify Netherlands B.V.\000\000"
+    "ADH GUARDIAN USA LLC\000\000"
+    "Beurer GmbH\000"
+    "Playfinity AS\000"
+    "Hans Dinslage GmbH\000\000"
+    "OnAsset Intelligence, Inc.\000\000"
+    "INTER ACTION Corporation\000\000"
+    "OS42 UG (haftungsbeschraenkt)\000"
+    "WIZCONNECTED COMPANY LIMITED\000\000"
+    "Audio-Technica Corporation\000\000"
+    "Six Guys Labs, s.r.o.\000"
+    "R.W. Beckett Corporation\000\000"
+    "silex technology, inc.\000\000"
+    "Univations Limited\000\000"
+    "SENS Innovation ApS\000"
+    "Diamond Kinetics, Inc.\000\000"
+    "Phrame Inc.\000"
+    "Forciot Oy\000\000"
+    "Noordung d.o.o.\000"
+    "Beam Labs, LLC\000\000"
+    "Biovotion AG\000\000"
+    "Square Panda, Inc.\000\000"
+    "Amplifico\000"
+    "WEG S.A.\000\000"
+    "Ensto Oy\000\000"
+    "PHONEPE PVT LTD\000"
+    "MinebeaMitsumi Inc.\000"
+    "ASPion GmbH\000"
+    "Vossloh-Schwabe Deutschland G\000"
+    "Procept\000"
+    "ONKYO Corporation\000"
+    "Asthrea D.O.O.\000\000"
+    "Fortiori Design LLC\000"
+    "Hugo Muller GmbH & Co KG\000\000"
+    "Wangi Lai PLT\000"
+    "Fanstel Corp\000\000"
+    "Crookwood\000"
+    "ELECTRONICA INTEGRAL DE SONID\000"
+    "GiP Innovation Tools GmbH\000"
+    "LX SOLUTIONS PTY LIMITED\000\000"
+    "Shenzhen Minew Technologies C\000"
+    "Prolojik Limited\000\000"
+    "Kromek Group Plc\000\000"
+    "Contec Medical Systems Co., L\000"
+    "Xradio Technology Co.,Ltd.\000\000"
+    "The Indoor Lab, LLC\000"
+    "LDL TECHNOLOGY\000\000"
+    "Dish Network LLC\000\000"
+    "Revenue Collection Systems FR\000"
+    "Bluetrum Technology Co.,Ltd\000"
+    "makita corporation\000\000"
+    "Apogee Instruments\000\000"
+    "BM3\000"
+    "SGV Group Holding GmbH & Co.\000\000"
+    "MED-EL\000\000"
+    "Ultune Technologies\000"
+    "Ryeex Technology Co.,Ltd.\000"
+    "Open Research Institute, Inc.\000"
+    "Scale-Tec, Ltd\000\000"
+    "Zumtobel Group AG\000"
+    "iLOQ Oy\000"
+    "KRUXWorks Technologies Privat\000"
+    "Digital Matter Pty Ltd\000\000"
+    "Coravin, Inc.\000"
+    "Stasis Labs, Inc.\000"
+    "ITZ Innovations- und Technolo\000"
+    "Meggitt SA\000\000"
+    "Ledlenser GmbH & Co. KG\000"
+    "Renishaw PLC\000\000"
+    "ZhuHai AdvanPro Technology Co\000"
+    "Meshtronix Limited\000\000"
+    "Payex Norge AS\000\000"
+    "UnSeen Technologies Oy\000\000"
+    "Marshall Group AB\000"
+    "Sesam Solutions BV\000\000"
+    "PixArt Imaging Inc.\000"
+    "Panduit Corp.\000"
+    "Alo AB\000\000"
+    "Ricoh Company Ltd\000"
+    "RTC Industries, Inc.\000\000"
+    "Mode Lighting Limited\000"
+    "Particle Industries, Inc.\000"
+    "Advanced Telemetry Systems, I\000"
+    "RHA TECHNOLOGIES LTD\000\000"
+    "Pure International Limited\000\000"
+    "WTO Werkzeug-Einrichtungen Gm\000"
+    "Spark Technology Labs Inc.\000\000"
+    "Bleb Technology srl\000"
+    "Livanova USA, Inc.\000\000"
+    "Brady Worldwide Inc.\000\000"
+    "DewertOkin GmbH\000"
+    "Ztove ApS\000"
+    "Venso EcoSolutions AB\000"
+    "Eurotronik Kranj d.o.o.\000"
+    "Hug Technology Ltd\000\000"
+    "Gema Switzerland GmbH\000"
+    "Buzz Products Ltd.\000\000"
+    "Kopi\000\000"
+    "Innova Ideas Limited\000\000"
+    "BeSpoon\000"
+    "Expai Solutions Private Limit\000"
+    "Innovation First, Inc.\000\000"
+    "SABIK Offshore GmbH\000"
+    "4iiii Innovations Inc.\000\000"
+    "The Energy Conservatory, Inc.\000"
+    "I.FARM, INC.\000\000"
+    "Tile, Inc.\000\000"
+    "Form Athletica Inc.\000"
+    "NETGRID S.N.C. DI BISSOLI MAT\000"
+    "Mannkind Corporation\000\000"
+    "Trade FIDES a.s.\000\000"
+    "Photron Limited\000"
+    "Eltako GmbH\000"
+    "Dermalapps, LLC\000"
+    "Greenwald Industries\000\000"
+    "inQs Co., Ltd.\000\000"
+    "Cherry GmbH\000"
+    "Amsted Digital Solutions Inc.\000"
+    "Tacx b.v.\000"
+    "Raytac Corporation\000\000"
+    "Jiangsu Teranovo Tech Co., Lt\000"
+    "Razer Inc.\000\000"
+    "JRM Group Limited\000"
+    "Eccrine Systems, Inc.\000"
+    "Curie Point AB\000\000"
+    "Georg Fischer AG\000\000"
+    "Hach - Danaher\000\000"
+    "T&A Laboratories LLC\000\000"
+    "Koki Holdings Co., Ltd.\000"
+    "Gunakar Private Limited\000"
+    "Stemco Products Inc\000"
+    "Wood IT Security, LLC\000"
+    "RandomLab SAS\000"
+    "Adero, Inc.\000"
+    "Dragonchip Limited\000\000"
+    "Noomi AB\000\000"
+    "Delta Electronics, Inc.\000"
+    "FlowMotion Technologies AS\000\000"
+    "OBIQ Location Technology Inc.\000"
+    "Cardo Systems, Ltd\000\000"
+    "Globalworx GmbH\000"
+    "Nymbus, LLC\000"
+    "LIMNO Co. Ltd.\000\000"
+    "TEKZITEL PTY LTD\000\000"
+    "Roambee Corporation\000"
+    "Chipsea Technologies (ShenZhe\000"
+    "GD Midea Air-Conditioning Equ\000"
+    "Soundmax Electronics Limited\000\000"
+    "Produal Oy\000\000"
+    "HMS Industrial Networks AB\000\000"
+    "Ingchips Technology Co., Ltd.\000"
+    "InnovaSea Systems Inc.\000\000"
+    "SenseQ Inc.\000"
+    "Shoof Technologies\000\000"
+    "BRK Brands, Inc.\000\000"
+    "SimpliSafe, Inc.\000\000"
+    "Tussock Innovation 2013 Limit\000"
+    "Sencilion Oy\000\000"
+    "Wabilogic Ltd.\000\000"
+    "Sociometric Solutions, Inc.\000"
+    "iCOGNIZE GmbH\000"
+    "ShadeCraft, Inc\000"
+    "Beflex Inc.\000"
+    "Beaconzone Ltd\000\000"
+    "Leaftronix Analogic Solutions\000"
+    "TWS Srl\000"
+    "ABB Oy\000\000"
+    "HitSeed Oy\000\000"
+    "CAME S.p.A.\000"
+    "Alarm.com Holdings, Inc\000"
+    "Measurlogic Inc.\000\000"
+    "King I Electronics.Co.,Ltd\000\000"
+    "Dream Labs GmbH\000"
+    "Urban Compass, Inc\000\000"
+    "Simm Tronic Limited\000"
+    "Somatix Inc\000"
+    "Storz & Bickel GmbH & Co. KG\000\000"
+    "MYLAPS B.V.\000"
+    "Shenzhen Zhongguang Infotech\000\000"
+    "Dyeware, LLC\000\000"
+    "Dongguan SmartAction Technolo\000"
+    "DIG Corporation\000"
+    "FIOR & GENTZ\000\000"
+    "Etekcity Corporation\000\000"
+    "Meyer Sound Laboratories, Inc\000"
+    "CeoTronics AG\000"
+    "DYNAKODE TECHNOLOGY PRIVATE L\000"
+    "Sensirion AG\000\000"
+    "JCT Healthcare Pty Ltd\000\000"
+    "FUBA Automotive Electronics G\000"
+    "AW Company\000\000"
+    "Shanghai Mountain View Silico\000"
+    "Zliide Technologies ApS\000"
+    "Automatic Labs, Inc.\000\000"
+    "Industrial Network Controls,\000\000"
+    "Intellithings Ltd.\000\000"
+    "Navcast, Inc.\000"
+    "HLI Solutions Inc.\000\000"
+    "Avaya Inc.\000\000"
+    "Milestone AV Technologies LLC\000"
+    "Alango Technologies Ltd\000"
+    "Spinlock Ltd\000\000"
+    "Aluna\000"
+    "OPTEX CO.,LTD.\000\000"
+    "NIHON DENGYO KOUSAKU\000\000"
+    "VELUX A/S\000"
+    "Almendo Technologies GmbH\000"
+    "Zmartfun Electronics, Inc.\000\000"
+    "SafeLine Sweden AB\000\000"
+    "Houston Radar LLC\000"
+    "Sigur\000"
+    "J Neades Ltd\000\000"
+    "ALCARE Co., Ltd.\000\000"
+    "Chargy Technologies, SL\000"
+    "Shibutani Co., Ltd.\000"
+    "Trapper Data AB\000"
+    "Alfred International Inc.\000"
+    "Touch\303\251 Technology Ltd\000\000"
+    "Vigil Technologies Inc.\000"
+    "Vitulo Plus BV\000\000"
+    "WILKA Schliesstechnik GmbH\000\000"
+    "BodyPlus Technology Co.,Ltd\000"
+    "happybrush GmbH\000"
+    "Enequi AB\000"
+    "Sartorius AG\000\000"
+    "Tom Communication Industrial\000\000"
+    "ESS Embedded System Solutions\000"
+    "Mahr GmbH\000"
+    "Redpine Signals Inc\000"
+    "TraqFreq LLC\000\000"
+    "PAFERS TECH\000"
+    "Akciju sabiedriba \"SAF TEHNIK\000"
+    "Beijing Jingdong Century Trad\000"
+    "JBX Designs Inc.\000\000"
+    "AB Electrolux\000"
+    "Wernher von Braun Center for\000\000"
+    "Essity Hygiene and Health Akt\000"
+    "Be Interactive Co., Ltd\000"
+    "Carewear Corp.\000\000"
+    "Huf H\303\274lsbeck & F\303\274rst GmbH &\000"
+    "Element Products, Inc.\000\000"
+    "Beijing Winner Microelectroni\000"
+    "SmartSnugg Pty Ltd\000\000"
+    "FiveCo Sarl\000"
+    "California Things Inc.\000\000"
+    "Audiodo AB\000\000"
+    "ABAX AS\000"
+    "Bull Group Company Limited\000\000"
+    "Respiri Limited\000"
+    "MindPeace Safety LLC\000\000"
+    "MBARC LABS Inc\000\000"
+    "Altonics\000\000"
+    "IDIBAIX enginneering\000\000"
+    "COREIOT PTY LTD\000"
+    "REVSMART WEARABLE HK CO LTD\000"
+    "Precor\000\000"
+    "F5 Sports, Inc\000\000"
+    "exoTIC Systems\000\000"
+    "DONGGUAN HELE ELECTRONICS CO.\000"
+    "Dongguan Liesheng Electronic\000\000"
+    "Oculeve, Inc.\000"
+    "Clover Network, Inc.\000\000"
+    "Xiamen Eholder Electronics Co\000"
+    "Ford Motor Company\000\000"
+    "Guangzhou SuperSound Informat\000"
+    "Tedee Sp. z o.o.\000\000"
+    "PHC Corporation\000"
+    "Eli Lilly and Company\000"
+    "SwaraLink Technologies\000\000"
+    "JMR embedded systems GmbH\000"
+    "Bitkey Inc.\000"
+    "GWA Hygiene GmbH\000\000"
+    "Safera Oy\000"
+    "Open Platform Systems LLC\000"
+    "OnePlus Electronics (Shenzhen\000"
+    "Wildlife Acoustics, Inc.\000\000"
+    "ABLIC Inc.\000\000"
+    "Dairy Tech, LLC\000"
+    "Iguanavation, Inc.\000\000"
+    "DiUS Computing Pty Ltd\000\000"
+    "UpRight Technologies LTD\000\000"
+    "Luna XIO, Inc.\000\000"
+    "LLC Navitek\000"
+    "Glass Security Pte Ltd\000\000"
+    "Jiangsu Qinheng Co., Ltd.\000"
+    "Chandler Systems Inc.\000"
+    "Fantini Cosmi s.p.a.\000\000"
+    "Beijing Hao Heng Tian Tech Co\000"
+    "Bluepack S.R.L.\000"
+    "Beijing Unisoc Technologies C\000"
+    "MAC SRL\000"
+    "DML LLC\000"
+    "Sanofi\000\000"
+    "SOCOMEC\000"
+    "WIZNOVA, Inc.\000"
+    "Seitec Elektronik GmbH\000\000"
+    "OR Technologies Pty Ltd\000"
+    "GuangZhou KuGou Computer Tech\000"
+    "DIAODIAO (Beijing) Technology\000"
+    "Illusory Studios LLC\000\000"
+    "Sarvavid Software Solutions L\000"
+    "Amtech Systems, LLC\000"
+    "EAGLE DETECTION SA\000\000"
+    "MEDIATECH S.R.L.\000\000"
+    "Hamilton Professional Service\000"
+    "Changsha JEMO IC Design Co.,L\000"
+    "Elatec GmbH\000"
+    "JLG Industries, Inc.\000\000"
+    "Michael Parkin\000\000"
+    "Brother Industries, Ltd\000"
+    "Lumens For Less, Inc\000\000"
+    "ELA Innovation\000\000"
+    "umanSense AB\000\000"
+    "Shanghai InGeek Cyber Securit\000"
+    "HARMAN CO.,LTD.\000"
+    "Smart Sensor Devices AB\000"
+    "Antitronics Inc.\000\000"
+    "RHOMBUS SYSTEMS, INC.\000"
+    "Katerra Inc.\000\000"
+    "Remote Solution Co., LTD.\000"
+    "Vimar SpA\000"
+    "Mantis Tech LLC\000"
+    "TerOpta Ltd\000"
+    "PIKOLIN S.L.\000\000"
+    "WWZN Information Technology C\000"
+    "Voxx International\000\000"
+    "ART AND PROGRAM, INC.\000"
+    "NITTO DENKO ASIA TECHNICAL CE\000"
+    "Peloton Interactive Inc.\000\000"
+    "Force Impact Technologies\000"
+    "Dmac Mobile Developments, LLC\000"
+    "Engineered Medical Technologi\000"
+    "Noodle Technology inc\000"
+    "Graesslin GmbH\000\000"
+    "WuQi technologies, Inc.\000"
+    "Successful Endeavours Pty Ltd\000"
+    "InnoCon Medical ApS\000"
+    "Corvex Connected Safety\000"
+    "Thirdwayv Inc.\000\000"
+    "Echoflex Solutions Inc.\000"
+    "C-MAX Asia Limited\000\000"
+    "4eBusiness GmbH\000"
+    "Cyber Transport Control GmbH\000\000"
+    "Cue\000"
+    "KOAMTAC INC.\000\000"
+    "Loopshore Oy\000\000"
+    "Niruha Systems Private Limite\000"
+    "radius co., ltd.\000\000"
+    "Sensority, s.r.o.\000"
+    "Sparkage Inc.\000"
+    "Glenview Software Corporation\000"
+    "Finch Technologies Ltd.\000"
+    "Qingping Technology (Beijing)\000"
+    "DeviceDrive AS\000\000"
+    "ESEMBER LIMITED LIABILITY COM\000"
+    "audifon GmbH & Co. KG\000"
+    "O2 Micro, Inc.\000\000"
+    "HLP Controls Pty Limited\000\000"
+    "BubblyNet, LLC\000\000"
+    "PCB Piezotronics, Inc.\000\000"
+    "The Wildflower Foundation\000"
+    "Optikam Tech Inc.\000"
+    "MINIBREW HOLDING B.V\000\000"
+    "Cybex GmbH\000\000"
+    "FUJIMIC NIIGATA, INC.\000"
+    "Hanna Instruments, Inc.\000"
+    "KOMPAN A/S\000\000"
+    "Scosche Industries, Inc.\000\000"
+    "Cricut, Inc.\000\000"
+    "AEV spol. s r.o.\000\000"
+    "The Coca-Cola Company\000"
+    "GASTEC CORPORATION\000\000"
+    "StarLeaf Ltd\000\000"
+    "Water-i.d. GmbH\000"
+    "HoloKit, Inc.\000"
+    "PlantChoir Inc.\000"
+    "GuangDong Oppo Mobile Telecom\000"
+    "CST ELECTRONICS (PROPRIETARY)\000"
+    "Sky UK Limited\000\000"
+    "Digibale Pty Ltd\000\000"
+    "Smartloxx GmbH\000\000"
+    "Pune Scientific LLP\000"
+    "Regent Beleuchtungskorper AG\000\000"
+    "Apollo Neuroscience, Inc.\000"
+    "Roku, Inc.\000\000"
+    "Xiamen Mage Information Techn\000"
+    "RAB Lighting, Inc.\000\000"
+    "Musen Connect, Inc.\000"
+    "Zume, Inc.\000\000"
+    "conbee GmbH\000"
+    "Bruel & Kjaer Sound & Vibrati\000"
+    "The Kroger Co.\000\000"
+    "Granite River Solutions, Inc.\000"
+    "LoupeDeck Oy\000\000"
+    "New H3C Technologies Co.,Ltd\000\000"
+    "Aurea Solucoes Tecnologicas L\000"
+    "Hong Kong Bouffalo Lab Limite\000"
+    "GV Concepts Inc.\000\000"
+    "Thomas Dynamics, LLC\000\000"
+    "Moeco IOT Inc.\000\000"
+    "2N TELEKOMUNIKACE a.s.\000\000"
+    "Hormann KG Antriebstechnik\000\000"
+    "CRONO CHIP, S.L.\000\000"
+    "Soundbrenner Limited\000\000"
+    "ETABLISSEMENTS GEORGES RENAUL\000"
+    "iSwip\000"
+    "Epona Biotec Limited\000\000"
+    "Battery-Biz Inc.\000\000"
+    "EPIC S.R.L.\000"
+    "KD CIRCUITS LLC\000"
+    "Genedrive Diagnostics Ltd\000"
+    "Axentia Technologies AB\000"
+    "REGULA Ltd.\000"
+    "Biral AG\000\000"
+    "Radinn AB\000"
+    "CIMTechniques, Inc.\000"
+    "Johnson Health Tech NA\000\000"
+    "June Life, Inc.\000"
+    "Bluenetics GmbH\000"
+    "iaconicDesign Inc.\000\000"
+    "WRLDS Creations AB\000\000"
+    "Skullcandy, Inc.\000\000"
+    "Modul-System HH AB\000\000"
+    "West Pharmaceutical Services,\000"
+    "Barnacle Systems Inc.\000"
+    "Smart Wave Technologies Canad\000"
+    "Shanghai Top-Chip Microelectr\000"
+    "NeoSensory, Inc.\000\000"
+    "Hangzhou Tuya Information  Te\000"
+    "Shanghai Panchip Microelectro\000"
+    "React Accessibility Limited\000"
+    "LIVNEX Co.,Ltd.\000"
+    "Kano Computing Limited\000\000"
+    "hoots classic GmbH\000\000"
+    "ecobee Inc.\000"
+    "Nanjing Qinheng Microelectron\000"
+    "SOLUTIONS AMBRA INC.\000\000"
+    "Micro-Design, Inc.\000\000"
+    "STARLITE Co., Ltd.\000\000"
+    "Remedee Labs\000\000"
+    "ThingOS GmbH & Co KG\000\000"
+    "Linear Circuits\000"
+    "Unlimited Engineering SL\000\000"
+    "Snap-on Incorporated\000\000"
+    "Edifier International Limited\000"
+    "Lucie Labs\000\000"
+    "Alfred Kaercher SE & Co. KG\000"
+    "Geeksme S.L.\000\000"
+    "Minut, Inc.\000"
+    "Waybeyond Limited\000"
+    "Komfort IQ, Inc.\000\000"
+    "Packetcraft, Inc.\000"
+    "H\303\244fele GmbH & Co KG\000\000"
+    "ShapeLog, Inc.\000\000"
+    "NOVABASE S.R.L.\000"
+    "Frecce LLC\000\000"
+    "Joule IQ, INC.\000\000"
+    "KidzTek LLC\000"
+    "Aktiebolaget Sandvik Coromant\000"
+    "e-moola.com Pty Ltd\000"
+    "Zimi Innovations Pty Ltd\000\000"
+    "SERENE GROUP, INC\000"
+    "DIGISINE ENERGYTECH CO. LTD.\000\000"
+    "MEDIRLAB Orvosbiologiai Fejle\000"
+    "Byton North America Corporati\000"
+    "Shenzhen TonliScience and Tec\000"
+    "Cesar Systems Ltd.\000\000"
+    "quip NYC Inc.\000"
+    "Direct Communication Solution\000"
+    "Klipsch Group, Inc.\000"
+    "Access Co., Ltd\000"
+    "Renault SA\000\000"
+    "JSK CO., LTD.\000"
+    "BIROTA\000\000"
+    "maxon motor ltd.\000\000"
+    "Optek\000"
+    "CRONUS ELECTRONICS LTD\000\000"
+    "NantSound, Inc.\000"
+    "Domintell s.a.\000\000"
+    "Andon Health Co.,Ltd\000\000"
+    "Urbanminded Ltd\000"
+    "TYRI Sweden AB\000\000"
+    "ECD Electronic Components Gmb\000"
+    "SISTEMAS KERN, SOCIEDAD AN\303\223M\000"
+    "Trulli Audio\000\000"
+    "Altaneos\000\000"
+    "Nanoleaf Canada Limited\000"
+    "Ingy B.V.\000"
+    "Azbil Co.\000"
+    "TATTCOM LLC\000"
+    "Paradox Engineering SA\000\000"
+    "LECO Corporation\000\000"
+    "Becker Antriebe GmbH\000\000"
+    "Mstream Technologies., Inc.\000"
+    "Flextronics International USA\000"
+    "Ossur hf.\000"
+    "SKC Inc\000"
+    "SPICA SYSTEMS LLC\000"
+    "Wangs Alliance Corporation\000\000"
+    "tatwah SA\000"
+    "Hunter Douglas Inc\000\000"
+    "Shenzhen Conex\000\000"
+    "DIM3\000\000"
+    "Bobrick Washroom Equipment, I\000"
+    "Potrykus Holdings and Develop\000"
+    "iNFORM Technology GmbH\000\000"
+    "eSenseLab LTD\000"
+    "Brilliant Home Technology, In\000"
+    "INOVA Geophysical, Inc.\000"
+    "adafruit industries\000"
+    "Nexite Ltd\000\000"
+    "8Power Limited\000\000"
+    "CME PTE. LTD.\000"
+    "Hyundai Motor Company\000"
+    "Kickmaker\000"
+    "Shanghai Suisheng Information\000"
+    "HEXAGON METROLOGY DIVISION RO\000"
+    "Mitutoyo Corporation\000\000"
+    "shenzhen fitcare electronics\000\000"
+    "INGICS TECHNOLOGY CO., LTD.\000"
+    "INCUS PERFORMANCE LTD.\000\000"
+    "ABB S.p.A.\000\000"
+    "Blippit AB\000\000"
+    "Foxble, LLC\000"
+    "Intermotive,Inc.\000\000"
+    "Conneqtech B.V.\000"
+    "RIKEN KEIKI CO., LTD.,\000\000"
+    "Canopy Growth Corporation\000"
+    "Bitwards Oy\000"
+    "vivo Mobile Communication Co.\000"
+    "Etymotic Research, Inc.\000"
+    "A puissance 3\000"
+    "BPW Bergische Achsen Kommandi\000"
+    "Piaggio Fast Forward\000\000"
+    "BeerTech LTD\000\000"
+    "Tokenize, Inc.\000\000"
+    "Zorachka LTD\000\000"
+    "D-Link Corp.\000\000"
+    "Down Range Systems LLC\000\000"
+    "General Luminaire (Shanghai)\000\000"
+    "Tangshan HongJia electronic t\000"
+    "FRAGRANCE DELIVERY TECHNOLOGI\000"
+    "Pepperl + Fuchs GmbH\000\000"
+    "Dometic Corporation\000"
+    "USound GmbH\000"
+    "DNANUDGE LIMITED\000\000"
+    "JUJU JOINTS CANADA CORP.\000\000"
+    "Dopple Technologies B.V.\000\000"
+    "ARCOM\000"
+    "Biotechware SRL\000"
+    "ORSO Inc.\000"
+    "SafePort\000\000"
+    "Carol Cole Company\000\000"
+    "Embedded Fitness B.V.\000"
+    "Yealink (Xiamen) Network Tech\000"
+    "Subeca, Inc.\000\000"
+    "Cognosos, Inc.\000\000"
+    "Pektron Group Limited\000"
+    "Tap Sound System\000\000"
+    "Helios Sports, Inc.\000"
+    "Parsyl Inc\000\000"
+    "SOUNDBOKS\000"
+    "BlueUp\000\000"
+    "DAKATECH\000\000"
+    "Nisshinbo Micro Devices Inc.\000\000"
+    "ACOS CO.,LTD.\000"
+    "Guilin Zhishen Information Te\000"
+    "Krog Systems LLC\000\000"
+    "Alflex Products B.V.\000\000"
+    "SmartSensor Labs Ltd\000\000"
+    "SmartDrive\000\000"
+    "Yo-tronics Technology Co., Lt\000"
+    "Rafaelmicro\000"
+    "Emergency Lighting Products L\000"
+    "LAONZ Co.,Ltd\000"
+    "Western Digital Techologies,\000\000"
+    "WIOsense GmbH & Co. KG\000\000"
+    "EVVA Sicherheitstechnologie G\000"
+    "Odic Incorporated\000"
+    "Pacific Track, LLC\000\000"
+    "Revvo Technologies, Inc.\000\000"
+    "Biometrika d.o.o.\000"
+    "Vorwerk Elektrowerke GmbH & C\000"
+    "Trackunit A/S\000"
+    "Wyze Labs, Inc\000\000"
+    "Dension Elektronikai Kft.\000"
+    "11 Health & Technologies Limi\000"
+    "Innophase Incorporated\000\000"
+    "Treegreen Limited\000"
+    "Berner International LLC\000\000"
+    "SmartResQ ApS\000"
+    "Valtech\000"
+    "The Chamberlain Group, Inc.\000"
+    "MIZUNO Corporation\000\000"
+    "ZRF, LLC\000\000"
+    "BYSTAMP\000"
+    "Crosscan GmbH\000"
+    "Konftel AB\000\000"
+    "1bar.net Limited\000\000"
+    "Phillips Connect Technologies\000"
+    "imagiLabs AB\000\000"
+    "Optalert\000\000"
+    "PSYONIC, Inc.\000"
+    "Wintersteiger AG\000\000"
+    "Controlid Industria, Comercio\000"
+    "Movella Technologies B.V.\000"
+    "Hydro-Gear Limited Partnershi\000"
+    "EnPointe Fencing Pty Ltd\000\000"
+    "XANTHIO\000"
+    "sclak s.r.l.\000\000"
+    "Tricorder Arraay Technologies\000"
+    "GB Solution co.,Ltd\000"
+    "Soliton Systems K.K.\000\000"
+    "Tait International Limited\000\000"
+    "NICHIEI INTEC CO., LTD.\000"
+    "SmartWireless GmbH & Co. KG\000"
+    "Ingenieurbuero Birnfeld UG (h\000"
+    "Maytronics Ltd\000\000"
+    "EPIFIT\000\000"
+    "Gimer medical\000"
+    "Nokian Renkaat Oyj\000\000"
+    "Current Lighting Solutions LL\000"
+    "Sensibo, Inc.\000"
+    "SFS unimarket AG\000\000"
+    "Private limited company \"Telt\000"
+    "Saucon Technologies\000"
+    "Embedded Devices Co. Company\000\000"
+    "J-J.A.D.E. Enterprise LLC\000"
+    "i-SENS, inc.\000\000"
+    "Witschi Electronic Ltd\000\000"
+    "Aclara Technologies LLC\000"
+    "EXEO TECH CORPORATION\000"
+    "Epic Systems Co., Ltd.\000\000"
+    "Hoffmann SE\000"
+    "Realme Chongqing Mobile Telec\000"
+    "Intelligenceworks Inc.\000\000"
+    "TGR 1.618 Limited\000"
+    "Shanghai Kfcube Inc\000"
+    "Fraunhofer IIS\000\000"
+    "SZ DJI TECHNOLOGY CO.,LTD\000"
+    "Coburn Technology, LLC\000\000"
+    "Topre Corporation\000"
+    "Kayamatics Limited\000\000"
+    "Moticon ReGo AG\000"
+    "Polidea Sp. z o.o.\000\000"
+    "Trivedi Advanced Technologies\000"
+    "CORE|vision BV\000\000"
+    "PF SCHWEISSTECHNOLOGIE GMBH\000"
+    "IONIQ Skincare GmbH & Co. KG\000\000"
+    "Sengled Co., Ltd.\000"
+    "TransferFi\000\000"
+    "Boehringer Ingelheim Vetmedic\000"
+    "ABB Inc\000"
+    "Check Technology Solutions LL\000"
+    "U-Shin Ltd.\000"
+    "HYPER ICE, INC.\000"
+    "Tokai-rika co.,ltd.\000"
+    "Prevayl Limited\000"
+    "bf1systems limited\000\000"
+    "ubisys technologies GmbH\000\000"
+    "SIRC Co., Ltd.\000\000"
+    "Accent Advanced Systems SLU\000"
+    "Rayden.Earth LTD\000\000"
+    "Lindinvent AB\000"
+    "CHIPOLO d.o.o.\000\000"
+    "J. Wagner GmbH\000\000"
+    "Integra Optics Inc\000\000"
+    "Monadnock Systems Ltd.\000\000"
+    "Liteboxer Technologies Inc.\000"
+    "Noventa AG\000\000"
+    "Nubia Technology Co.,Ltd.\000"
+    "JT INNOVATIONS LIMITED\000\000"
+    "TGM TECHNOLOGY CO., LTD.\000\000"
+    "ifly\000\000"
+    "ZIMI CORPORATION\000\000"
+    "betternotstealmybike UG (with\000"
+    "ESTOM Infotech Kft.\000"
+    "Sensovium Inc.\000\000"
+    "Virscient Limited\000"
+    "Novel Bits, LLC\000"
+    "ADATA Technology Co., LTD.\000\000"
+    "KEYes\000"
+    "Inovonics Corp\000\000"
+    "WARES\000"
+    "Pointr Labs Limited\000"
+    "Miridia Technology Incorporat\000"
+    "Tertium Technology\000\000"
+    "SHENZHEN AUKEY E BUSINESS CO.\000"
+    "code-Q\000\000"
+    "TE Connectivity Corporation\000"
+    "IRIS OHYAMA CO.,LTD.\000\000"
+    "Philia Technology\000"
+    "KOZO KEIKAKU ENGINEERING Inc.\000"
+    "Shenzhen Simo Technology co.\000\000"
+    "Republic Wireless, Inc.\000"
+    "Rashidov ltd\000\000"
+    "Crowd Connected Ltd\000"
+    "Eneso Tecnologia de Adaptacio\000"
+    "Barrot Technology Co.,Ltd.\000\000"
+    "Naonext\000"
+    "Taiwan Intelligent Home Corp.\000"
+    "COWBELL ENGINEERING CO.,LTD.\000\000"
+    "Beijing Big Moment Technology\000"
+    "Denso Corporation\000"
+    "IMI Hydronic Engineering Inte\000"
+    "Askey Computer Corp.\000\000"
+    "Cumulus Digital Systems, Inc\000\000"
+    "Joovv, Inc.\000"
+    "The L.S. Starrett Company\000"
+    "Microoled\000"
+    "PSP - Pauli Services & Produc\000"
+    "Kodimo Technologies Company L\000"
+    "Tymtix Technologies Private L\000"
+    "Dermal Photonics Corporation\000\000"
+    "MTD Products Inc & Affiliates\000"
+    "instagrid GmbH\000\000"
+    "Spacelabs Medical Inc.\000\000"
+    "Troo Corporation\000\000"
+    "Darkglass Electronics Oy\000\000"
+    "Hill-Rom\000\000"
+    "BioIntelliSense, Inc.\000"
+    "Ketronixs Sdn Bhd\000"
+    "Plastimold Products, Inc\000\000"
+    "Beijing Zizai Technology Co.,\000"
+    "Lucimed\000"
+    "TSC Auto-ID Technology Co., L\000"
+    "DATAMARS, Inc.\000\000"
+    "SUNCORPORATION\000\000"
+    "Yandex Services AG\000\000"
+    "Scope Logistical Solutions\000\000"
+    "User Hello, LLC\000"
+    "Pinpoint Innovations Limited\000\000"
+    "70mai Co.,Ltd.\000\000"
+    "Zhuhai Hoksi Technology CO.,L\000"
+    "EMBR labs, INC\000\000"
+    "Radiawave Technologies Co.,Lt\000"
+    "IOT Invent GmbH\000"
+    "OPTIMUSIOT TECH LLP\000"
+    "VC Inc.\000"
+    "ASR Microelectronics (Shangha\000"
+    "Douglas Lighting Controls Inc\000"
+    "Nerbio Medical Software Platf\000"
+    "Braveheart Wireless, Inc.\000"
+    "INEO-SENSE\000\000"
+    "Honda Motor Co., Ltd.\000"
+    "Ambient Sensors LLC\000"
+    "ASR Microelectronics(ShenZhen\000"
+    "Technosphere Labs Pvt. Ltd.\000"
+    "NO SMD LIMITED\000\000"
+    "Albertronic BV\000\000"
+    "Luminostics, Inc.\000"
+    "Oblamatik AG\000\000"
+    "Innokind, Inc.\000\000"
+    "Melbot Studios, Sociedad Limi\000"
+    "Myzee Technology\000\000"
+    "KAHA PTE. LTD.\000\000"
+    "Shanghai MXCHIP Information T\000"
+    "JSB TECH PTE LTD\000\000"
+    "Fundacion Tecnalia Research a\000"
+    "Yukai Engineering Inc.\000\000"
+    "Gooligum Technologies Pty Ltd\000"
+    "ROOQ GmbH\000"
+    "AiRISTA\000"
+    "Qingdao Haier Technology Co.,\000"
+    "Sappl Verwaltungs- und Betrie\000"
+    "TekHome\000"
+    "PCI Private Limited\000"
+    "Leggett & Platt, Incorporated\000"
+    "PS GmbH\000"
+    "C.O.B.O. SpA\000\000"
+    "James Walker RotaBolt Limited\000"
+    "BREATHINGS Co., Ltd.\000\000"
+    "BarVision, LLC\000\000"
+    "SRAM\000\000"
+    "KiteSpring Inc.\000"
+    "Reconnect, Inc.\000"
+    "Elekon AG\000"
+    "RealThingks GmbH\000\000"
+    "Henway Technologies, LTD.\000"
+    "ASTEM Co.,Ltd.\000\000"
+    "LinkedSemi Microelectronics (\000"
+    "ENSESO LLC\000\000"
+    "Xenoma Inc.\000"
+    "Adolf Wuerth GmbH & Co KG\000"
+    "Catalyft Labs, Inc.\000"
+    "JEPICO Corporation\000\000"
+    "Hero Workout GmbH\000"
+    "Rivian Automotive, LLC\000\000"
+    "TRANSSION HOLDINGS LIMITED\000\000"
+    "Agitron d.o.o.\000\000"
+    "Globe (Jiangsu) Co., Ltd\000\000"
+    "AMC International Alfa Metalc\000"
+    "First Light Technologies Ltd.\000"
+    "Wearable Link Limited\000"
+    "Metronom Health Europe\000\000"
+    "Zwift, Inc.\000"
+    "Kindeva Drug Delivery L.P.\000\000"
+    "GimmiSys GmbH\000"
+    "tkLABS INC.\000"
+    "PassiveBolt, Inc.\000"
+    "Limited Liability Company \"Mi\000"
+    "Capetech\000\000"
+    "PPRS\000\000"
+    "Apptricity Corporation\000\000"
+    "LogiLube, LLC\000"
+    "Julbo\000"
+    "Breville Group\000\000"
+    "Kerlink\000"
+    "Ohsung Electronics\000\000"
+    "ZTE Corporation\000"
+    "HerdDogg, Inc\000"
+    "Lismore Instruments Limited\000"
+    "Electronic Theatre Controls\000"
+    "BioEchoNet inc.\000"
+    "NUANCE HEARING LTD\000\000"
+    "Sena Technologies Inc.\000\000"
+    "Linkura AB\000\000"
+    "GL Solutions K.K.\000"
+    "Moonbird BV\000"
+    "Countrymate Technology Limite\000"
+    "Asahi Kasei Corporation\000"
+    "PointGuard, LLC\000"
+    "Neo Materials and Consulting\000\000"
+    "Actev Motors, Inc.\000\000"
+    "Woan Technology (Shenzhen) Co\000"
+    "dricos, Inc.\000\000"
+    "Guide ID B.V.\000"
+    "9374-7319 Quebec inc\000\000"
+    "Gunwerks, LLC\000"
+    "Band Industries, inc.\000"
+    "Lund Motion Products, Inc.\000\000"
+    "IBA Dosimetry GmbH\000\000"
+    "GA\000\000"
+    "Closed Joint Stock Company \"Z\000"
+    "Popit Oy\000\000"
+    "ABEYE\000"
+    "BlueIOT(Beijing) Technology C\000"
+    "Fauna Audio GmbH\000\000"
+    "TOYOTA motor corporation\000\000"
+    "ZifferEins GmbH & Co. KG\000\000"
+    "BIOTRONIK SE & Co. KG\000"
+    "CORE CORPORATION\000\000"
+    "CTEK Sweden AB\000\000"
+    "Thorley Industries, LLC\000"
+    "CLB B.V.\000\000"
+    "SonicSensory Inc\000\000"
+    "ISEMAR S.R.L.\000"
+    "DEKRA TESTING AND CERTIFICATI\000"
+    "Bernard Krone Holding SE & Co\000"
+    "ELPRO-BUCHS AG\000\000"
+    "Feedback Sports LLC\000"
+    "TeraTron GmbH\000"
+    "Lumos Health Inc.\000"
+    "Cello Hill, LLC\000"
+    "TSE BRAKES, INC.\000\000"
+    "BHM-Tech Produktionsgesellsch\000"
+    "WIKA Alexander Wiegand SE & C\000"
+    "Biovigil\000\000"
+    "Mequonic Engineering, S.L.\000\000"
+    "bGrid B.V.\000\000"
+    "ADVEEZ\000\000"
+    "Aktiebolaget Regin\000\000"
+    "Anton Paar GmbH\000"
+    "Telenor ASA\000"
+    "Big Kaiser Precision Tooling\000\000"
+    "Absolute Audio Labs B.V.\000\000"
+    "VT42 Pty Ltd\000\000"
+    "Bronkhorst High-Tech B.V.\000"
+    "C. & E. Fein GmbH\000"
+    "NextMind\000\000"
+    "Pixie Dust Technologies, Inc.\000"
+    "eTactica ehf\000\000"
+    "New Audio LLC\000"
+    "Sendum Wireless Corporation\000"
+    "deister electronic GmbH\000"
+    "YKK AP Inc.\000"
+    "Step One Limited\000\000"
+    "Koya Medical, Inc.\000\000"
+    "Proof Diagnostics, Inc.\000"
+    "VOS Systems, LLC\000\000"
+    "ENGAGENOW DATA SCIENCES PRIVA\000"
+    "ARDUINO SA\000\000"
+    "KUMHO ELECTRICS, INC\000\000"
+    "Security Enhancement Systems,\000"
+    "BEIJING ELECTRIC VEHICLE CO.,\000"
+    "Paybuddy ApS\000\000"
+    "KHN Solutions LLC\000"
+    "Nippon Ceramic Co.,Ltd.\000"
+    "PHOTODYNAMIC INCORPORATED\000"
+    "DashLogic, Inc.\000"
+    "Ambiq\000"
+    "Narhwall Inc.\000"
+    "Pozyx NV\000\000"
+    "ifLink Open Community\000"
+    "Deublin Company, LLC\000\000"
+    "BLINQY\000\000"
+    "DYPHI\000"
+    "BlueX Microelectronics Corp L\000"
+    "PentaLock Aps.\000\000"
+    "AUTEC Gesellschaft fuer Autom\000"
+    "Pegasus Technologies, Inc.\000\000"
+    "Bout Labs, LLC\000\000"
+    "PlayerData Limited\000\000"
+    "SAVOY ELECTRONIC LIGHTING\000"
+    "Elimo Engineering Ltd\000"
+    "SkyStream Corporation\000"
+    "Aerosens LLC\000\000"
+    "Centre Suisse d'Electronique\000\000"
+    "Vessel Ltd.\000"
+    "Span.IO, Inc.\000"
+    "AnotherBrain inc.\000"
+    "Rosewill\000\000"
+    "Universal Audio, Inc.\000"
+    "JAPAN TOBACCO INC.\000\000"
+    "UVISIO\000\000"
+    "HungYi Microelectronics Co.,L\000"
+    "Honor Device Co., Ltd.\000\000"
+    "Combustion, LLC\000"
+    "XUNTONG\000"
+    "CrowdGlow Ltd\000"
+    "Mobitrace\000"
+    "Hx Engineering, LLC\000"
+    "Senso4s d.o.o.\000\000"
+    "Julius Blum GmbH\000\000"
+    "BlueStreak IoT, LLC\000"
+    "Chess Wise B.V.\000"
+    "ABLEPAY TECHNOLOGIES AS\000"
+    "Temperature Sensitive Solutio\000"
+    "ORBIS Inc.\000\000"
+    "GEAR RADIO ELECTRONICS CORP.\000\000"
+    "EAR TEKNIK ISITME VE ODIOMETR\000"
+    "Coyotta\000"
+    "Synergy Tecnologia em Sistema\000"
+    "VivoSensMedical GmbH\000\000"
+    "Nagravision SA\000\000"
+    "Bionic Avionics Inc.\000\000"
+    "AON2 Ltd.\000"
+    "Innoware Development AB\000"
+    "JLD Technology Solutions, LLC\000"
+    "Magnus Technology Sdn Bhd\000"
+    "Tag-N-Trac Inc\000\000"
+    "Wuhan Linptech Co.,Ltd.\000"
+    "Friday Home Aps\000"
+    "CPS AS\000\000"
+    "Mobilogix\000"
+    "Masonite Corporation\000\000"
+    "Kabushikigaisha HANERON\000"
+    "Melange Systems Pvt. Ltd.\000"
+    "LumenRadio AB\000"
+    "Athlos Oy\000"
+    "KEAN ELECTRONICS PTY LTD\000\000"
+    "Yukon advanced optics worldwi\000"
+    "Sibel Inc.\000\000"
+    "OJMAR SA\000\000"
+    "Steinel Solutions AG\000\000"
+    "WatchGas B.V.\000"
+    "OM Digital Solutions Corporat\000"
+    "Audeara Pty Ltd\000"
+    "Beijing Zero Zero Infinity Te\000"
+    "Spectrum Technologies, Inc.\000"
+    "OKI Electric Industry Co., Lt\000"
+    "Mobile Action Technology Inc.\000"
+    "SENSATEC Co., Ltd.\000\000"
+    "R.O. S.R.L.\000"
+    "Hangzhou Yaguan Technology Co\000"
+    "Listen Technologies Corporati\000"
+    "TOITU CO., LTD.\000"
+    "Confidex\000\000"
+    "Keep Technologies, Inc.\000"
+    "Lichtvision Engineering GmbH\000\000"
+    "AIRSTAR\000"
+    "Ampler Bikes OU\000"
+    "Cleveron AS\000"
+    "Ayxon-Dynamics GmbH\000"
+    "donutrobotics Co., Ltd.\000"
+    "Flosonics Medical\000"
+    "Southwire Company, LLC\000\000"
+    "Shanghai wuqi microelectronic\000"
+    "Reflow Pty Ltd\000\000"
+    "Oras Oy\000"
+    "Volan Technology Inc.\000"
+    "SIANA Systems\000"
+    "Shanghai Yidian Intelligent T\000"
+    "Blue Peacock GmbH\000"
+    "Roland Corporation\000\000"
+    "LIXIL Corporation\000"
+    "SUBARU Corporation\000\000"
+    "Sensolus\000\000"
+    "Dyson Technology Limited\000\000"
+    "Tec4med LifeScience GmbH\000\000"
+    "CROXEL, INC.\000\000"
+    "Syng Inc\000\000"
+    "RIDE VISION LTD\000"
+    "Plume Design Inc\000\000"
+    "Cambridge Animal Technologies\000"
+    "Maxell, Ltd.\000\000"
+    "Link Labs, Inc.\000"
+    "Embrava Pty Ltd\000"
+    "INPEAK S.C.\000"
+    "API-K\000"
+    "CombiQ AB\000"
+    "DeVilbiss Healthcare LLC\000\000"
+    "Jiangxi Innotech Technology C\000"
+    "Apollogic Sp. z o.o.\000\000"
+    "DAIICHIKOSHO CO., LTD.\000\000"
+    "BIXOLON CO.,LTD\000"
+    "Atmosic Technologies, Inc.\000\000"
+    "Eran Financial Services LLC\000"
+    "Louis Vuitton\000"
+    "AYU DEVICES PRIVATE LIMITED\000"
+    "NanoFlex Power Corporation\000\000"
+    "Worthcloud Technology Co.,Ltd\000"
+    "Yamaha Corporation\000\000"
+    "PaceBait IVS\000\000"
+    "Shenzhen H&T Intelligent Cont\000"
+    "Shenzhen Feasycom Technology\000\000"
+    "Instamic, Inc.\000\000"
+    "Air-Weigh\000"
+    "Nevro Corp.\000"
+    "Pinnacle Technology, Inc.\000"
+    "WMF AG\000\000"
+    "Luxer Corporation\000"
+    "safectory GmbH\000\000"
+    "NGK SPARK PLUG CO., LTD.\000\000"
+    "2587702 Ontario Inc.\000\000"
+    "Bouffalo Lab (Nanjing)., Ltd.\000"
+    "BLUETICKETING SRL\000"
+    "Incotex Co. Ltd.\000\000"
+    "Galileo Technology Limited\000\000"
+    "Siteco GmbH\000"
+    "DELABIE\000"
+    "Shenzhen Yopeak Optoelectroni\000"
+    "OPEX Corporation\000\000"
+    "Motionalysis, Inc.\000\000"
+    "Busch Systems International I\000"
+    "Novidan, Inc.\000"
+    "3SI Security Systems, Inc\000"
+    "Beijing HC-Infinite Technolog\000"
+    "The Wand Company Ltd\000\000"
+    "JRC Mobility Inc.\000"
+    "Venture Research Inc.\000"
+    "Map Large, Inc.\000"
+    "MistyWest Energy and Transpor\000"
+    "SiFli Technologies (shanghai)\000"
+    "Lockn Technologies Private Li\000"
+    "Toytec Corporation\000\000"
+    "VANMOOF Global Holding B.V.\000"
+    "Nextscape Inc.\000\000"
+    "CSIRO\000"
+    "Follow Sense Europe B.V.\000\000"
+    "KKM COMPANY LIMITED\000"
+    "SQL Technologies Corp.\000\000"
+    "Inugo Systems Limited\000"
+    "ambie\000"
+    "Meizhou Guo Wei Electronics C\000"
+    "Indigo Diabetes\000"
+    "TourBuilt, LLC\000\000"
+    "Sontheim Industrie Elektronik\000"
+    "LEGIC Identsystems AG\000"
+    "Innovative Design Labs Inc.\000"
+    "MG Energy Systems B.V.\000\000"
+    "stryker\000"
+    "DATANG SEMICONDUCTOR TECHNOLO\000"
+    "Smart Parks B.V.\000\000"
+    "MOKO TECHNOLOGY Ltd\000"
+    "Geopal system A/S\000"
+    "Lytx, INC.\000\000"
+    "Beijing SuperHexa Century Tec\000"
+    "Focus Ingenieria SRL\000\000"
+    "HAPPIEST BABY, INC.\000"
+    "Scribble Design Inc.\000\000"
+    "Olympic Ophthalmics, Inc.\000"
+    "Pokkels\000"
+    "KUUKANJYOKIN Co.,Ltd.\000"
+    "Pac Sane Limited\000\000"
+    "Warner Bros.\000\000"
+    "Ooma\000\000"
+    "Senquip Pty Ltd\000"
+    "Jumo GmbH & Co. KG\000\000"
+    "Innohome Oy\000"
+    "MICROSON S.A.\000"
+    "Delta Cycle Corporation\000"
+    "Synaptics Incorporated\000\000"
+    "AXTRO PTE. LTD.\000"
+    "Shenzhen Sunricher Technology\000"
+    "Webasto SE\000\000"
+    "Emlid Limited\000"
+    "UniqAir Oy\000\000"
+    "WAFERLOCK\000"
+    "Freedman Electronics Pty Ltd\000\000"
+    "KEBA Handover Automation GmbH\000"
+    "Intuity Medical\000"
+    "Cleer Limited\000"
+    "Universal Biosensors Pty Ltd\000\000"
+    "Corsair\000"
+    "Rivata, Inc.\000\000"
+    "Greennote Inc,\000\000"
+    "Snowball Technology Co., Ltd.\000"
+    "ALIZENT International\000"
+    "Shanghai Smart System Technol\000"
+    "PSA Peugeot Citroen\000"
+    "VusionGroup\000"
+    "HAINBUCH GMBH SPANNENDE TECHN\000"
+    "SANlight GmbH\000"
+    "DelpSys, s.r.o.\000"
+    "JCM TECHNOLOGIES S.A.\000"
+    "Perfect Company\000"
+    "TOTO LTD.\000"
+    "Shenzhen Grandsun Electronic\000\000"
+    "Monarch International Inc.\000\000"
+    "Carestream Dental LLC\000"
+    "GiPStech S.r.l.\000"
+    "OOBIK Inc.\000\000"
+    "Pamex Inc.\000\000"
+    "SensTek\000"
+    "Foil, Inc.\000\000"
+    "Shanghai high-flying electron\000"
+    "TEMKIN ASSOCIATES, LLC\000\000"
+    "Eello LLC\000"
+    "Xi'an Fengyu Information Tech\000"
+    "Canon Finetech Nisca Inc.\000"
+    "ista International GmbH\000"
+    "Loy Tec electronics GmbH\000\000"
+    "LINCOGN TECHNOLOGY CO. LIMITE\000"
+    "Care Bloom, LLC\000"
+    "DIC Corporation\000"
+    "FAZEPRO LLC\000"
+    "Shenzhen Uascent Technology C\000"
+    "Realityworks, inc.\000\000"
+    "Urbanista AB\000\000"
+    "Zencontrol Pty Ltd\000\000"
+    "Spintly, Inc.\000"
+    "Computime International Ltd\000"
+    "Anhui Listenai Co\000"
+    "OSM HK Limited\000\000"
+    "Adevo Consulting AB\000"
+    "PS Engineering, Inc.\000\000"
+    "AIAIAI ApS\000\000"
+    "Visiontronic s.r.o.\000"
+    "InVue Security Products Inc\000"
+    "TouchTronics, Inc.\000\000"
+    "INNER RANGE PTY. LTD.\000"
+    "Ellenby Technologies, Inc.\000\000"
+    "Elstat Electronics Ltd.\000"
+    "Xenter, Inc.\000\000"
+    "LogTag North America Inc.\000"
+    "Sens.ai Incorporated\000\000"
+    "STL\000"
+    "Open Bionics Ltd.\000"
+    "R-DAS, s.r.o.\000"
+    "KCCS Mobile Engineering Co.,\000\000"
+    "Inventas AS\000"
+    "Robkoo Information & Technolo\000"
+    "PAUL HARTMANN AG\000\000"
+    "Omni-ID USA, INC.\000"
+    "Shenzhen Jingxun Technology C\000"
+    "RealMega Microelectronics tec\000"
+    "Kenzen, Inc.\000\000"
+    "CODIUM\000\000"
+    "Flexoptix GmbH\000\000"
+    "Barnes Group Inc.\000"
+    "Chengdu Aich Technology Co.,L\000"
+    "Keepin Co., Ltd.\000\000"
+    "Swedlock AB\000"
+    "Shenzhen CoolKit Technology C\000"
+    "ise Individuelle Software und\000"
+    "Nuvoton\000"
+    "Visuallex Sport International\000"
+    "KOBATA GAUGE MFG. CO., LTD.\000"
+    "CACI Technologies\000"
+    "Nordic Strong ApS\000"
+    "EAGLE KINGDOM TECHNOLOGIES LI\000"
+    "Lautsprecher Teufel GmbH\000\000"
+    "SSV Software Systems GmbH\000"
+    "Zhuhai Pantum Electronisc Co.\000"
+    "Streamit B.V.\000"
+    "nymea GmbH\000\000"
+    "AL-KO Geraete GmbH\000\000"
+    "Franz Kaldewei GmbH&Co KG\000"
+    "Shenzhen Aimore. Co.,Ltd\000\000"
+    "Codefabrik GmbH\000"
+    "Reelables, Inc.\000"
+    "Duravit AG\000\000"
+    "Boss Audio\000\000"
+    "Vocera Communications, Inc.\000"
+    "Douglas Dynamics L.L.C.\000"
+    "GlobalMed\000"
+    "DALI Alliance\000"
+    "unu GmbH\000\000"
+    "Hexology\000\000"
+    "Sunplus Technology Co., Ltd.\000\000"
+    "LEVEL, s.r.o.\000"
+    "FLIR Systems AB\000"
+    "Borda Technology\000\000"
+    "Square, Inc.\000\000"
+    "FUTEK ADVANCED SENSOR TECHNOL\000"
+    "Saxonar GmbH\000\000"
+    "Velentium, LLC\000\000"
+    "GLP German Light Products Gmb\000"
+    "Leupold & Stevens, Inc.\000"
+    "CRADERS,CO.,LTD\000"
+    "Shanghai All Link Microelectr\000"
+    "701x Inc.\000"
+    "Radioworks Microelectronics P\000"
+    "Unitech Electronic Inc.\000"
+    "AMETEK, Inc.\000\000"
+    "Irdeto\000\000"
+    "First Design System Inc.\000\000"
+    "Unisto AG\000"
+    "Chengdu Ambit Technology Co.,\000"
+    "SMT ELEKTRONIK GmbH\000"
+    "Cerebrum Sensor Technologies\000\000"
+    "Weber Sensors, LLC\000\000"
+    "Earda Technologies Co.,Ltd\000\000"
+    "FUSEAWARE LIMITED\000"
+    "Flaircomm Microelectronics In\000"
+    "RESIDEO TECHNOLOGIES, INC.\000\000"
+    "IORA Technology Development L\000"
+    "Precision Triathlon Systems L\000"
+    "Marquardt GmbH\000\000"
+    "FAZUA GmbH\000\000"
+    "Workaround Gmbh\000"
+    "Shenzhen Qianfenyi Intelligen\000"
+    "soonisys\000\000"
+    "Belun Technology Company Limi\000"
+    "Sanistaal A/S\000"
+    "BluPeak\000"
+    "SANYO DENKO Co.,Ltd.\000\000"
+    "Minebea Access Solutions Inc.\000"
+    "B.E.A. S.A.\000"
+    "Alfa Laval Corporate AB\000"
+    "ThermoWorks, Inc.\000"
+    "ToughBuilt Industries LLC\000"
+    "IOTOOLS\000"
+    "Olumee\000\000"
+    "NAOS JAPAN K.K.\000"
+    "Guard RFID Solutions Inc.\000"
+    "SIG SAUER, INC.\000"
+    "DECATHLON SE\000\000"
+    "WBS PROJECT H PTY LTD\000"
+    "Roca Sanitario, S.A.\000\000"
+    "Enerpac Tool Group Corp.\000\000"
+    "Nanoleq AG\000\000"
+    "Accelerated Systems\000"
+    "PB INC.\000"
+    "Beijing ESWIN Computing Techn\000"
+    "TKH Security B.V.\000"
+    "Hygiene IQ, LLC.\000\000"
+    "iRhythm Technologies, Inc.\000\000"
+    "BeiJing ZiJie TiaoDong KeJi C\000"
+    "NIBROTECH LTD\000"
+    "Baracoda Daily Healthtech.\000\000"
+    "Lumi United Technology Co., L\000"
+    "CHACON\000\000"
+    "Tech-Venom Entertainment Priv\000"
+    "MAINBOT\000"
+    "ILLUMAGEAR, Inc.\000\000"
+    "REDARC ELECTRONICS PTY LTD\000\000"
+    "MOCA System Inc.\000\000"
+    "Duke Manufacturing Co\000"
+    "ART SPA\000"
+    "Silver Wolf Vehicles Inc.\000"
+    "Hala Systems, Inc.\000\000"
+    "ARMATURA LLC\000\000"
+    "CONZUMEX INDUSTRIES PRIVATE L\000"
+    "BH SENS\000"
+    "SINTEF\000\000"
+    "Omnivoltaic Energy Solutions\000\000"
+    "WISYCOM S.R.L.\000\000"
+    "Red 100 Lighting Co., ltd.\000\000"
+    "Impact Biosystems, Inc.\000"
+    "AIC semiconductor (Shanghai)\000\000"
+    "Dodge Industrial, Inc.\000\000"
+    "REALTIMEID AS\000"
+    "ISEO Serrature S.p.a.\000"
+    "MindRhythm, Inc.\000\000"
+    "Havells India Limited\000"
+    "Sentrax GmbH\000\000"
+    "TSI\000"
+    "INCITAT ENVIRONNEMENT\000"
+    "nFore Technology Co., Ltd.\000\000"
+    "Electronic Sensors, Inc.\000\000"
+    "Gentex Corporation\000\000"
+    "NIO USA, Inc.\000"
+    "SkyHawke Technologies\000"
+    "Nomono AS\000"
+    "EMS Integrators, LLC\000\000"
+    "BiosBob.Biz\000"
+    "Adam Hall GmbH\000\000"
+    "ICP Systems B.V.\000\000"
+    "Breezi.io, Inc.\000"
+    "Mesh Systems LLC\000\000"
+    "FUN FACTORY GmbH\000\000"
+    "ZIIP Inc\000\000"
+    "SHENZHEN KAADAS INTELLIGENT T\000"
+    "Emotion Fitness GmbH & Co. KG\000"
+    "H G M Automotive Electronics,\000"
+    "BORA - Vertriebs GmbH & Co KG\000"
+    "CONVERTRONIX TECHNOLOGIES AND\000"
+    "TOKAI-DENSHI INC\000\000"
+    "Shenzhen ImagineVision Techno\000"
+    "Fujian Newland Auto-ID Tech.\000\000"
+    "CELLCONTROL, INC.\000"
+    "Rivieh, Inc.\000\000"
+    "RATOC Systems, Inc.\000"
+    "Sentek Pty Ltd\000\000"
+    "NOVEA ENERGIES\000\000"
+    "Innolux Corporation\000"
+    "NingBo klite Electric Manufac\000"
+    "The Apache Software Foundatio\000"
+    "MITSUBISHI ELECTRIC AUTOMATIO\000"
+    "CleanSpace Technology Pty Ltd\000"
+    "Quha oy\000"
+    "Addaday\000"
+    "Dymo\000\000"
+    "Samsara Networks, Inc\000"
+    "Sensitech, Inc.\000"
+    "SOLUM CO., LTD\000\000"
+    "React Mobile\000\000"
+    "JDRF Electromag Engineering I\000"
+    "lilbit ODM AS\000"
+    "Geeknet, Inc.\000"
+    "HARADA INDUSTRY CO., LTD.\000"
+    "BQN\000"
+    "Triple W Japan Inc.\000"
+    "MAX-co., ltd\000\000"
+    "Aixlink(Chengdu) Co., Ltd.\000\000"
+    "FIELD DESIGN INC.\000"
+    "Sankyo Air Tech Co.,Ltd.\000\000"
+    "Shenzhen KTC Technology Co.,L\000"
+    "Hardcoder Oy\000\000"
+    "Scangrip A/S\000\000"
+    "FoundersLane GmbH\000"
+    "Offcode Oy\000\000"
+    "ICU tech GmbH\000"
+    "AXELIFE\000"
+    "SCM Group\000"
+    "Mammut Sports Group AG\000\000"
+    "Taiga Motors Inc.\000"
+    "Presidio Medical, Inc.\000\000"
+    "VIMANA TECH PTY LTD\000"
+    "Trek Bicycle\000\000"
+    "Ampetronic Ltd\000\000"
+    "Muguang (Guangdong) Intellige\000"
+    "Rotronic AG\000"
+    "Seiko Instruments Inc.\000\000"
+    "American Technology Component\000"
+    "MOTREX\000\000"
+    "Pertech Industries Inc\000\000"
+    "Gentle Energy Corp.\000"
+    "Senscomm Semiconductor Co., L\000"
+    "Ineos Automotive Limited\000\000"
+    "Alfen ICU B.V.\000\000"
+    "Citisend Solutions, SL\000\000"
+    "Hangzhou BroadLink Technology\000"
+    "Dreem SAS\000"
+    "Telecom Design\000\000"
+    "SILVER TREE LABS, INC.\000\000"
+    "Gymstory B.V.\000"
+    "The Goodyear Tire & Rubber Co\000"
+    "Beijing Wisepool Infinite Int\000"
+    "Komatsu Ltd.\000\000"
+    "Sensoria Holdings LTD\000"
+    "Audio Partnership Plc\000"
+    "Group Lotus Limited\000"
+    "Data Sciences International\000"
+    "Bunn-O-Matic Corporation\000\000"
+    "TireCheck GmbH\000\000"
+    "Sonova Consumer Hearing GmbH\000\000"
+    "Vervent Audio Group\000"
+    "SONICOS ENTERPRISES, LLC\000\000"
+    "Nissan Motor Co., Ltd.\000\000"
+    "hearX Group (Pty) Ltd\000"
+    "GLOWFORGE INC.\000\000"
+    "Allterco Robotics ltd\000"
+    "Infinitegra, Inc.\000"
+    "Grandex International Corpora\000"
+    "Machfu Inc.\000"
+    "Roambotics, Inc.\000\000"
+    "Soma Labs LLC\000"
+    "NITTO KOGYO CORPORATION\000"
+    "Ecolab Inc.\000"
+    "Beijing ranxin intelligence t\000"
+    "Fjorden Electra AS\000\000"
+    "Flender GmbH\000\000"
+    "New Cosmos USA, Inc.\000\000"
+    "Xirgo Technologies, LLC\000"
+    "Build With Robots Inc.\000\000"
+    "IONA Tech LLC\000"
+    "INNOVAG PTY. LTD.\000"
+    "SaluStim Group Oy\000"
+    "Huso, INC\000"
+    "SWISSINNO SOLUTIONS AG\000\000"
+    "T2REALITY SOLUTIONS PRIVATE L\000"
+    "SAAB Aktiebolag\000"
+    "HIMSA II K/S\000\000"
+    "READY FOR SKY LLP\000"
+    "Miele & Cie. KG\000"
+    "EntWick Co.\000"
+    "MCOT INC.\000"
+    "TECHTICS ENGINEERING B.V.\000"
+    "Aperia Technologies, Inc.\000"
+    "TCL COMMUNICATION EQUIPMENT C\000"
+    "Signtle Inc.\000\000"
+    "OTF Distribution, LLC\000"
+    "Neuvatek Inc.\000"
+    "Perimeter Technologies, Inc.\000\000"
+    "Divesoft s.r.o.\000"
+    "Sylvac sa\000"
+    "Amiko srl\000"
+    "Neurosity, Inc.\000"
+    "LL Tec Group LLC\000\000"
+    "Durag GmbH\000\000"
+    "Hubei Yuan Times Technology C\000"
+    "IDEC\000\000"
+    "Procon Analytics, LLC\000"
+    "ndd Medizintechnik AG\000"
+    "Super B Lithium Power B.V.\000\000"
+    "Shenzhen Injoinic Technology\000\000"
+    "VINFAST TRADING AND PRODUCTIO\000"
+    "PURA SCENTS, INC.\000"
+    "Aardex Ltd.\000"
+    "CHAR-BROIL, LLC\000"
+    "Ledworks S.r.l.\000"
+    "Coroflo Limited\000"
+    "Yale\000\000"
+    "WINKEY ENTERPRISE (HONG KONG)\000"
+    "Koizumi Lighting Technology c\000"
+    "OTC engineering\000"
+    "Comtel Systems Ltd.\000"
+    "Deepfield Connect GmbH\000\000"
+    "ZWILLING J.A. Henckels Aktien\000"
+    "Puratap Pty Ltd\000"
+    "Fresnel Technologies, Inc.\000\000"
+    "Sensormate AG\000"
+    "Shindengen Electric Manufactu\000"
+    "Twenty Five Seven, prodaja in\000"
+    "Luna Health, Inc.\000"
+    "Miracle-Ear, Inc.\000"
+    "CORAL-TAIYI Co. Ltd.\000\000"
+    "LINKSYS USA, INC.\000"
+    "Safetytest GmbH\000"
+    "KIDO SPORTS CO., LTD.\000"
+    "Site IQ LLC\000"
+    "Angel Medical Systems, Inc.\000"
+    "PONE BIOMETRICS AS\000\000"
+    "T5 tek, Inc.\000\000"
+    "greenTEG AG\000"
+    "Wacker Neuson SE\000\000"
+    "Innovacionnye Resheniya\000"
+    "CleanBands Systems Ltd.\000"
+    "Dodam Enersys Co., Ltd\000\000"
+    "T+A elektroakustik GmbH & Co.\000"
+    "Esm\303\251 Solutions\000"
+    "Media-Cartec GmbH\000"
+    "Ratio Electric BV\000"
+    "MQA Limited\000"
+    "NEOWRK SISTEMAS INTELIGENTES\000\000"
+    "Loomanet, Inc.\000\000"
+    "Puff Corp\000"
+    "Happy Health, Inc.\000\000"
+    "Montage Connect, Inc.\000"
+    "LED Smart Inc.\000\000"
+    "CONSTRUKTS, INC.\000\000"
+    "limited liability company \"Re\000"
+    "Senic Inc.\000\000"
+    "Automated Pet Care Products,\000\000"
+    "aconno GmbH\000"
+    "Mendeltron, Inc.\000\000"
+    "Mereltron bv\000\000"
+    "ALEX DENKO CO.,LTD.\000"
+    "AETERLINK\000"
+    "Cosmed s.r.l.\000"
+    "Gordon Murray Design Limited\000\000"
+    "IoSA\000\000"
+    "Scandinavian Health Limited\000"
+    "Fasetto, Inc.\000"
+    "Geva Sol B.V.\000"
+    "TYKEE PTY. LTD.\000"
+    "SomnoMed Limited\000\000"
+    "CORROHM\000"
+    "Arlo Technologies, Inc.\000"
+    "Catapult Group International\000\000"
+    "Rockchip Electronics Co., Ltd\000"
+    "GEMU\000\000"
+    "OFF Line Japan Co., Ltd.\000\000"
+    "EC sense co., Ltd\000"
+    "LVI Co.\000"
+    "COMELIT GROUP S.P.A.\000\000"
+    "Foshan Viomi Electrical Techn\000"
+    "Glamo Inc.\000\000"
+    "KEYTEC,Inc.\000"
+    "SMARTD TECHNOLOGIES INC.\000\000"
+    "JURA Elektroapparate AG\000"
+    "Performance Electronics, Ltd.\000"
+    "Pal Electronics\000"
+    "Embecta Corp.\000"
+    "DENSO AIRCOOL CORPORATION\000"
+    "Caresix Inc.\000\000"
+    "GigaDevice Semiconductor Inc.\000"
+    "Zeku Technology (Shanghai) Co\000"
+    "OTF Product Sourcing, LLC\000"
+    "Easee AS\000\000"
+    "BEEHERO, INC.\000"
+    "McIntosh Group Inc\000\000"
+    "KINDOO LLP\000\000"
+    "Xian Yisuobao Electronic Tech\000"
+    "Exeger Operations AB\000\000"
+    "BYD Company Limited\000"
+    "Thermokon-Sensortechnik GmbH\000\000"
+    "SignalQuest, LLC\000\000"
+    "Noritz Corporation.\000"
+    "TIGER CORPORATION\000"
+    "ORB Innovations Ltd\000"
+    "Classified Cycling\000\000"
+    "Wrmth Corp.\000"
+    "BELLDESIGN Inc.\000"
+    "Stinger Equipment, Inc.\000"
+    "HORIBA, Ltd.\000\000"
+    "Control Solutions LLC\000"
+    "Heath Consultants Inc.\000\000"
+    "Berlinger & Co. AG\000\000"
+    "ONCELABS LLC\000\000"
+    "Brose Verwaltung SE, Bamberg\000\000"
+    "Granwin IoT Technology (Guang\000"
+    "Epsilon Electronics,lnc\000"
+    "VALEO MANAGEMENT SERVICES\000"
+    "twopounds gmbh\000\000"
+    "atSpiro ApS\000"
+    "ADTRAN, Inc.\000\000"
+    "Orpyx Medical Technologies In\000"
+    "Seekwave Technology Co.,ltd.\000\000"
+    "Tactile Engineering, Inc.\000"
+    "SharkNinja Operating LLC\000\000"
+    "Imostar Technologies Inc.\000"
+    "INNOVA S.R.L.\000"
+    "ESCEA LIMITED\000"
+    "Taco, Inc.\000\000"
+    "HiViz Lighting, Inc.\000\000"
+    "Zintouch B.V.\000"
+    "Rheem Sales Company, Inc.\000"
+    "UNEEG medical A/S\000"
+    "Hykso Inc.\000\000"
+    "CYBERDYNE Inc.\000\000"
+    "Lockswitch Sdn Bhd\000\000"
+    "Alban Giacomo S.P.A.\000\000"
+    "MGM WIRELESSS HOLDINGS PTY LT\000"
+    "StepUp Solutions ApS\000\000"
+    "BlueID GmbH\000"
+    "Wuxi Linkpower Microelectroni\000"
+    "KEBA Energy Automation GmbH\000"
+    "NNOXX, Inc\000\000"
+    "Phiaton Corporation\000"
+    "phg Peter Hengstler GmbH + Co\000"
+    "dormakaba Holding AG\000\000"
+    "WAKO CO,.LTD\000\000"
+    "TRACKTING S.R.L.\000\000"
+    "Emerja Corporation\000\000"
+    "BLITZ electric motors. LTD\000\000"
+    "CONSORCIO TRUST CONTROL - NET\000"
+    "GILSON SAS\000\000"
+    "SNIFF LOGIC LTD\000"
+    "Fidure Corp.\000\000"
+    "Sensa LLC\000"
+    "Parakey AB\000\000"
+    "SCARAB SOLUTIONS LTD\000\000"
+    "BitGreen Technolabz (OPC) Pri\000"
+    "StreetCar ORV, LLC\000\000"
+    "Truma Ger\303\244tetechnik GmbH & C\000"
+    "yupiteru\000\000"
+    "Embedded Engineering Solution\000"
+    "TEAC Corporation\000\000"
+    "CHARGTRON IOT PRIVATE LIMITED\000"
+    "Zhuhai Smartlink Technology C\000"
+    "Triductor Technology (Suzhou)\000"
+    "PT SADAMAYA GRAHA TEKNOLOGI\000"
+    "Mopeka Products LLC\000"
+    "3ALogics, Inc.\000\000"
+    "Rochester Sensors, LLC\000\000"
+    "CARDIOID - TECHNOLOGIES, LDA\000\000"
+    "Carrier Corporation\000"
+    "NACON\000"
+    "Watchdog Systems LLC\000\000"
+    "MAXON INDUSTRIES, INC.\000\000"
+    "Amlogic, Inc.\000"
+    "Qingdao Eastsoft Communicatio\000"
+    "Weltek Technologies Company L\000"
+    "Nextivity Inc.\000\000"
+    "AGZZX OPTOELECTRONICS TECHNOL\000"
+    "A.GLOBAL co.,Ltd.\000"
+    "Heavys Inc\000\000"
+    "T-Mobile USA\000\000"
+    "tonies GmbH\000"
+    "Technocon Engineering Ltd.\000\000"
+    "Radar Automobile Sales(Shando\000"
+    "WESCO AG\000\000"
+    "Yashu Systems\000"
+    "Kesseb\303\266hmer Ergonomietechnik\000"
+    "Movesense Oy\000\000"
+    "Baxter Healthcare Corporation\000"
+    "Gemstone Lights Canada Ltd.\000"
+    "H+B Hightech GmbH\000"
+    "Deako\000"
+    "MiX Telematics International\000\000"
+    "Vire Health Oy\000\000"
+    "ALF Inc.\000\000"
+    "NTT sonority, Inc.\000\000"
+    "Sunstone-RTLS Ipari Szolgalta\000"
+    "Ribbiot, INC.\000"
+    "ECCEL CORPORATION SAS\000"
+    "Dragonfly Energy Corp.\000\000"
+    "BIGBEN\000\000"
+    "YAMAHA MOTOR CO.,LTD.\000"
+    "XSENSE LTD\000\000"
+    "MAQUET GmbH\000"
+    "MITSUBISHI ELECTRIC LIGHTING\000\000"
+    "Princess Cruise Lines, Ltd.\000"
+    "Megger Ltd\000\000"
+    "Verve InfoTec Pty Ltd\000"
+    "Sonas, Inc.\000"
+    "Mievo Technologies Private Li\000"
+    "Shenzhen Poseidon Network Tec\000"
+    "HERUTU ELECTRONICS CORPORATIO\000"
+    "Shenzhen Shokz Co.,Ltd.\000"
+    "Shenzhen Openhearing Tech CO.\000"
+    "Evident Corporation\000"
+    "NEURINNOV\000"
+    "SwipeSense, Inc.\000\000"
+    "RF Creations\000\000"
+    "SHINKAWA Sensor Technology, I\000"
+    "janova GmbH\000"
+    "Eberspaecher Climate Control\000\000"
+    "Racketry, d. o. o.\000\000"
+    "THE EELECTRIC MACARON LLC\000"
+    "Cucumber Lighting Controls Li\000"
+    "seca GmbH & Co. KG\000\000"
+    "Ameso Tech (OPC) Private Limi\000"
+    "Emlid Tech Kft.\000"
+    "TROX GmbH\000"
+    "Pricer AB\000"
+    "Forward Thinking Systems LLC.\000"
+    "Garnet Instruments Ltd.\000"
+    "CLEIO Inc.\000\000"
+    "Anker Innovations Limited\000"
+    "HMD Global Oy\000"
+    "ABUS August Bremicker Soehne\000\000"
+    "Open Road Solutions, Inc.\000"
+    "Serial Technology Corporation\000"
+    "SB C&S Corp.\000\000"
+    "TrikThom\000\000"
+    "Innocent Technology Co., Ltd.\000"
+    "Cyclops Marine Ltd\000\000"
+    "NOTHING TECHNOLOGY LIMITED\000\000"
+    "Kord Defence Pty Ltd\000\000"
+    "YanFeng Visteon(Chongqing) Au\000"
+    "SENOSPACE LLC\000"
+    "Shenzhen CESI Information Tec\000"
+    "MooreSilicon Semiconductor Te\000"
+    "Imagine Marketing Limited\000"
+    "EQOM SSC B.V.\000"
+    "TechSwipe\000"
+    "Reoqoo IoT Technology Co., Lt\000"
+    "Numa Products, LLC\000\000"
+    "HHO (Hangzhou) Digital Techno\000"
+    "Maztech Industries, LLC\000"
+    "SIA Mesh Group\000\000"
+    "Minami acoustics Limited\000\000"
+    "Wolf Steel ltd\000\000"
+    "Circus World Displays Limited\000"
+    "Ypsomed AG\000\000"
+    "Alif Semiconductor, Inc.\000\000"
+    "SHENZHEN CHENYUN ELECTRONICS\000\000"
+    "VODALOGIC PTY LTD\000"
+    "Regal Beloit America, Inc.\000\000"
+    "CORVENT MEDICAL, INC.\000"
+    "Taiwan Fuhsing\000\000"
+    "Off-Highway Powertrain Servic\000"
+    "Amina Distribution AS\000"
+    "McWong International, Inc.\000\000"
+    "TAG HEUER SA\000\000"
+    "Dongguan Yougo Electronics Co\000"
+    "PEAG, LLC dba JLab Audio\000\000"
+    "HAYWARD INDUSTRIES, INC.\000\000"
+    "Shenzhen Tingting Technology\000\000"
+    "Pacific Coast Fishery Service\000"
+    "CV. NURI TEKNIK\000"
+    "MadgeTech, Inc\000\000"
+    "POGS B.V.\000"
+    "THOTAKA TEKHNOLOGIES INDIA PR\000"
+    "Midmark\000"
+    "Radio Sound\000"
+    "SOLUX PTY LTD\000"
+    "BOS Balance of Storage System\000"
+    "OJ Electronics A/S\000\000"
+    "TVS Motor Company Ltd.\000\000"
+    "core sensing GmbH\000"
+    "Tamblue Oy\000\000"
+    "Protect Animals With Satellit\000"
+    "Tyromotion GmbH\000"
+    "ElectronX design\000\000"
+    "Thule Group AB\000\000"
+    "Ergodriven Inc\000\000"
+    "Sparkpark AS\000\000"
+    "KEEPEN\000\000"
+    "Rocky Mountain ATV/MC Jake Wi\000"
+    "MakuSafe Corp\000"
+    "Bartec Auto Id Ltd\000\000"
+    "Energy Technology and Control\000"
+    "doubleO Co., Ltd.\000"
+    "Datalogic S.r.l.\000\000"
+    "Datalogic USA, Inc.\000"
+    "Leica Geosystems AG\000"
+    "CATEYE Co., Ltd.\000\000"
+    "Research Products Corporation\000"
+    "Planmeca Oy\000"
+    "C.Ed. Schulte GmbH Zylindersc\000"
+    "PetVoice Co., Ltd.\000\000"
+    "Timebirds Australia Pty Ltd\000"
+    "JVC KENWOOD Corporation\000"
+    "Spartek Systems Inc.\000\000"
+    "MERRY ELECTRONICS CO., LTD.\000"
+    "Merry Electronics (S) Pte Ltd\000"
+    "Spark\000"
+    "Nations Technologies Inc.\000"
+    "Akix S.r.l.\000"
+    "Bioliberty Ltd\000\000"
+    "C.G. Air Systemes Inc.\000\000"
+    "Maturix ApS\000"
+    "RACHIO, INC.\000\000"
+    "LIMBOID LLC\000"
+    "Electronics4All Inc.\000\000"
+    "FESTINA LOTUS SA\000\000"
+    "Synkopi, Inc.\000"
+    "SCIENTERRA LIMITED\000\000"
+    "Cennox Group Limited\000\000"
+    "Cedarware, Corp.\000\000"
+    "GREE Electric Appliances, Inc\000"
+    "Japan Display Inc.\000\000"
+    "System Elite Holdings Group L\000"
+    "Burkert Werke GmbH & Co. KG\000"
+    "velocitux\000"
+    "FUJITSU COMPONENT LIMITED\000"
+    "MIYAKAWA ELECTRIC WORKS LTD.\000\000"
+    "PhysioLogic Devices, Inc.\000"
+    "Sensoryx AG\000"
+    "SIL System Integration Labora\000"
+    "Cooler Pro, LLC\000"
+    "Advanced Electronic Applicati\000"
+    "Delta Development Team, Inc\000"
+    "Laxmi Therapeutic Devices, In\000"
+    "SYNCHRON, INC.\000\000"
+    "Badger Meter\000\000"
+    "Micropower Group AB\000"
+    "ZILLIOT TECHNOLOGIES PRIVATE\000\000"
+    "Universidad Politecnica de Ma\000"
+    "XIHAO INTELLIGENGT TECHNOLOGY\000"
+    "Zerene Inc.\000"
+    "CycLock\000"
+    "Systemic Games, LLC\000"
+    "Frost Solutions, LLC\000\000"
+    "Lone Star Marine Pty Ltd\000\000"
+    "SIRONA Dental Systems GmbH\000\000"
+    "bHaptics Inc.\000"
+    "LUMINOAH, INC.\000\000"
+    "Vogels Products B.V.\000\000"
+    "SignalFire Telemetry, Inc.\000\000"
+    "CPAC Systems AB\000"
+    "TEKTRO TECHNOLOGY CORPORATION\000"
+    "Gosuncn Technology Group Co.,\000"
+    "Ex Makhina Inc.\000"
+    "Odeon, Inc.\000"
+    "Thales Simulation & Training\000\000"
+    "Shenzhen DOKE Electronic Co.,\000"
+    "Vemcon GmbH\000"
+    "Refrigerated Transport Electr\000"
+    "Rockpile Solutions, LLC\000"
+    "Soundwave Hearing, LLC\000\000"
+    "Optec, LLC\000\000"
+    "NIKAT SOLUTIONS PRIVATE LIMIT\000"
+    "Movano Inc.\000"
+    "NINGBO FOTILE KITCHENWARE CO.\000"
+    "Genetus inc.\000\000"
+    "DIVAN TRADING CO., LTD.\000"
+    "Luxottica Group S.p.A\000"
+    "ISEKI FRANCE S.A.S\000\000"
+    "NO CLIMB PRODUCTS LTD\000"
+    "Wellang.Co,.Ltd\000"
+    "Nanjing Xinxiangyuan Microele\000"
+    "ifm electronic gmbh\000"
+    "HYUPSUNG MACHINERY ELECTRIC C\000"
+    "Gunnebo Aktiebolag\000\000"
+    "Axis Communications AB\000\000"
+    "Stogger B.V.\000\000"
+    "Pella Corp\000\000"
+    "SiChuan Homme Intelligent Tec\000"
+    "Smart Products Connection, S.\000"
+    "F.I.P. FORMATURA INIEZIONE PO\000"
+    "MEBSTER s.r.o.\000\000"
+    "SKF France\000\000"
+    "Southco\000"
+    "Molnlycke Health Care AB\000\000"
+    "Hendrickson USA , L.L.C\000"
+    "BLACK BOX NETWORK SERVICES IN\000"
+    "Status Audio LLC\000\000"
+    "AIR AROMA INTERNATIONAL PTY L\000"
+    "Helge Kaiser GmbH\000"
+    "Crane Payment Innovations, In\000"
+    "Ambient IoT Pty Ltd\000"
+    "DYNAMOX S/A\000"
+    "Look Cycle International\000\000"
+    "Closed Joint Stock Company NV\000"
+    "Kindhome\000\000"
+    "Kiteras Inc.\000\000"
+    "Earfun Technology (HK) Limite\000"
+    "iota Biosciences, Inc.\000\000"
+    "ANUME s.r.o.\000\000"
+    "Indistinguishable From Magic,\000"
+    "i-focus Co.,Ltd\000"
+    "DualNetworks SA\000"
+    "MITACHI CO.,LTD.\000\000"
+    "VIVIWARE JAPAN, Inc.\000\000"
+    "Xiamen Intretech Inc.\000"
+    "MindMaze SA\000"
+    "BeiJing SmartChip Microelectr\000"
+    "Taiko Audio B.V.\000\000"
+    "Daihatsu Motor Co., Ltd.\000\000"
+    "Konova\000\000"
+    "Gravaa B.V.\000"
+    "Beyerdynamic GmbH & Co. KG\000\000"
+    "VELCO\000"
+    "ATLANTIC SOCIETE FRANCAISE DE\000"
+    "Testo SE & Co. KGaA\000"
+    "SEW-EURODRIVE GmbH & Co KG\000\000"
+    "ROCKWELL AUTOMATION, INC.\000"
+    "Quectel Wireless Solutions Co\000"
+    "Nanohex Corp\000\000"
+    "Simply Embedded Inc.\000\000"
+    "Software Development, LLC\000"
+    "Ultimea Technology (Shenzhen)\000"
+    "RF Electronics Limited\000\000"
+    "Optivolt Labs, Inc.\000"
+    "Canon Electronics Inc.\000\000"
+    "LAAS ApS\000\000"
+    "Beamex Oy Ab\000\000"
+    "TACHIKAWA CORPORATION\000"
+    "HagerEnergy GmbH\000\000"
+    "Hunter Industries Incorporate\000"
+    "NEOKOHM SISTEMAS ELETRONICOS\000\000"
+    "Zhejiang Huanfu Technology Co\000"
+    "E.F. Johnson Company\000\000"
+    "Caire Inc.\000\000"
+    "Yeasound (Xiamen) Hearing Tec\000"
+    "Boxyz, Inc.\000"
+    "Skytech Creations Limited\000"
+    "Cear, Inc.\000\000"
+    "Impulse Wellness LLC\000\000"
+    "MML US, Inc\000"
+    "SICK AG\000"
+    "Fen Systems Ltd.\000\000"
+    "KIWI.KI GmbH\000\000"
+    "Airgraft Inc.\000"
+    "HP Tuners\000"
+    "PIXELA CORPORATION\000\000"
+    "Generac Corporation\000"
+    "Novoferm tormatic GmbH\000\000"
+    "Airwallet ApS\000"
+    "Inventronics GmbH\000"
+    "Shenzhen EBELONG Technology C\000"
+    "Efento\000\000"
+    "ITALTRACTOR ITM S.P.A.\000\000"
+    "TITUM AUDIO, INC.\000"
+    "Hexagon Aura Reality AG\000"
+    "Invisalert Solutions, Inc.\000\000"
+    "TELE System Communications Pt\000"
+    "Whirlpool\000"
+    "SHENZHEN REFLYING ELECTRONIC\000\000"
+    "Franklin Control Systems\000\000"
+    "Djup AB\000"
+    "SAFEGUARD EQUIPMENT, INC.\000"
+    "Morningstar Corporation\000"
+    "Shenzhen Chuangyuan Digital T\000"
+    "CompanyDeep Ltd\000"
+    "Veo Technologies ApS\000\000"
+    "Nexis Link Technology Co., Lt\000"
+    "Felion Technologies Company L\000"
+    "MAATEL\000\000"
+    "HELLA GmbH & Co. KGaA\000"
+    "HWM-Water Limited\000"
+    "Shenzhen Jahport Electronic T\000"
+    "NACHI-FUJIKOSHI CORP.\000"
+    "Cirrus Research plc\000"
+    "GEARBAC TECHNOLOGIES INC.\000"
+    "Hangzhou NationalChip Science\000"
+    "DHL\000"
+    "Levita\000\000"
+    "MORNINGSTAR FX PTE. LTD.\000\000"
+    "ETO GRUPPE TECHNOLOGIES GmbH\000\000"
+    "farmunited GmbH\000"
+    "Aptener Mechatronics Private\000\000"
+    "GEOPH, LLC\000\000"
+    "Trotec GmbH\000"
+    "Astra LED AG\000\000"
+    "NOVAFON - Electromedical devi\000"
+    "KUBU SMART LIMITED\000\000"
+    "ESNAH\000"
+    "OrangeMicro Limited\000"
+    "Fresh n Rebel B.V.\000\000"
+    "Global Satellite Engineering\000\000"
+    "KOQOON GmbH & Co.KG\000"
+    "BEEPINGS\000\000"
+    "MODULAR MEDICAL, INC.\000"
+    "Xiant Technologies, Inc.\000\000"
+    "SCHELL GmbH & Co. KG\000\000"
+    "Minebea Intec GmbH\000\000"
+    "KAGA FEI Co., Ltd.\000\000"
+    "AUTHOR-ALARM, razvoj in proda\000"
+    "Tozoa LLC\000"
+    "SHENZHEN DNS INDUSTRIES CO.,\000\000"
+    "Shenzhen Lunci Technology Co.\000"
+    "KNOG PTY. LTD.\000\000"
+    "Outshiny India Private Limite\000"
+    "TAMADIC Co., Ltd.\000"
+    "Shenzhen MODSEMI Co., Ltd\000"
+    "EMBEINT INC\000"
+    "Ehong Technology Co.,Ltd\000\000"
+    "DEXATEK Technology LTD\000\000"
+    "Dendro Technologies, Inc.\000"
+    "Vivint, Inc.\000\000"
+    "General Laser GmbH\000\000"
+    "Kathrein Solutions GmbH\000"
+    "Fitz Inc.\000"
+    "ATEGENOS PHARMACEUTICALS INC\000\000"
+    "Flextronic GmbH\000"
+    "Safety Swim LLC\000"
+    "SING SUN TECHNOLOGY (INTERNAT\000"
+    "Woncan (Hong Kong) Limited\000\000"
+    "iFLYTEK (Suzhou) Technology C\000"
+    "Weber-Stephen Products LLC\000\000"
+    "hDrop Technologies Inc.\000"
+    "REEKON TOOLS INC.\000"
+    "Delta Faucet Company\000\000"
+    "Mutrack Co., Ltd\000\000"
+    "Hangzhou Zhaotong Microelectr\000"
+    "Chengdu CSCT Microelectronics\000"
+    "Belusun Technology Ltd.\000"
+    "Shenzhen Matches IoT Technolo\000"
+    "Beidou Intelligent Connected\000\000"
+    "SOJI ELECTRONICS JOINT STOCK\000\000"
+    "BH Technologies\000"
+    "Haptech, Inc.\000"
+    "WaveRF, Corp.\000"
+    "SHENZHEN SOUNDSOUL INFORMATIO\000"
+    "Wuhu Mengbo Technology Co., L\000"
+    "PROSYS DEV LIMITED\000\000"
+    "Shenzhen eMeet technology Co.\000"
+    "Doro AB\000"
+    "SUREPULSE MEDICAL LIMITED\000"
+    "iodyne, LLC\000"
+    "Pinpoint GmbH\000"
+    "Heinrich Kopp GmbH\000\000"
+    "Evolutive Systems SL\000\000"
+    "Sounding Audio Industrial Ltd\000"
+    "Yuanfeng Technology Co., Ltd.\000"
+    "FrontAct Co., Ltd.\000\000"
+    "SenseWorks Tecnologia Ltda.\000"
+    "Eko Health, Inc.\000\000"
+    "Wanzl GmbH & Co. KGaA\000"
+    "CLEVER LOGGER TECHNOLOGIES PT\000"
+    "ASYSTOM\000"
+    "Heilongjiang Tianyouwei Elect\000"
+    "Eastern Partner Limited\000"
+    "Xiamen RUI YI Da Electronic T\000"
+    "Ad Hoc Electronics, llc.\000\000"
+    "Hangzhou Microimage Software\000\000"
+    "Hive-Zox International SA\000"
+    "Sensovo GmbH\000\000"
+    "Time Location Systems AS\000\000"
+    "SHENZHEN DIGITECH CO., LTD\000\000"
+    "Capte B.V.\000\000"
+    "9512-5837 QUEBEC INC.\000"
+    "Blecon Ltd\000\000"
+    "CFLAB TEKNOLOJI TICARET LIMIT\000"
+    "FOGO\000\000"
+    "HITO INC\000\000"
+    "MS kajak7 UG (limited liabili\000"
+    "Avedis Zildjian Co.\000"
+    "Hangzhou Hikvision Digital Te\000"
+    "LIHJOEN SPEED METER CO., LTD.\000"
+    "NextSense, Inc.\000"
+    "PatchRx, Inc.\000"
+    "Flipper Devices Inc.\000\000"
+    "Huizhou Foryou General Electr\000"
+    "JE electronic a/s\000"
+    "9313-7263 Quebec inc.\000"
+    "ECARX (Hubei) Tech Co.,Ltd.\000"
+    "NIHON KOHDEN CORPORATION\000\000"
+    "ONWI\000\000"
+    "Primax Electronics Ltd.\000"
+    "AlphaTheta Corporation\000\000"
+    "PACIFIC INDUSTRIAL CO., LTD.\000\000"
+    "Crescent NV\000"
+    "Vermis, software solutions ll\000"
+    "SNAPPWISH LLC\000"
+    "Cousins and Sears LLC\000"
+    "CESYS Gesellschaft f\303\274r angew\000"
+    "SLOC GmbH\000"
+    "IRES Infrarot Energie Systeme\000"
+    "OFIVE LIMITED\000"
+    "Swift IOT Tech (Shenzhen) Co.\000"
+    "Viselabs\000\000"
+    "Walmart Inc.\000\000"
+    "VANBOX\000\000"
+    "Wiser Devices, LLC\000\000"
+    "WKD Labs Ltd\000\000"
+    "Asustek Computer Inc.\000"
+    "Z-ONE Technology Co., Ltd.\000\000"
+    "InnoVision Medical Technologi\000"
+    "QUANTATEC\000"
+    "Filo Srl\000\000"
+    "SOUNDUCT\000\000"
+    "Hosiden Besson Limited\000\000"
+    "KARLUNA MUHENDISLIK SANAYI VE\000"
+    "Deone (Shanghai) Communicatio\000"
+    "Nitto Denko Corporation\000"
+    "PUDSEY DIAMOND ENGINEERING LI\000"
+    "Luxshare Precision Industry C\000"
+    "Brooksee, Inc.\000\000"
+    "QSC, LLC\000\000"
+    "eBet Gaming Sytems Pty Limite\000"
+    "Zhejiang Desman Intelligent T\000"
+    "Dyaco International Inc.\000\000"
+    "Aquana, LLC\000"
+    "MINIRIG\000"
+    "Relief Technologies AS\000\000"
+    "New Cosmos Electric Co., Ltd.\000"
+    "INEPRO Metering B.V.\000\000"
+    "Altina Inc.\000"
+    "Urban Armor Gear, LLC\000"
+    "Loewe Technology GmbH\000"
+    "OmniWave Microelectronics Sha\000"
+    "Wuhu Hongjing Electronic Co.,\000"
+    "Rocoto Ltd\000\000"
+    "L.T.H. Electronics Limited\000\000"
+    "SHAPER TOOLS, INC.\000\000"
+    "Ruptela\000"
+    "Ant Group Co., Ltd.\000"
+    "Queclink Wireless Solutions C\000"
+    "GOKI PTY LTD\000\000"
+    "LAST LOCK INC.\000\000"
+    "HuiTong intelligence Company\000\000"
+    "Daikin Industries, LTD\000\000"
+    "Shenzhen Baseus Technology Co\000"
+    "NEXT DEVICES LTDA\000"
+    "EarTex Ltd\000\000"
+    "Megatronix (Beijing) Technolo\000"
+    "Hyena Inc.\000\000"
+    "Shenzhen Goodocom Information\000"
+    "RIGH, INC.\000\000"
+    "FEVOS LIMITED\000"
+    "OpConnect, Inc.\000"
+    "Powerstick.com\000\000"
+    "ENABLEWEAR LLC\000\000"
+    "TOR.AI LIMITED\000\000"
+    "Adventures of the Persistentl\000"
+    "Rocky Radios LLC\000\000"
+    "Le Touch (Shenzhen) Electroni\000"
+    "Guangdong Nanguang Photo&Vide\000"
+    "MOBILE TECH, INC.\000"
+    "HONG KONG COMMUNICATIONS COMP\000"
+    "Neptune First OU\000\000"
+    "Vivago Oy\000"
+    "Circular\000\000"
+    "final Inc.\000\000"
+    "Jiangsu XinTongda Electric Te\000"
+    "Archon Controls LLC\000"
+    "SZR-Dev UG\000\000"
+    "IQNEXXT Solutions GmbH\000\000"
+    "Guangdong Hengqin Xingtong Te\000"
+    "CHEVALIER TECH LIMITED\000\000"
+    "SPRiNTUS GmbH\000"
+    "Tymphany HK Ltd\000"
+    "TigerLight, Inc.\000\000"
+    "Mercury Marine, a division of\000"
+    "OpenTech Alliance, Inc.\000"
+    "Skewered Fencing, LLC\000"
+    "Brudden\000"
+    "Tele-Radio i Lysekil AB\000"
+    "Allgon AB\000"
+    "Gopod Group Holding Limited\000"
+    "Celebrities Management Privat\000"
+    "Nobest Inc\000\000"
+    "Avetos Design LLC\000"
+    "RainMaker Solutions, Inc.\000"
+    "Identita Inc.\000"
+    "Glutz AG\000\000"
+    "MIV ELECTRONICS, LTD\000\000"
+    "Tactrix\000"
+    "Viaanix, Inc.\000"
+    "Skeed,co,Ltd.\000"
+    "kokoromil Inc.\000\000"
+    "Chromatic Inc.\000\000"
+    "Medibound, Inc.\000"
+    "Scanbro OU\000\000"
+    "Panasonic Automotive Systems\000\000"
+    "Andrews & Arnold Ltd\000\000"
+    "Audinor ApS\000"
+    "Travelxp India Private Limite\000"
+    "Owlet Baby Care Inc.\000\000"
+    "ENLESS WIRELESS\000"
+    "Culligan International Compan\000"
+    "QIKCONNEX LLC\000"
+    "OLIS ELECTRONICS, LLC\000"
+    "BiTECH Automotive (Wuhu) Co.,\000"
+    "EasyReach Solutions Private L\000"
+    "AMG Lab LLC\000"
+    "BrickXter GmbH\000\000"
+    "Dongguan Trangjan Industrial\000\000"
+    "Makichie Co., Ltd.\000\000"
+    "Hive Soundz inc.\000\000"
+    "STEYR Sport GmbH\000\000"
+    "Dynetrex Solutions Inc.\000"
+    "OPTRON Co., Ltd.\000\000"
+    "BHClears Microelectronics (Sh\000"
+    "Unfolded Circle ApS\000"
+    "FactorySense\000\000"
+    "WearNex Limited\000"
+    "PRADCO Outdoor Brands\000"
+    "Zucchetti Axess\000"
+    "BLUEFIN DATA, LLC\000"
+    "Preseed Japan Corporation\000"
+    "Server Products, Inc.\000"
+    "Embedded Solutions LLC\000\000"
+    "PARAGON ID\000\000"
+    "egojin co,.ltd\000\000"
+    "THERMY LTD\000\000"
+    "Asahi Denso Co.,Ltd.\000\000"
+    "GP Acoustics International Li\000"
+    "Tongfang Health Technology (B\000"
+    "Deity Acoustic Technology Co.\000"
+    "Schulte-Schlagbaum AG\000"
+    "WEST inx Ltd.\000"
+    "Crossdoor\000"
+    "High Entropy, LLC\000"
+    "Herschel Infrared Ltd\000"
+    "PACIFIC MARINE BATTERIES PTY.\000"
+    "Alibaba (China) Co., Ltd.\000"
+    "AuthGate B.V.\000"
+    "Canyon Bicycles GmbH\000\000"
+    "Codie LLC\000"
+    "NeuroPace Inc\000"
+    "NexRev LLC\000\000"
+    "Zhong Shan City Richsound Ele\000"
+    "Shenzhen NEOECO Technology Co\000"
+    "Nature Inc.\000"
+    "Guangzhou Honor Microelectron\000"
+    "GGEC America, Inc.\000\000"
+    "Gibson, Inc.\000\000"
+    "VINYL MATT MEDIA LIMITED\000\000"
+    "SHENZHEN BESTWAY ELECTRONICS\000\000"
+    "Lichens Innovation inc.\000"
+    "Goerdyna Group Co., Ltd\000"
+    "Relish Technologies Limited\000"
+    "Quintessential Design, Inc.\000"
+    "CS INSTRUMENTS GmbH & Co.KG\000"
+    "DORAN MFG. LLC\000\000"
+    "Overhead Door Corporation\000"
+    "Kodira GmbH\000"
+    "ShenZhen BoYiChuangXin\000\000"
+    "Shenzhen Zoqin Technology Co.\000"
+    "Ceridwen Limited\000\000"
+    "Sony Honda Mobility Inc.\000\000"
+    "Dynaudio A/S\000\000"
+    "MAERSK CONTAINER INDUSTRY A/S\000"
+    "MA MICRO LIMITED\000\000"
+    "shenzhen hongever technology\000\000"
+    "TAMRON Co., Ltd.\000\000"
+    "CAPTEMP, LDA\000\000"
+    "Ambient Life Inc.\000"
+    "NOCTRIX HEALTH, INC\000"
+    "RICKARD AIR DIFFUSION (PTY) L\000"
+    "SG Armaturen AS\000"
+    "PIXEL TI IND. E COM PROD ELET\000"
+    "Core Devices LLC\000\000"
+    "Fujita Electric Works, Ltd\000\000"
+    "Willow Laboratories, Inc.\000"
+    "BBC Bircher AG\000\000"
+    "ELLEA INGEGNERIA SRL UNIPERSO\000"
+    "Q42 Internet B.V.\000"
+    "Seaward Electronic\000\000"
+    "Wuxi Does IOT Co., Ltd\000\000"
+    "CAPTAIN BLINK\000"
+    "Monil AS\000\000"
+    "LS ELECTRIC Co., Ltd.\000"
+    "Shenzhen Cyber Innovation Tec\000"
+    "Trackonomy Systems, Inc.\000\000"
+    "IoT Solutions Malta Limited\000"
+    "Aseptico, Inc.\000\000"
+    "Sensear Pty Ltd\000"
+    "BLUEPROVIDERZ LLC\000"
+    "Jano Life Inc.\000\000"
+    "PRIMES GmbH\000"
+    "Teledyne Instruments, Inc.\000\000"
+    "Healthcare Technology Limited\000"
+    "TRACERCO LIMITED\000\000"
+    "HAPPLABS SOFTWARE PRIVATE LIM\000"
+    "GE HEALTHCARE TECHNOLOGIES IN\000"
+    "Olibra LLC\000\000"
+    "Lumen Labs (HK) Ltd\000"
+    "SHENZHEN GWSTAI TECHNOLOGY CO\000"
+    "SHENZHEN POWEROAK NEWENER CO.\000"
+    "Tech OVN Private Limited\000\000"
+    "Lezyne USA Inc.\000"
+    "ANC CHINA LIMITED\000"
+    "LION GROUP, INC.\000\000"
+    "Brightway Innovation Intellig\000"
+    "Hitachi Industrial Equipment\000\000"
+    "Maennl Elektronik GmbH\000\000"
+    "IDEATRONIK Limited Liability\000\000"
+    "caive Inc.\000\000"
+    "ShenZhen Doctors of Intellige\000"
+    "Deep and Steep LLC\000\000"
+    "Endur ID, Inc.\000\000"
+    "Freshape SA\000"
+    "PreEvnt, LLC\000\000"
+    "Oval Corporation\000\000"
+    "ADHD Friendly co.Ltd\000\000"
+    "RORENTECH Co., Ltd.\000"
+    "iKeyless, LLC\000"
+    "Shenzhen SuperSound Technolog\000"
+    "FLO SCIENCES, LLC\000"
+    "PalatiumCare LLC\000\000"
+    "Edge Semiconductors Inc.\000\000"
+    "ZIMMERMANN PV-Steel Group Gmb\000"
+    "Yolni Inc.\000\000"
+    "Ninebot (Changzhou) Tech Co.,\000"
+    "Beijing Spring Creation Techn\000"
+    "Rokk Limited\000\000"
+    "ONESPACE TECHNOLOGIES (PTY) L\000"
+    "Yuquan Semiconductor (Xiamen)\000"
+    "Easy Measure Co., Ltd.\000\000"
+    "Sichuan Changhong Neonet Tech\000"
+    "Centromere Holding B.V.\000"
+    "Global Link Distribution Corp\000"
+    "Amp Fit Israel LTD\000\000"
+    "Trezor Company s.r.o.\000"
+    "KELLER Druckmesstechnik AG\000\000"
+    "ElitEngineering LLC\000"
+    "Vision Group Inc.\000"
+    "ClipsClips LLC\000\000"
+    "BRITZ INTERNATIONAL CO.,LTD\000"
+    "ThingCo Limited\000"
+    "Opal Camera, Inc.\000"
+    "TECHNOLOGIES FOR FREERIDE s.r\000"
+    "FLINTEC UK LIMITED\000\000"
+    "TETNET\000\000"
+    "NINGBO SHARKWARD ELECTRONICS\000\000"
+    "Audeze LLC\000\000"
+    "NODER Joint Stock Company\000"
+    "Schueco International KG\000\000"
+    "GILL INSTRUMENTS LIMITED\000\000"
+    "Seitron Spa\000"
+    "Southern Audio Services, Inc\000\000"
+    "SANWA NEWTEC CO.,LTD.\000"
+    "Mobile Technology Solutions L\000"
+    "Vitio Medical S.L.\000\000"
+    "Salyx Medical Inc.\000\000"
+    "Landig + Lava GmbH & Co. KG\000"
+    "Health Data Insight C.I.C.\000\000"
+    "BONX INC.\000"
+    "LINKEDCHIP TECHNOLOGY INC\000"
+    "12mm Health Technology (Haina\000"
+    "MAVERICK ENERGY SOLUTIONS INT\000"
+    "Tactica Defense LLC\000"
+    "Huizhou Meicanxin Electronics\000"
+    "Lodestar Technology Inc.\000\000"
+    "Shenzhen Xinfeiyi Technology\000\000"
+    "IYO INC.\000\000"
+    "Mitsubishi Motors Corporation\000"
+    "desamisCo.,Ltd.\000"
+    "JL WORLD CORPORATION LIMITED\000\000"
+    "Qulinda AB\000\000"
+    "Ningbo Dooya Mechanic & Elect\000"
+    "G-Vision GmbH\000"
+    "Lantern Innovations Incorpora\000"
+    "ebm-papst Mulfingen GmbH & Co\000"
+    "Shenzhen Yunke Intelligent Co\000"
+    "Fledt & Meiton Marin AB\000"
+    "ContiTech Deutschland GmbH\000\000"
+    "Sensoteq Ltd\000\000"
+    "Astute Access Group Limited\000"
+    "Silverlake Technologies\000"
+    "Shenzhen Guo-link Technology\000\000"
+    "Silicon Vandals PTY LTD\000"
+    "Vibe Energy B.V.\000\000"
+    "shanghai fudan electronics gr\000"
+    "Micro Technology Services, In\000"
+    "Leapcraft ApS\000"
+    "WUXI WEIDA INTELLIGENT ELECTR\000"
+    "ROBSON SRL\000\000"
+    "Quilt Systems, Inc.\000"
+    "HyolimXE Co., Ltd.\000\000"
+    "Kehwin Technologies Co. Ltd.\000\000"
+    "WATTER, Inc.\000\000"
+    "SafeNow GmbH\000\000"
+    "CZV, Inc\000\000"
+    "BIGREDBEE, LLC\000\000"
+    "White Eagle Sonic Technologie\000"
+    "Navico\000\000"
+    "Ancoe Industry Corporation\000\000"
+    "Roam Devices LLC\000\000"
+    "Skywalk Inc.\000\000"
+    "Biogents AG\000"
+    "MODRETRO, INC.\000\000"
+    "iSi Wearable Safety GmbH\000\000"
+    "onanoff limited\000"
+    "TECHFLITTER SOLUTIONS PRIVATE\000"
+    "PIRITIZ LLC\000"
+    "FLORLINK, INC.\000\000"
+    "Keycafe Inc.\000\000"
+    "Sperry Labs LLC\000"
+    "Senseonics, Incorporated\000\000"
+    "simatec ag\000\000"
+    "CROSS BRAIN CO.,Ltd.\000\000"
+    "Also, Inc.\000\000"
+    "Walter Mueller Inc. for Indus\000"
+    "SHENZHEN GUANG QI GUO CHUANG\000\000"
+    "SKYROAM, INC.\000"
+    "Polk Audio\000\000"
+    "eQ-3 AG\000"
+    "shenzhen Holyiot Technology C\000"
+    "Badass eBikes GmbH\000\000"
+    "Hydro Electronic Devices, Inc\000"
+    "IN Phase International lTD\000\000"
+    "Amon Co.Ltd.\000\000"
+    "Calpeda S.p.A.\000\000"
+    "KT Micro, Inc.\000\000"
+    "Hangzhou Sciener Smart Techno\000"
+    "Lakecrest Pty Ltd\000"
+    "Anacove Inc.\000\000"
+    "Kohler Ventures, Inc.\000"
+    "STOREIO TECHNOLOGIES LTD\000\000"
+    "Innogando S.L.\000\000"
+    "A.Y. McDonald Mfg. Co.\000\000"
+    "ROYAL PARTS CO.,LTD\000"
+    "JUREN CO., LTD.\000"
+    "Biceek Inc\000\000"
+    "SIGNUM INTELLIGENCE LTD\000"
+    "MOBI7 TECNOLOGIA EM MOBILIDAD\000"
+    "Valostra Digital Ventures LLP\000"
+    "Ethos Group, Inc.\000"
+    "Aktiebolaget Ebeco\000\000"
+    "IDX Company, Ltd.\000"
+    "Dongguang Huasoo Automation T\000"
+    "SEIKOIST, INC\000"
+    "SPX Aids to Navigation Oy\000"
+    "Fitnexa Inc\000"
+    "DEZINE GROUP LLC\000\000"
+    "Eiritsu Electronics Industry\000\000"
+    "Hanshow Technology Co.,Ltd.\000"
+    "WePower Technologies LLC\000\000"
+    "IRTrans GmbH\000\000"
+    "Hibino Corporation\000\000"
+    "Seiko Future Creation Inc.\000\000"
+    "DP IOT\000\000"
+    "PALRED RETAIL PRIVATE LIMITED\000"
+    "BIA NEUROSCIENCE INC.\000"
+    "B.E.G. Brueck Electronic GmbH\000"
+    "Nice Spa\000\000"
+    "Avanos Medical, Inc.\000\000"
+    "Ugreen Group Limited\000\000"
+    "spheretek japan\000"
+    "Senti Technologies Private Li\000"
+    "Ranch Systems, Inc.\000"
+    "Suzhou Fanxi Technology Co.,\000\000"
+    "Geo Radar AI Private Limited\000\000"
+    "Flitsmeister B.V.\000"
+    "The AI Toy Company\000\000"
+    "Capacite\000\000"
+    "Terasite Technologies\000"
+    "General Resistance, LLC\000"
+    "Avivomed Inc.\000"
+    "PLAUD Inc.\000\000"
+    "Hooked Society Oy Ltd\000"
+    "StoneDevices\000\000"
+    "Hangzhou Nano IC Technologies\000"
+    "TQ-Systems GmbH\000"
+    "Hapn Holdings, LLC\000\000"
+    "SITERWELL ELECTRONICS CO.,LIM\000"
+    "Shenzhen Mutual Technology Co\000"
+    "Cosonic Intelligent Technolog\000"
+    "Rollease Acmeda, Inc.\000"
+    "ATANS TECHNOLOGY INC.\000"
+    "Locus Robotics Corp.\000\000"
+    "TaigaIoT\000\000"
+    "Tridentify AB\000"
+    "Littlebird Connected Care, In\000"
+    "Air Automotive tracking Inc.\000\000"
+    "ISSPRO, INC\000"
+    "Shenzhen Jimi loT Co.,Ltd\000"
+    "FulScience Automotive Electro\000"
+    "Hypershell Co., Ltd\000"
+    "ASD Lighting PLC\000\000"
+    "Pharox B.V.\000"
+    "Eforthink Technology Co., Ltd\000"
+    "Zirbel Bike GmbH\000\000"
+    "Legato Audio, Inc.\000\000"
+    "Biocorp Production\000\000"
+    "Neurotherapeutics Ltd\000"
+    "Wimate Technology Solutions P\000"
+    "NOJA Power\000\000"
+    "Nestlab AS\000\000"
+    "Stark Future SL\000"
+    "Auranova LLC\000\000"
+    "Domteknika S.A\000\000"
+    "YDIIT Co., Ltd\000\000"
+    "QRITAGYA LLP\000\000"
+    "Telemacy Ltd\000\000"
+    "LIOTYS\000\000"
+    "Hondata, Inc.\000"
+    "SIVA Inotec Limited\000"
+    "REMDEVICE S.R.L.\000\000"
+    "NIVELCO PROCESS CONTROL CO.\000"
+    "Beijing Hongsi Electronic Tec\000"
+    "FOSS Analytical A/S\000"
+    "Blahaj Ltd\000\000"
+    "Nextorage Corporation\000"
+    "infyni\000\000"
+    "Raspberry Pi\000\000"
+    "Shenzhen Huasheng Jiaye Techn\000"
+    "Namara Water Technologies, In\000"
+    "Shanghai Holychip Electronic\000\000"
+    "Rotarex S.A.\000\000"
+    "VOTRONIC Elektronik-Systeme G\000"
+    "EXELIO S.R.L.\000"
+    "Yamaha Motor eBike Systems Gm\000"
+    "Ferrari s.p.a.\000\000"
+    "Anhui Ubico Advanced Manufact\000"
+    "Mueller-BBM Rail Technologies\000"
+    "Yoto Limited\000\000"
+    "LAUMAS Elettronica S.r.l.\000"
+    "BUND MEDIA PTY. LTD.\000\000"
+    "LSC Control Systems Pty Ltd\000"
+    "Safety Lighting Research Pty\000\000"
+    "Hangzhou Sneuro Medical Co.,\000\000"
+    "UnlimitedIRL LLC\000\000"
+    "MAXTA TECH INC.\000"
+    "Sensorworx, Inc.\000\000"
+    "Romcor Pty Ltd\000\000"
+    "NewNet, Inc.\000\000"
+    "CLM-Solutions\000"
+    "RSA Security LLC\000\000"
+    "Gravity (Shenzhen)Space Techn\000"
+    "Shenzhen Shuye Technology Co.\000"
+    "ArjoHuntleigh AB\000\000"
+    "Fairbanks Scales Inc.\000"
+    "YANMAR HOLDINGS CO., LTD.\000"
+    "Williams Sound, LLC\000"
+    "Zuuka Limited\000"
+    "Chip-pump Microelectronics\000\000"
+    "TOMOE VALVE CO.,LTD\000"
+    "VCS Vision Control Solutions\000\000"
+    "Framason Audio S.A\000\000"
+    "Field Line Automation Ltd\000"
+    "Shearwater Research Inc.\000\000"
+    "HIGH HIT ENTERPRISE CO., LTD.\000"
+    "Algiz AS\000\000"
+    "Shenzhen FHX Precision Hardwa\000"
+    "Hotron Co., Ltd.\000\000"
+    "Remoticom B.V.\000\000"
+    "OSKEY\000"
+    "GORDON MURRAY GROUP LIMITED\000"
+    "Global Electronics\000\000"
+    "Rokstar Holdings Limited\000\000"
+    "STRYDE LIMITED\000\000"
+    "Prosaris Solutions Ltd.\000"
+    "TLV Co.,LTD.\000\000"
+    "IZYBAT\000\000"
+    "ALTESSA SOLUTIONS INC.\000\000"
+    "Hong Kong Future lntelligent\000\000"
+    "CenTrak, Inc.\000"
+    "TM-TECHNOLOGIES, JSC\000\000"
+    "ALPHADIF\000\000"
+    "Shenzhen Muyu Technology Co.,\000"
+    "augment AI Inc.\000"
+    "Digimax Innovative Products L\000"
+    "CodaHD LLC\000\000"
+    "E.J. Brooks Company\000"
+    "Martin.Care GmbH\000\000"
+    "IMPACT-BZ LTD\000"
+    "Belford investment holdings p\000"
+    "Anton Paar ConsumerTec GmbH\000"
+    "Knit Sound Company\000\000"
+    "Australis Scientific Pty Ltd.\000"
+    "AIR PRODUCTS AND CHEMICALS, I\000"
+    "SYSTEM LOCO LTD\000"
+    "24x8, LLC\000"
+    "FUTURE INTELLIGENCE TECHNOLOG\000"
+    "M3SH TECHNOLOGY INC.\000\000"
+    "Matisse Interactif inc.\000"
+    "Sesame AI, Inc.\000"
+    "DEER MANAGEMENT SYSTEMS, LLC\000\000"
+    "Grayhill Inc.\000";
@@ -0,0 +1,76 @@
+#include "class_rules.h"
+
+void ClassRuleSet::clear() {
+    rules.clear();
+    svcCount = 0;
+}
+
+uint16_t ClassRuleSet::svcBit(uint16_t uuid) {
+    for (uint8_t i = 0; i < svcCount; i++) {
+        if (svcUuids[i] == uuid) return (uint16_t)(1u << i);
+    }
+    if (svcCount >= CLASS_SVC_SLOTS) return 0;
+    svcUuids[svcCount] = uuid;
+    return (uint16_t)(1u << svcCount++);
+}
+
+bool ClassRuleSet::add(const ClassRule& r) {
+    if (rules.size() >= CLASS_MAX_RULES || r.nCond > CLASS_RULE_MAX_CONDS) return false;
+    for (uint8_t i = 0; i < r.nCond; i++) {
+        if (r.cond[i].feature >= CF_COUNT || r.cond[i].op > CO_ANY) return false;
+    }
+    rules.push_back(r);
+    return true;
+}
+
+uint16_t ClassRuleSet::svcMask(const uint16_t* uuids, size_t n) const {
+    uint16_t mask = 0;
+    for (size_t u = 0; u < n; u++) {
+        for (uint8_t i = 0; i < svcCount; i++) {
+            if (svcUuids[i] == uuids[u]) mask |= (uint16_t)(1u << i);
+        }
+    }
+    return mask;
+}
+
+static inline bool test(const ClassCond& c, uint16_t x) {
+    switch (c.op) {
+        case CO_EQ:  return x == c.value;
+        case CO_NE:  return x != c.value;
+        case CO_GE:  return x >= c.value;
+        case CO_LE:  return x <= c.value;
+        default:     return (x & c.value) != 0;
+    }
+}
+
+ClassOutcome ClassRuleSet::evaluate(ClassFeatures& f, const KeywordMatcher& companyKw,
+                                    const KeywordMatcher& nameKw) const {
+    ClassOutcome out;
+    for (size_t r = 0; r < rules.size(); r++) {
+        const ClassRule& rule = rules[r];
+        bool match = true;
+        for (uint8_t i = 0; i < rule.nCond && match; i++) match = test(rule.cond[i], f.v[rule.cond[i].feature]);
+        if (!match) continue;
+
+        if (out.fired < CLASS_MAX_FIRED) out.firedRule[out.fired] = (uint8_t)r;
+        out.fired++;
+        if (rule.flags & CR_DROP) { out.drop = true; break; }
+
+        uint8_t category = rule.category, priority = rule.priority;
+        if (rule.source == CS_COMPANY_KEYWORD && f.companyKw >= 0) {
+            category = companyKw.info(f.companyKw).category;
+            priority = companyKw.info(f.companyKw).priority;
+        } else if (rule.source == CS_NAME_KEYWORD && f.nameKw >= 0) {
+            category = nameKw.info(f.nameKw).category;
+            priority = nameKw.info(f.nameKw).priority;
+        }
+        if (category != CLASS_KEEP) f.v[CF_CATEGORY] = category;
+        if (priority != CLASS_KEEP) {
+            f.v[CF_PRIORITY] = (rule.flags & CR_PRIORITY_MAX) && f.v[CF_PRIORITY] > priority ? f.v[CF_PRIORITY] : priority;
+        }
+        if (rule.flags & CR_RELEVANCE_FROM_PRI) f.v[CF_RELEVANCE] = (priority != CLASS_KEEP && priority >= 4) ? REL_HIGH : REL_MEDIUM;
+        else if (rule.relevance != CLASS_KEEP)  f.v[CF_RELEVANCE] = rule.relevance;
+        if (rule.flags & CR_STOP) break;
+    }
+    return out;
+}
@@ -0,0 +1,139 @@
+#include "follower_tracker.h"
+#include <algorithm>
+#include <vector>
+
+// ── Sketch state ──────────────────────────────────────────────────────────
+// Space-Saving: `count` over-estimates a MAC's buckets by at most `error`
+// (the count of the slot it displaced), so count - error is a safe lower
+// bound and is what the score uses.
+
+struct FollowerSlot {
+    uint8_t  mac[6];
+    bool     isBLE;
+    int8_t   rssi;
+    uint32_t count;                 // buckets present (estimate), 0 = empty slot
+    uint32_t error;                 // over-estimate inherited on replacement
+    uint32_t firstBucket;
+    uint32_t lastBucket;
+    uint32_t lastSeenMs;
+    char     vendor[FOLLOWER_VENDOR_LEN];
+};
+
+static portMUX_TYPE followerMux = portMUX_INITIALIZER_UNLOCKED;
+static FollowerSlot slots[FOLLOWER_SLOTS];
+static uint32_t seenBits[FOLLOWER_SEEN_BITS / 32];   // MAC hashes already counted this bucket
+static uint32_t seenBucket = UINT32_MAX;
+
+static inline uint32_t bucketOf(uint32_t ms) { return ms / (FOLLOWER_BUCKET_SEC * 1000UL); }
+
+static bool parseMac(const String& s, uint8_t out[6]) {
+    int n = 0, nibbles = 0;
+    uint8_t cur = 0;
+    for (size_t i = 0; i < s.length() && n < 6; i++) {
+        char c = s[i];
+        int v;
+        if (c >= '0' && c <= '9')      v = c - '0';
+        else if (c >= 'a' && c <= 'f') v = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') v = c - 'A' + 10;
+        else continue;
+        cur = (cur << 4) | v;
+        if (++nibbles == 2) { out[n++] = cur; cur = 0; nibbles = 0; }
+    }
+    return n == 6;
+}
+
+// FNV-1a over the six bytes, folded to a bitmap index
+static uint16_t macHash(const uint8_t mac[6]) {
+    uint32_t h = 2166136261UL;
+    for (int i = 0; i < 6; i++) { h ^= mac[i]; h *= 16777619UL; }
+    return (uint16_t)((h ^ (h >> 16)) % FOLLOWER_SEEN_BITS);
+}
+
+static inline uint32_t lowerBound(const FollowerSlot& s) { return s.count > s.error ? s.count - s.error : 0; }
+
+static uint8_t scoreOf(const FollowerSlot& s, uint32_t nowBucket) {
+    uint32_t est = lowerBound(s);
+    uint32_t elapsed = nowBucket - s.firstBucket + 1;
+    uint32_t span = s.lastBucket - s.firstBucket + 1;
+    float presence = (float)est / (float)elapsed;
+    float weight = std::min(1.0f, (float)span / FOLLOWER_FULL_SPAN);
+    return (uint8_t)constrain((int)(presence * weight * 100.0f + 0.5f), 0, 100);
+}
+
+void followerRecord(const String& mac, const String& vendor, int8_t rssi, bool isBLE) {
+    uint8_t key[6];
+    if (!parseMac(mac, key)) return;
+    uint32_t now = millis();
+    uint32_t bucket = bucketOf(now);
+
+    portENTER_CRITICAL(&followerMux);
+    if (bucket != seenBucket) {
+        memset(seenBits, 0, sizeof(seenBits));
+        seenBucket = bucket;
+    }
+    // Later sightings in the bucket only refresh a slot the MAC already holds:
+    // letting them displace the minimum would raise it once per sighting, not
+    // once per bucket, and bury real followers under passers-by
+    uint16_t h = macHash(key);
+    bool repeat = seenBits[h / 32] & (1UL << (h % 32));
+    seenBits[h / 32] |= 1UL << (h % 32);
+
+    int match = -1, minIdx = 0;
+    for (int i = 0; i < FOLLOWER_SLOTS; i++) {
+        if (slots[i].count && memcmp(slots[i].mac, key, 6) == 0) { match = i; break; }
+        if (slots[i].count < slots[minIdx].count) minIdx = i;
+    }
+    if (match >= 0) {
+        FollowerSlot& s = slots[match];
+        if (s.lastBucket != bucket) { s.count++; s.lastBucket = bucket; }
+        s.rssi = rssi;
+        s.lastSeenMs = now;
+    } else if (!repeat) {
+        // Empty slot (count 0) or the minimum — either way the newcomer inherits it
+        FollowerSlot& s = slots[minIdx];
+        s.error = s.count;
+        s.count = s.count + 1;
+        memcpy(s.mac, key, 6);
+        s.isBLE = isBLE;
+        s.rssi = rssi;
+        s.firstBucket = bucket;
+        s.lastBucket = bucket;
+        s.lastSeenMs = now;
+        strncpy(s.vendor, vendor.c_str(), FOLLOWER_VENDOR_LEN - 1);
+        s.vendor[FOLLOWER_VENDOR_LEN - 1] = '\0';
+    }
+    portEXIT_CRITICAL(&followerMux);
+}
+
+int followerTop(FollowerInfo* out, int max) {
+    std::vector<FollowerSlot> snap(FOLLOWER_SLOTS);   // too big for a task stack; allocated outside the lock
+    portENTER_CRITICAL(&followerMux);
+    memcpy(snap.data(), slots, sizeof(slots));
+    portEXIT_CRITICAL(&followerMux);
+
+    uint32_t nowBucket = bucketOf(millis());
+    struct Ranked { uint16_t idx; uint8_t score; };
+    Ranked ranked[FOLLOWER_SLOTS];
+    int n = 0;
+    for (int i = 0; i < FOLLOWER_SLOTS; i++) {
+        if (!snap[i].count || lowerBound(snap[i]) < FOLLOWER_MIN_BUCKETS) continue;
+        ranked[n++] = { (uint16_t)i, scoreOf(snap[i], nowBucket) };
+    }
+    std::sort(ranked, ranked + n, [](const Ranked& a, const Ranked& b) { return a.score > b.score; });
+
+    int written = std::min(n, max);
+    for (int i = 0; i < written; i++) {
+        const FollowerSlot& s = snap[ranked[i].idx];
+        FollowerInfo& f = out[i];
+        snprintf(f.mac, sizeof(f.mac), "%02X:%02X:%02X:%02X:%02X:%02X",
+                 s.mac[0], s.mac[1], s.mac[2], s.mac[3], s.mac[4], s.mac[5]);
+        memcpy(f.vendor, s.vendor, FOLLOWER_VENDOR_LEN);
+        f.score        = ranked[i].score;
+        f.isBLE        = s.isBLE;
+        f.lastRssi     = s.rssi;
+        f.buckets      = (uint16_t)std::min(lowerBound(s), (uint32_t)UINT16_MAX);
+        f.firstSeenSec = s.firstBucket * FOLLOWER_BUCKET_SEC;
+        f.lastSeenSec  = s.lastSeenMs / 1000;
+    }
+    return written;
+}
@@ -0,0 +1,123 @@
+#include "keyword_matcher.h"
+#include <string.h>
+#include <algorithm>
+
+static inline uint8_t fold(uint8_t c) { return (c >= 'a' && c <= 'z') ? (uint8_t)(c - 32) : c; }
+
+void KeywordMatcher::clear() {
+    patterns.clear();
+    nodes.clear();
+    edges.clear();
+    memset(rootNext, 0, sizeof(rootNext));
+}
+
+bool KeywordMatcher::add(const char* keyword, uint8_t category, uint8_t priority) {
+    size_t len = keyword ? strlen(keyword) : 0;
+    if (len == 0 || len > KEYWORD_MAX_LEN || patterns.size() >= KEYWORD_MAX_PATTERNS) return false;
+    KeywordInfo k;
+    memcpy(k.keyword, keyword, len + 1);
+    k.category = category;
+    k.priority = priority;
+    patterns.push_back(k);
+    return true;
+}
+
+// ── Build ─────────────────────────────────────────────────────────────────
+// Trie first (temporary per-node child lists), then renumber in BFS order so
+// every node's fail target has a smaller ID and is finished before it, then
+// flatten children into one sorted edge array.
+
+void KeywordMatcher::build() {
+    struct TmpNode {
+        std::vector<std::pair<uint8_t, uint16_t>> kids;
+        uint16_t pattern = 0;       // lowest pattern index ending here, +1
+    };
+    std::vector<TmpNode> trie(1);
+    for (size_t p = 0; p < patterns.size(); p++) {
+        uint16_t n = 0;
+        for (const char* s = patterns[p].keyword; *s; s++) {
+            uint8_t c = fold((uint8_t)*s);
+            uint16_t next = 0;
+            for (auto& kid : trie[n].kids) if (kid.first == c) { next = kid.second; break; }
+            if (!next) {
+                next = (uint16_t)trie.size();
+                trie[n].kids.push_back({c, next});
+                trie.emplace_back();
+            }
+            n = next;
+        }
+        if (!trie[n].pattern) trie[n].pattern = (uint16_t)(p + 1);    // duplicate keyword: first wins
+    }
+
+    std::vector<uint16_t> order;        // BFS order: new ID -> trie ID
+    std::vector<uint16_t> remap(trie.size());
+    order.reserve(trie.size());
+    order.push_back(0);
+    for (size_t i = 0; i < order.size(); i++) {
+        auto& kids = trie[order[i]].kids;
+        std::sort(kids.begin(), kids.end());
+        for (auto& kid : kids) { remap[kid.second] = (uint16_t)order.size(); order.push_back(kid.second); }
+    }
+
+    nodes.assign(trie.size(), Node());
+    edges.clear();
+    edges.reserve(trie.size() - 1);
+    for (size_t i = 0; i < order.size(); i++) {
+        const TmpNode& t = trie[order[i]];
+        Node& n = nodes[i];
+        n.firstEdge = (uint16_t)edges.size();
+        n.edgeCount = (uint16_t)t.kids.size();
+        n.fail = 0;
+        n.out = t.pattern;
+        for (auto& kid : t.kids) edges.push_back({kid.first, remap[kid.second]});
+    }
+
+    memset(rootNext, 0, sizeof(rootNext));
+    for (uint16_t e = 0; e < nodes[0].edgeCount; e++) rootNext[edges[e].ch] = edges[e].next;
+
+    // Fail links and merged outputs, parents before children (BFS order).
+    // A node's output is the best of its own pattern and its fail target's,
+    // so matching never has to walk the suffix chain.
+    for (size_t i = 0; i < nodes.size(); i++) {
+        const Node& n = nodes[i];
+        for (uint16_t e = n.firstEdge; e < n.firstEdge + n.edgeCount; e++) {
+            Node& child = nodes[edges[e].next];
+            child.fail = i ? step(n.fail, edges[e].ch) : 0;
+            uint16_t inherited = nodes[child.fail].out;
+            if (inherited && (!child.out || inherited < child.out)) child.out = inherited;
+        }
+    }
+}
+
+// ── Match ─────────────────────────────────────────────────────────────────
+
+uint16_t KeywordMatcher::step(uint16_t state, uint8_t c) const {
+    while (state) {
+        const Node& n = nodes[state];
+        const Edge* first = &edges[n.firstEdge];
+        const Edge* last = first + n.edgeCount;
+        const Edge* it = std::lower_bound(first, last, c, [](const Edge& e, uint8_t ch) { return e.ch < ch; });
+        if (it != last && it->ch == c) return it->next;
+        state = n.fail;
+    }
+    return rootNext[c];
+}
+
+int KeywordMatcher::match(const char* text, size_t len) const {
+    if (nodes.empty() || !text) return -1;
+    uint16_t state = 0;
+    uint16_t best = 0;
+    for (size_t i = 0; i < len; i++) {
+        state = step(state, fold((uint8_t)text[i]));
+        uint16_t out = nodes[state].out;
+        if (out && (!best || out < best)) {
+            best = out;
+            if (best == 1) break;           // table-order winner, nothing can beat it
+        }
+    }
+    return (int)best - 1;
+}
+
+int KeywordMatcher::match(const char* text) const {
+    return text ? match(text, strlen(text)) : -1;
+}
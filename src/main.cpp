@@ -31,6 +31,18 @@
 #include "oui_database.h"
 #include "wifi_promiscuous.h"
 #include "web_portal.h"
+#include "session_index.h"
+#include "follower_tracker.h"
+#include "priority_bin.h"
+#include "oui_key.h"
+#include "keyword_matcher.h"
+#include "class_rules.h"
+#include "bt_company_table.h"
+#include "ble_adv.h"
+#include "radio_scheduler.h"
+#include "target_tracker.h"
+#include "portal_latency.h"
+#include "scan_profile.h"
 
 // Web Portal AP Configuration
 #define AP_SSID     "OUI-SPY-PRO"
@@ -38,6 +50,40 @@
 #define AP_CHANNEL  6
 #define AP_MAX_CONN 4
 
+// Continuous BLE scan. The controller drops repeat adverts from a device
+// until its duplicate cache is flushed; flushing every scan cycle gives each
+// device one fresh sighting (RSSI update) per cycle, like the old 2 s scans.
+#define BLE_SCAN_MS_MIN           3     // controller limits: 2.5 ms ..
+#define BLE_SCAN_MS_MAX           10240 //                    10.24 s
+#define BLE_DUP_CACHE_SIZE        200   // devices remembered by the controller filter
+
+// WiFi hop pass: the scan profile's base dwell, 1/6/11 doubled = 16 shares
+// (2.4 s on NORMAL). Adaptive dwell redistributes the same budget by yield.
+#define HOP_PASS_SHARES           16
+#define HOP_EXPLORE_PCT_DEFAULT   25    // share of the budget spread evenly over all channels
+
+// AP-aware hopping: with hotspot clients connected the hopper comes back to
+// AP_CHANNEL at least every hopAwayMs and holds there HOP_HOME_HOLD_MS.
+// hopAwayMs starts at half the dashboard P95 target and is adapted against
+// the latency the dashboard reports.
+#define HOP_HOME_HOLD_MS          60
+#define HOP_AWAY_MIN_MS           100
+#define HOP_AWAY_MAX_MS           2400  // one default pass: no returns at all
+#define PORTAL_P95_DEFAULT_MS     800
+#define PORTAL_P95_MIN_MS         200
+#define PORTAL_P95_MAX_MS         10000
+#define PORTAL_P95_MIN_SAMPLES    8     // refreshes needed before the bound moves
+
+// Target lock: readings go out at ~15 Hz; a BLE target gets the whole
+// scan interval as window (the controller list already drops the rest)
+#define TRACK_REPORT_MS           66
+#define TRACK_BLE_SCAN_MS         100
+#define TRACK_SHARE_PASS_MS       1000  // WiFi lock shared with hotspot clients: target time per pass
+
+// Detection log lines are buffered and written at the scan profile's
+// logFlushMs; a busy area flushes early once this much is pending
+#define LOG_BUFFER_MAX            4096
+
 // ============================================================
 // HARDWARE PIN DEFINITIONS
 // ============================================================
@@ -125,40 +171,192 @@ XPT2046_Touchscreen touchscreen(XPT2046_CS, XPT2046_IRQ);
 // ============================================================
 
 // UI Screens
-enum Screen { SCREEN_WIZARD, SCREEN_MAIN, SCREEN_RADAR, SCREEN_SETTINGS, SCREEN_INFO };
+enum Screen { SCREEN_WIZARD, SCREEN_MAIN, SCREEN_RADAR, SCREEN_SETTINGS, SCREEN_INFO, SCREEN_TRACK };
 Screen currentScreen = SCREEN_WIZARD;
 
-enum ScanMode { SCAN_QUICK = 0, SCAN_NORMAL = 1, SCAN_POWER_SAVE = 2 };
 enum AlertMode { ALERT_SILENT = 0, ALERT_LED = 1, ALERT_VIBRATE = 2 };
 
+// Correlation groups are interned to small integer IDs when the priority DB
+// loads. ID 0 means "no group"; rules and detections carry IDs, and group
+// sets are uint64_t bitsets, so evaluation never touches a String.
+// Each priority table has its own registry, filled while it is built and
+// read-only once published, so a reload that renames groups starts from an
+// empty registry. IDs are only meaningful against the table that issued them:
+// publishPriorityTable() moves the live state onto the new IDs by name.
+#define MAX_CORRELATION_GROUPS 64
+#define CORRELATION_GROUP_LEN  24
+typedef uint64_t GroupMask;
+
+struct CorrelationGroups {
+    char names[MAX_CORRELATION_GROUPS][CORRELATION_GROUP_LEN];  // ID -> name, [0] = ""
+    uint8_t count = 1;                                          // IDs in use, including 0
+
+    CorrelationGroups() { names[0][0] = '\0'; }
+
+    // ID for `name`, adding it if new; 0 for "" or when the registry is full
+    uint8_t intern(const char* name) {
+        if (!name || !*name) return 0;
+        uint8_t id = find(name);
+        if (id) return id;
+        if (count >= MAX_CORRELATION_GROUPS) {
+            Serial.printf("[WARN] Correlation group table full — '%s' ignored\n", name);
+            return 0;
+        }
+        id = count++;
+        strncpy(names[id], name, CORRELATION_GROUP_LEN - 1);
+        names[id][CORRELATION_GROUP_LEN - 1] = '\0';
+        return id;
+    }
+    uint8_t find(const char* name) const {
+        for (uint8_t i = 1; i < count; i++) {
+            if (strncmp(names[i], name, CORRELATION_GROUP_LEN - 1) == 0) return i;
+        }
+        return 0;
+    }
+    const char* name(uint8_t id) const { return id < count ? names[id] : ""; }
+};
+
+static inline GroupMask groupBit(uint8_t id) { return id ? (GroupMask)1 << id : 0; }
+
 // Priority entry loaded from priority.json
 // Uses char[] instead of String to avoid 732 separate heap allocations for 183 entries.
-// The entire priorityDB vector becomes one contiguous block — no fragmentation.
+// The whole PriorityTable::entries vector becomes one contiguous block — no fragmentation.
+// "oui" is a 24-bit OUI ("AA:BB:CC") or a 28/36-bit MA-M/MA-S prefix
+// ("AA:BB:CC:D", "AA:BB:CC:DD:E"); the longest matching prefix wins.
 struct PriorityEntry {
-    char oui[9];
+    uint64_t key;             // prefix key (mac >> (48 - bits)), filled by PriorityTable::index()
+    uint8_t bits;             // 24, 28 or 36; 0 = invalid
+    char oui[14];
     char label[32];
     char context[48];
-    char correlationGroup[24];
+    uint8_t groupId;          // interned correlation group, 0 = none
     int priority;
     float confidence;
-    PriorityEntry() { oui[0]=0; label[0]=0; context[0]=0; correlationGroup[0]=0; priority=0; confidence=0.0f; }
-    PriorityEntry(const char* o, const char* l, const char* c, const char* g, int p, float f) {
-        strncpy(oui, o, 8);  oui[8]=0;
+    PriorityEntry() { key=MAC_KEY_INVALID; bits=0; oui[0]=0; label[0]=0; context[0]=0; groupId=0; priority=0; confidence=0.0f; }
+    PriorityEntry(const char* o, const char* l, const char* c, uint8_t g, int p, float f) {
+        key = MAC_KEY_INVALID; bits = 0;
+        strncpy(oui, o, 13); oui[13]=0;
         strncpy(label, l, 31); label[31]=0;
         strncpy(context, c, 47); context[47]=0;
-        strncpy(correlationGroup, g, 23); correlationGroup[23]=0;
+        groupId = g;
         priority=p; confidence=f;
     }
 };
 
-// Correlation rule loaded from priority.json
+// Correlation rule loaded from priority.json, compiled to group bitsets.
+// Fires when ALL of:
+//   - every group in allMask has at least one device          ("all_groups")
+//   - no group in excludeMask has any device                   ("exclude_groups")
+//   - each (minGroup[i], minCount[i]) pair is met              ("group_min")
+//   - devices summed across anyMask >= minDevices              ("required_groups" / "min_devices")
+//   - decayed evidence summed across anyMask >= minScore       ("min_score", optional)
+// With "window_sec" set, every count above means "distinct devices seen in the
+// last window_sec seconds" instead of "devices currently in the table".
+#define RULE_MAX_GROUP_MINS 4
 struct CorrelationRule {
     String id;
     String name;
     String description;
-    std::vector<String> requiredGroups;
-    int minDevices;
+    GroupMask anyMask = 0;
+    GroupMask allMask = 0;
+    GroupMask excludeMask = 0;
+    uint8_t minGroup[RULE_MAX_GROUP_MINS];
+    uint8_t minCount[RULE_MAX_GROUP_MINS];
+    uint8_t minPairs = 0;
+    int minDevices = 0;
+    uint16_t windowSec = 0;   // 0 = live table counts
+    int8_t windowIdx = -1;    // slot in the window table, assigned by rebuildCorrelationIndex()
+    float minScore = 0.0f;    // 0 = no evidence threshold
     String alertLevel;
+    uint8_t alertTier = 0;    // 5 = CRITICAL, 4 = HIGH, 0 = no LED — precomputed from alertLevel
+
+    // Every group this rule reads — used to index rules by group
+    GroupMask touchedMask() const {
+        GroupMask m = anyMask | allMask | excludeMask;
+        for (uint8_t i = 0; i < minPairs; i++) m |= groupBit(minGroup[i]);
+        return m;
+    }
+    // A rule with no positive condition would fire on an empty table.
+    // group_min pairs with a count of 0 are dropped at load, and
+    // required_groups only counts with min_devices >= 1.
+    bool hasCondition() const { return allMask || minPairs || (anyMask && minDevices > 0); }
+    void setAlertLevel(const String& level) {
+        alertLevel = level;
+        alertTier = (level == "CRITICAL") ? 5 : (level == "HIGH") ? 4 : 0;
+    }
+};
+
+// Pre-resolved classification for one prefix: the compiled OUI table and the
+// priority entry merged with checkOUI()'s precedence already applied
+// (priority entry over OUI table; category inferred from the group when the
+// OUI table has none). Strings and confidence stay behind the two pointers.
+struct ClassRecord {
+    const OUIEntry* oui;          // compiled OUI_DATABASE entry, or nullptr
+    const PriorityEntry* pri;     // priority DB entry, or nullptr
+    uint8_t category;             // DeviceCategory
+    uint8_t relevance;            // RelevanceLevel
+    uint8_t deployment;           // DeploymentType
+    uint8_t priority;
+    uint8_t groupId;
+
+    const char* manufacturer() const { return pri ? pri->label : oui->manufacturer; }
+    const char* context() const      { return pri ? pri->context : ""; }
+    float confidence() const         { return pri ? pri->confidence : 0.0f; }
+};
+
+// One complete priority database: entries, classification index and
+// compiled rules. Built off to the side (boot or hot reload) and published
+// with a pointer swap; readers that run outside xDetectionMutex hold a
+// reference so a retired table is freed only once the last of them lets go.
+//
+// The index is a flat array of packed 24-bit OUI keys parallel to `classes`
+// (both sorted by key), covering every OUI in the compiled table and the
+// priority DB: a lookup is one branchless binary search over contiguous
+// integers and yields the fully merged record. Priority entries for MA-M /
+// MA-S blocks sit in two more tiers of the same shape, searched longest
+// first — at most three binary searches per MAC, and the long tiers are
+// skipped outright while empty (the usual case).
+struct PrefixTier {
+    std::vector<uint64_t> keys;               // mac >> (48 - bits), ascending
+    std::vector<ClassRecord> classes;
+};
+
+struct PriorityTable {
+    std::vector<PriorityEntry> entries;       // sorted by (bits, key), duplicates removed
+    std::vector<uint32_t> keys;               // 24-bit tier: ascending, parallel to classes
+    std::vector<ClassRecord> classes;
+    PrefixTier tier28, tier36;                // MA-M / MA-S priority entries
+    std::vector<CorrelationRule> rules;
+    KeywordMatcher bleKeywords;               // BT company name -> category/priority
+    KeywordMatcher ssidKeywords;              // SSID -> category/priority
+    KeywordMatcher groupKeywords;             // correlation group name -> category
+    ClassRuleSet classRules;                  // per-frame classification heuristics
+    CorrelationGroups groups;                 // group IDs used by entries and rules
+    const char* source = "static";
+    int refs = 1;                             // the published slot holds one
+
+    void index();                             // build keys/classes once entries are loaded
+
+    const ClassRecord* find(uint32_t key) const {
+        int i = ouiKeyFind(keys.data(), keys.size(), key);
+        return i >= 0 ? &classes[i] : nullptr;
+    }
+    // Longest-prefix match of a full 48-bit MAC; `bits` gets the length matched
+    const ClassRecord* findMac(uint64_t mac, uint8_t* bits = nullptr) const {
+        if (mac == MAC_KEY_INVALID) return nullptr;
+        const ClassRecord* rec = nullptr;
+        uint8_t len = 0;
+        int i;
+        if      ((i = prefixKeyFind(tier36.keys.data(), tier36.keys.size(), mac >> 12)) >= 0) { rec = &tier36.classes[i]; len = 36; }
+        else if ((i = prefixKeyFind(tier28.keys.data(), tier28.keys.size(), mac >> 20)) >= 0) { rec = &tier28.classes[i]; len = 28; }
+        else if ((rec = find((uint32_t)(mac >> 24))))                                           len = 24;
+        if (bits) *bits = len;
+        return rec;
+    }
+    const PriorityEntry* findPriority(uint64_t mac) const {
+        const ClassRecord* rec = findMac(mac);
+        return rec ? rec->pri : nullptr;
+    }
 };
 
 // Active correlation alert
@@ -170,25 +368,65 @@ struct CorrelationAlert {
 };
 
 // BLE extra data extracted from advertisement packet
+#define BLE_META_MAX_UUIDS BLE_ADV_MAX_UUID16
 struct BLEMeta {
     String company;      // from manufacturer specific data (2-byte BT SIG company ID)
     String svcHint;      // classified from 16-bit service UUIDs
+    uint16_t companyId = CLASS_NO_COMPANY;
+    uint16_t svcUuids[BLE_META_MAX_UUIDS];   // 16-bit service UUIDs, for the rule table
+    uint8_t svcCount = 0;
     int8_t txPower = 0;
     bool hasTxPower = false;
     bool publicAddr = false;   // true = public/OUI-resolvable, false = random
 };
 
+// One raw sighting from a radio callback. BLE and WiFi callbacks run in the
+// NimBLE host and WiFi driver tasks concurrently; they only fill one of
+// these and queue it. ScanTask drains the queue and does every lookup (SD,
+// caches, priority table) on its own, so nothing classification-side has to
+// be re-entrant and no radio task ever waits on the SD card.
+#define SIGHTING_QUEUE_LEN 96
+#define SIGHTING_NAME_LEN  32
+struct Sighting {
+    uint8_t  mac[6];            // transmit order (MSB first)
+    int8_t   rssi;
+    uint8_t  channel;           // WiFi channel (the AP's own for beacons), 0 = BLE
+    uint8_t  rxChannel;         // WiFi channel the frame was received on, 0 = BLE
+    bool     isBLE;
+    bool     fromAP;            // WiFi beacon / probe response
+    bool     hopStep;           // WiFi: heard during a hop step, not while parked
+    bool     publicAddr;
+    bool     hasTxPower;
+    int8_t   txPower;
+    uint16_t companyId;         // CLASS_NO_COMPANY if none
+    uint8_t  svcCount;
+    uint16_t svcUuids[BLE_META_MAX_UUIDS];
+    char     name[SIGHTING_NAME_LEN + 1];   // BLE local name / SSID
+};
+QueueHandle_t sightingQueue = nullptr;
+
+// Lock / unlock requests from the web and UI tasks. ScanTask owns the
+// radios, so it applies them; a newer request overwrites a pending one.
+struct TrackRequest {
+    bool     stop;
+    uint8_t  mac[6];
+    bool     isBLE;
+    uint8_t  channel;
+};
+QueueHandle_t trackQueue = nullptr;
+
 // Forward-declared here so SD lookup functions can reference it before the global block
 bool sdCardAvailable = false;
 
-// Bluetooth SIG assigned company IDs (most common consumer/surveillance relevant)
 // ── BT SIG company lookup ─────────────────────────────────────────────────
-// Primary: SD /btcompany.bin binary search (32-byte records: 2-byte LE ID + 30-byte name)
-// Fallback: small RAM table for the most common devices when SD unavailable
+// Primary: dense flash table compiled into the firmware (bt_company_table.h),
+// one array index per lookup.
+// Fallback: SD /btcompany.bin binary search (32-byte records: 2-byte LE ID +
+// 30-byte name), only for IDs newer than the compiled table.
 #define BT_RECORD_SIZE 32
 #define BT_NAME_SIZE   30
 
-std::map<uint16_t, String> btCache;  // LRU cache, max 64 entries
+std::map<uint16_t, String> btCache;  // SD results (hits and misses), max 64 entries
 
 String sdLookupBTCompany(uint16_t companyId) {
     if (!sdCardAvailable) return "";
@@ -223,25 +461,10 @@ String sdLookupBTCompany(uint16_t companyId) {
     return result;
 }
 
-// RAM fallback — most common BLE manufacturers
-struct BTCompany { uint16_t id; const char* name; };
-static const BTCompany BT_COMPANY_DB[] = {
-    {0x0002,"Intel"},        {0x0006,"Microsoft"},  {0x000F,"Broadcom"},
-    {0x0013,"Texas Instr."}, {0x0019,"Qualcomm"},   {0x0024,"STMicro"},
-    {0x0046,"Parrot"},       {0x0059,"Nordic Semi"},{0x0075,"Samsung"},
-    {0x004C,"Apple"},        {0x00E0,"Google"},     {0x011B,"Amazon"},
-    {0x0138,"Xiaomi"},       {0x02E5,"Espressif"},  {0x1049,"DJI Drone"},
-};
-static const int BT_COMPANY_COUNT = sizeof(BT_COMPANY_DB)/sizeof(BT_COMPANY_DB[0]);
-
 String lookupBTCompany(uint16_t id) {
-    // SD first, then RAM fallback
-    String sdResult = sdLookupBTCompany(id);
-    if (!sdResult.isEmpty()) return sdResult;
-    for (int i = 0; i < BT_COMPANY_COUNT; i++) {
-        if (BT_COMPANY_DB[i].id == id) return String(BT_COMPANY_DB[i].name);
-    }
-    return "";
+    const char* name = btCompanyName(id);
+    if (name) return String(name);
+    return sdLookupBTCompany(id);
 }
 
 // Map common 16-bit BLE service UUIDs to human-readable device type hints
@@ -286,7 +509,9 @@ struct Detection {
     String bleCompany;     // BT SIG company (from manufacturer specific data)
     String bleSvcHint;     // classified from service UUIDs
     String context;
-    String correlationGroup;
+    uint8_t groupId = 0;      // interned correlation group, 0 = none
+    uint8_t windowGroup = 0;  // group and absolute bucket this device is counted under
+    uint32_t windowBucket = 0;//   in the correlation time windows (windowGroup 0 = not counted)
     DeviceCategory category;
     RelevanceLevel relevance;
     int priority;
@@ -305,7 +530,7 @@ struct Detection {
 };
 
 struct Config {
-    ScanMode scanMode = SCAN_NORMAL;
+    ScanMode scanMode = SCAN_NORMAL;                    // scan profile: cycle, duty, dwell, cadences
     AlertMode alertMode = ALERT_LED;
     bool enableBLE = true;
     bool enableWiFi = true;
@@ -316,6 +541,13 @@ struct Config {
     char apPassword[20]    = "spypro2026";       // web portal hotspot password (8-19 chars)
     bool setupComplete = false;
     int sleepTimeout = 1800;  // seconds — default 30 min, persisted in NVS
+    uint8_t radioShare = RADIO_SHARE_BALANCED;          // RadioShare coexistence policy
+    bool hopAdaptive = true;                            // dwell follows per-channel yield
+    uint8_t hopExplorePct = HOP_EXPLORE_PCT_DEFAULT;
+    uint16_t portalP95Ms = PORTAL_P95_DEFAULT_MS;       // dashboard refresh latency target
+    bool wifiActiveScan = false;                        // also run the blocking scanNetworks() sweep
+    uint16_t bleIntervalMs = 0;                         // user's BLE timing, 0 = the scan profile's
+    uint16_t bleWindowMs   = 0;                         // <= bleIntervalMs
     // Touch calibration — Fr4nkFletcher CYD_28 validated defaults
     int calXMin = TOUCH_CAL_X_MIN_DEFAULT;
     int calXMax = TOUCH_CAL_X_MAX_DEFAULT;
@@ -331,12 +563,11 @@ TFT_eSPI tft = TFT_eSPI();
 Config config;
 Preferences preferences;
 std::vector<Detection> detections;
-std::vector<PriorityEntry> priorityDB;
-std::vector<CorrelationRule> correlationRules;
+PriorityTable* priorityTable = nullptr;   // published table — swap under xDetectionMutex
 std::vector<CorrelationAlert> activeAlerts;
-std::map<String, PriorityEntry*> priorityLookup;  // OUI -> PriorityEntry
 SemaphoreHandle_t xDetectionMutex;
 AsyncWebServer webServer(80);
+AsyncEventSource trackEvents("/api/track/events");   // target-lock readings (SSE)
 DNSServer dnsServer;
 bool webPortalActive = false;
 
@@ -344,61 +575,182 @@ const int MAX_DETECTIONS = 50;
 const int MAX_ALERTS = 5;
 unsigned long lastScanTime = 0;
 unsigned long lastInteractionTime = 0;
-int scanInterval = 5000;
 bool scanning = false;
 bool scanPaused = false;
 char sessionId[10] = "----";      // generated at boot from esp_random()
 char sessionLogPath[32] = "/detections.csv";  // set to /sessions/XXXX-XXXX.csv after SD init
+String logBuffer;                 // CSV lines awaiting flushDetectionLog() — guarded by xDetectionMutex
+struct LoggedRow { String mac; String vendor; int priority; };
+std::vector<LoggedRow> logRows;   // catalogue entries for logBuffer's lines, same guard
 char wifiSsid[64] = "";           // loaded from /wifi.txt on SD card
 char wifiPass[64] = "";
 bool staCredentialsFound = false;
 
+// BLE scan timing in force: the user's own if set, else the scan profile's
+static inline uint16_t bleScanInterval() {
+    return config.bleIntervalMs ? config.bleIntervalMs : scanProfile(config.scanMode).bleIntervalMs;
+}
+static inline uint16_t bleScanWindow() {
+    return config.bleIntervalMs ? config.bleWindowMs : scanProfile(config.scanMode).bleWindowMs;
+}
+
 // ============================================================
 // SD OUI LOOKUP  (binary search on /oui.bin — 35 bytes/record)
 // Format: 4-byte LE count header + records sorted by 3-byte OUI
+//
+// Optional extension after the last record (tools/build_oui_db.py), for
+// IEEE MA-M (28-bit) and MA-S (36-bit) blocks; older firmware ignores it:
+//   "OUIX", uint32 parentCount, uint32 subCount
+//   OuiSubParent parents[parentCount]   sorted by OUI
+//   records[subCount]                   35 bytes: uint16 LE sub-prefix + 33-byte name
+// Each parent's records are its MA-M blocks (sub = 4 bits below the OUI)
+// followed by its MA-S blocks (sub = 12 bits), each run sorted by sub.
+// The parent OUIs are held in RAM as a gate, so an ordinary OUI costs no
+// extra SD read; a MAC inside a parent costs one parent read plus at most
+// 12 + 4 record probes before the MA-L search. Longest prefix wins.
 // ============================================================
 #define OUI_RECORD_SIZE 35
-std::map<String, String> ouiCache;   // lookup cache, max 64 entries
+#define OUI_EXT_MAGIC   0x5849554FUL   // "OUIX"
+struct OuiCacheEntry { String name; uint8_t bits; };
+std::map<String, OuiCacheEntry> ouiCache;   // lookup cache, max 64 entries
+
+struct OuiSubParent {
+    uint32_t oui;                    // 0x00AABBCC
+    uint32_t first;                  // index of its first record
+    uint16_t n28;                    // MA-M records, then
+    uint16_t n36;                    // MA-S records
+};
+static_assert(sizeof(OuiSubParent) == 12, "OuiSubParent is an on-card format");
+
+static std::vector<uint32_t> ouiSubParents;   // gate: OUIs with MA-M/MA-S blocks
+static uint32_t ouiExtParentsOff = 0;         // file offset of parents[]
+static uint32_t ouiExtRecordsOff = 0;         // file offset of records[]
+static bool ouiExtLoaded = false;
+
+// Forget cached names and the extension gate (card changed)
+void ouiCacheClear() {
+    ouiCache.clear();
+    ouiSubParents.clear();
+    ouiExtLoaded = false;
+}
 
-String sdLookupOUI(const String& oui) {
-    // oui must be "XX:XX:XX" uppercase 8-char string
-    if (!sdCardAvailable) return "";
+// Read the extension's parent OUIs once per mounted card (a few hundred, ~1 KB)
+static void loadOuiExtension() {
+    if (ouiExtLoaded || !sdCardAvailable) return;
+    ouiExtLoaded = true;
+    File f = SD.open("/oui.bin", FILE_READ);
+    if (!f) return;
+    uint32_t count = 0;
+    f.read((uint8_t*)&count, 4);
+    uint32_t base = 4 + count * OUI_RECORD_SIZE;
+    uint32_t hdr[3];
+    if (!f.seek(base) || f.read((uint8_t*)hdr, sizeof(hdr)) != sizeof(hdr) || hdr[0] != OUI_EXT_MAGIC) { f.close(); return; }
+    uint32_t parents = hdr[1];
+    if (!parents || base + 12 + (uint64_t)parents * sizeof(OuiSubParent) + (uint64_t)hdr[2] * OUI_RECORD_SIZE > f.size()) {
+        f.close();
+        Serial.println("[OUI-SD] WARN: /oui.bin extension truncated — 24-bit lookups only");
+        return;
+    }
+    ouiExtParentsOff = base + 12;
+    ouiExtRecordsOff = ouiExtParentsOff + parents * sizeof(OuiSubParent);
+    ouiSubParents.reserve(parents);
+    for (uint32_t i = 0; i < parents; i++) {
+        OuiSubParent p;
+        f.seek(ouiExtParentsOff + i * sizeof(p));
+        if (f.read((uint8_t*)&p, sizeof(p)) != sizeof(p)) { ouiSubParents.clear(); break; }
+        ouiSubParents.push_back(p.oui);
+    }
+    f.close();
+    Serial.printf("[OUI-SD] MA-M/MA-S blocks: %u under %u OUIs\n", (unsigned)hdr[2], (unsigned)parents);
+}
+
+// True if IEEE has carved MA-M/MA-S blocks out of `oui` (per /oui.bin)
+bool ouiHasSubBlocks(uint32_t oui) {
+    loadOuiExtension();
+    return ouiKeyFind(ouiSubParents.data(), ouiSubParents.size(), oui) >= 0;
+}
+
+// Binary search one parent's run of `n` sub-prefix records starting at `first`
+static bool sdFindSubRecord(File& f, uint32_t first, uint16_t n, uint16_t sub, String& name) {
+    int32_t lo = 0, hi = (int32_t)n - 1;
+    uint8_t rec[OUI_RECORD_SIZE];
+    while (lo <= hi) {
+        int32_t mid = (lo + hi) / 2;
+        f.seek(ouiExtRecordsOff + (first + mid) * OUI_RECORD_SIZE);
+        if (f.read(rec, OUI_RECORD_SIZE) != OUI_RECORD_SIZE) return false;
+        uint16_t key = rec[0] | (rec[1] << 8);
+        if (key == sub) {
+            rec[OUI_RECORD_SIZE - 1] = '\0';
+            name = String((char*)(rec + 2));
+            return true;
+        }
+        if (sub < key) hi = mid - 1; else lo = mid + 1;
+    }
+    return false;
+}
 
-    auto it = ouiCache.find(oui);
-    if (it != ouiCache.end()) return it->second;
+// Manufacturer for `mac` ("AA:BB:CC:DD:EE:FF", uppercase; an 8-char OUI
+// also works, MA-L only). `bits` gets the matched prefix length (0 = none).
+String sdLookupOUI(const String& mac, uint8_t* bits = nullptr) {
+    if (bits) *bits = 0;
+    if (!sdCardAvailable) return "";
 
-    uint8_t target[3];
-    target[0] = (uint8_t)strtol(oui.substring(0, 2).c_str(), nullptr, 16);
-    target[1] = (uint8_t)strtol(oui.substring(3, 5).c_str(), nullptr, 16);
-    target[2] = (uint8_t)strtol(oui.substring(6, 8).c_str(), nullptr, 16);
+    uint8_t macBits;
+    uint64_t v = macPrefix(mac.c_str(), &macBits);
+    if (macBits < 24) return "";
+    uint32_t oui24 = (uint32_t)(v >> 24);
+    // Cache key: the OUI, or the 36-bit prefix inside a sub-assigned OUI
+    bool sub = macBits >= 36 && ouiHasSubBlocks(oui24);
+    String cacheKey = mac.substring(0, sub ? 13 : 8);
+    auto it = ouiCache.find(cacheKey);
+    if (it != ouiCache.end()) {
+        if (bits) *bits = it->second.bits;
+        return it->second.name;
+    }
 
     File f = SD.open("/oui.bin", FILE_READ);
-    if (!f) { Serial.printf("[OUI-SD] ERR: /oui.bin open failed for %s\n", oui.c_str()); return ""; }
+    if (!f) { Serial.printf("[OUI-SD] ERR: /oui.bin open failed for %s\n", mac.c_str()); return ""; }
 
     uint32_t count = 0;
     f.read((uint8_t*)&count, 4);
 
     String result = "";
-    int32_t lo = 0, hi = (int32_t)count - 1;
-    uint8_t rec[OUI_RECORD_SIZE];
+    uint8_t matched = 0;
+    if (sub) {
+        int pi = ouiKeyFind(ouiSubParents.data(), ouiSubParents.size(), oui24);
+        OuiSubParent p;
+        f.seek(ouiExtParentsOff + pi * sizeof(p));
+        if (f.read((uint8_t*)&p, sizeof(p)) == sizeof(p)) {
+            if      (sdFindSubRecord(f, p.first + p.n28, p.n36, (uint16_t)((v >> 12) & 0xFFF), result)) matched = 36;
+            else if (sdFindSubRecord(f, p.first,         p.n28, (uint16_t)((v >> 20) & 0xF),   result)) matched = 28;
+        }
+    }
 
-    while (lo <= hi) {
-        int32_t mid = (lo + hi) / 2;
-        f.seek(4 + (uint32_t)mid * OUI_RECORD_SIZE);
-        if (f.read(rec, OUI_RECORD_SIZE) != OUI_RECORD_SIZE) break;
-        int cmp = memcmp(target, rec, 3);
-        if (cmp == 0) {
-            rec[OUI_RECORD_SIZE - 1] = '\0';
-            result = String((char*)(rec + 3));
-            Serial.printf("[OUI-SD] %s -> %s\n", oui.c_str(), result.c_str());
-            break;
-        } else if (cmp < 0) { hi = mid - 1; }
-        else                 { lo = mid + 1; }
+    if (!matched) {
+        uint8_t target[3] = { (uint8_t)(oui24 >> 16), (uint8_t)(oui24 >> 8), (uint8_t)oui24 };
+        int32_t lo = 0, hi = (int32_t)count - 1;
+        uint8_t rec[OUI_RECORD_SIZE];
+
+        while (lo <= hi) {
+            int32_t mid = (lo + hi) / 2;
+            f.seek(4 + (uint32_t)mid * OUI_RECORD_SIZE);
+            if (f.read(rec, OUI_RECORD_SIZE) != OUI_RECORD_SIZE) break;
+            int cmp = memcmp(target, rec, 3);
+            if (cmp == 0) {
+                rec[OUI_RECORD_SIZE - 1] = '\0';
+                result = String((char*)(rec + 3));
+                matched = 24;
+                break;
+            } else if (cmp < 0) { hi = mid - 1; }
+            else                 { lo = mid + 1; }
+        }
     }
     f.close();
+    if (matched) Serial.printf("[OUI-SD] %s -> %s (/%d)\n", cacheKey.c_str(), result.c_str(), matched);
 
     if (ouiCache.size() >= 64) ouiCache.erase(ouiCache.begin());
-    ouiCache[oui] = result;
+    ouiCache[cacheKey] = { result, matched };
+    if (bits) *bits = matched;
     return result;
 }
 
@@ -408,12 +760,23 @@ int wizardStep = 0;
 int scrollOffset = 0;
 int maxScroll = 0;
 
+// Cards drawn by the last list refresh — a long press on a card's protocol
+// badge locks on to it (a tap anywhere else still scrolls)
+struct ListCard { int16_t top; String mac; };
+std::vector<ListCard> listCards;
+#define LIST_BADGE_X        265   // protocol badge, relative to the card top
+#define LIST_BADGE_Y        2
+#define LIST_BADGE_W        42
+#define LIST_BADGE_H        12
+#define TRACK_LONG_PRESS_MS 600
+
 // Display dirty-flag system — only redraw when state changes.
 // Eliminates the full-screen clear every 30 ms that causes flicker.
 volatile bool displayDirty = true;
 
 // Scan statistics for display feedback
 volatile int lastBLECount = 0;
+volatile bool bleScanRestart = false;   // interval / window changed — restart the scan
 volatile int lastWiFiCount = 0;
 volatile int totalScanned = 0;
 volatile int totalMatched = 0;
@@ -429,16 +792,20 @@ void initTouch();
 void initBLE();
 void initWiFi();
 void initSDCard();
-void scanBLE();
+void serviceBLEScan();
 void scanWiFi();
-void checkOUI(String macAddress, int8_t rssi, bool isBLE, String name = "", BLEMeta* bleMeta = nullptr, uint8_t channel = 0);
-bool addDetection(Detection det);
+void checkOUI(String macAddress, int8_t rssi, bool isBLE, String name = "", BLEMeta* bleMeta = nullptr, uint8_t channel = 0,
+              uint8_t hopChannel = 0);
+bool addDetection(Detection det, const PriorityTable* source);
 void updateDisplay();
 void drawWizardScreen();
 void drawMainScreen();
 void drawRadarScreen();
 void drawSettingsScreen();
+void drawProfileSelector(int x, int y);
+void applyScanProfile(ScanMode mode);
 void drawInfoScreen();
+void drawTrackScreen();
 void drawHeader(const char* title);
 void drawNavbar();
 void handleTouchGestures();
@@ -446,218 +813,1313 @@ void handleBootButton();
 void setBrightness(int level);
 void drawToggle(int x, int y, bool state, const char* label);
 float readBattery();
+void flushDetectionLog(bool closing);
 void saveConfig();
 void loadConfig();
 void enterDeepSleep();
-bool loadPriorityDB(const char* path);
-void runCorrelationEngine();
+bool loadPriorityBin(PriorityTable& t, const char* path, const char* jsonPath);
+bool loadPriorityDB(PriorityTable& t, const char* path);
+void loadKeywordTables(PriorityTable& t);
+void loadClassRules(PriorityTable& t);
+DeviceCategory categoryFromGroup(const PriorityTable& t, uint8_t groupId);
+PriorityTable* acquirePriorityTable();
+void releasePriorityTable(PriorityTable* t);
+bool buildPriorityTable(PriorityTable& t);
+void publishPriorityTable(PriorityTable* next);
+bool requestPriorityReload(const char* reason);
+void checkPriorityFiles();
+void adjustGroupCount(uint8_t group, int delta);
+void noteGroupSighting(Detection& d);
+void retireGroupSighting(const Detection& d);
+void restoreGroupSighting(Detection& d);
+void correlationTick();
+void flushCorrelationAlerts();
 void drawCorrelationBanner();
 void alertLED(int priority);
 uint16_t getTierColor(int priority);
 const char* getTierLabel(int priority);
 int getTierStars(int priority);
 void setupWebServer();
+void handleDetectionsRequest(AsyncWebServerRequest *req);
 int computeThreatScore(const Detection& det);
+bool requestTrackLock(const String& mac);
+void requestTrackStop();
 
 // ============================================================
 // PRIORITY DATABASE LOADER
 // ============================================================
 
-bool loadPriorityDB(const char* path) {
+// Compiled image (tools/build_priority_bin.py): one read into a scratch
+// buffer, bounds-checked, then copied into the same tables the JSON path fills.
+// Returns false (caller falls back to JSON) if missing, invalid or stale.
+bool loadPriorityBin(PriorityTable& t, const char* path, const char* jsonPath) {
     if (!SD.exists(path)) return false;
     File file = SD.open(path);
     if (!file) return false;
+    size_t size = file.size();
+    if (size < sizeof(PriorityBinHeader) || size > PRIORITY_BIN_MAX_SIZE) {
+        file.close();
+        Serial.printf("[WARN] %s: bad size %u — using JSON\n", path, (unsigned)size);
+        return false;
+    }
+    time_t binTime = file.getLastWrite();
+
+    // Stale if the JSON was edited after compiling (size changed or newer file)
+    PriorityBinHeader hdr;
+    file.read((uint8_t*)&hdr, sizeof(hdr));
+    if (SD.exists(jsonPath)) {
+        File json = SD.open(jsonPath);
+        bool stale = json && (json.size() != hdr.sourceSize || json.getLastWrite() > binTime + 2);
+        if (json) json.close();
+        if (stale) {
+            file.close();
+            Serial.printf("[WARN] %s is older than %s — using JSON (re-run build_priority_bin.py)\n", path, jsonPath);
+            return false;
+        }
+    }
 
-    // Allocate JSON document — 32768 comfortably fits 183-entry priority.json
-    // (65536 caused heap fragmentation crash on 2nd WiFi promiscuous cycle)
-    DynamicJsonDocument doc(32768);
-    DeserializationError error = deserializeJson(doc, file);
+    uint8_t* buf = (uint8_t*)malloc(size);
+    if (!buf) { file.close(); return false; }
+    memcpy(buf, &hdr, sizeof(hdr));
+    size_t got = sizeof(hdr) + file.read(buf + sizeof(hdr), size - sizeof(hdr));
     file.close();
 
-    if (error) {
-        Serial.printf("[WARN] Priority JSON parse error: %s — static fallback\n", error.c_str());
+    size_t groupsOff  = hdr.headerSize;
+    size_t entriesOff = groupsOff + hdr.groupCount * sizeof(uint16_t);
+    size_t rulesOff   = entriesOff + (size_t)hdr.entryCount * sizeof(PriorityBinEntry);
+    size_t stringsOff = rulesOff + (size_t)hdr.ruleCount * sizeof(PriorityBinRule);
+    const char* strings = (const char*)buf + stringsOff;
+    if (got != size || hdr.magic != PRIORITY_BIN_MAGIC || hdr.version != PRIORITY_BIN_VERSION ||
+        hdr.headerSize != sizeof(PriorityBinHeader) || hdr.entrySize != sizeof(PriorityBinEntry) ||
+        hdr.ruleSize != sizeof(PriorityBinRule) || hdr.totalSize != size ||
+        hdr.groupCount >= MAX_CORRELATION_GROUPS || hdr.entryCount == 0 ||
+        stringsOff + hdr.stringsSize != size || hdr.stringsSize == 0 || strings[hdr.stringsSize - 1] != '\0') {
+        free(buf);
+        Serial.printf("[WARN] %s: invalid image — using JSON\n", path);
         return false;
     }
+    auto str = [&](uint16_t off) -> const char* { return off < hdr.stringsSize ? strings + off : ""; };
+
+    // Map the image's group IDs onto the table's registry
+    uint8_t groupMap[MAX_CORRELATION_GROUPS] = {0};
+    for (uint8_t g = 0; g < hdr.groupCount; g++) {
+        uint16_t off;
+        memcpy(&off, buf + groupsOff + g * sizeof(uint16_t), sizeof(off));
+        groupMap[g + 1] = t.groups.intern(str(off));
+    }
+    auto mapMask = [&](uint64_t m) -> GroupMask {
+        GroupMask out = 0;
+        for (; m; m &= m - 1) {
+            int g = __builtin_ctzll(m);
+            if (g <= hdr.groupCount) out |= groupBit(groupMap[g]);
+        }
+        return out;
+    };
 
-    priorityDB.clear();
-    priorityLookup.clear();
-    priorityDB.reserve(200);  // one allocation for the whole vector, no realloc churn
-
-    // Load entries
-    JsonArray entries = doc["entries"];
-    for (JsonObject entry : entries) {
+    t.entries.reserve(hdr.entryCount);
+    for (uint16_t i = 0; i < hdr.entryCount; i++) {
+        PriorityBinEntry be;
+        memcpy(&be, buf + entriesOff + i * sizeof(be), sizeof(be));
         PriorityEntry pe;
-        strncpy(pe.oui,              entry["oui"]               | "", 8);  pe.oui[8]=0;
-        strncpy(pe.label,            entry["label"]             | "", 31); pe.label[31]=0;
-        strncpy(pe.context,          entry["context"]           | "", 47); pe.context[47]=0;
-        strncpy(pe.correlationGroup, entry["correlation_group"] | "", 23); pe.correlationGroup[23]=0;
-        pe.priority   = entry["priority"].as<int>();
-        pe.confidence = entry["confidence"].as<float>();
-        priorityDB.push_back(pe);
+        formatPrefix(pe.oui, sizeof(pe.oui), ((uint64_t)be.keyHigh << 32) | be.key, be.bits);  // re-parsed by index()
+        strncpy(pe.label,   str(be.labelOff),   31); pe.label[31]=0;
+        strncpy(pe.context, str(be.contextOff), 47); pe.context[47]=0;
+        pe.groupId    = be.groupId <= hdr.groupCount ? groupMap[be.groupId] : 0;
+        pe.priority   = be.priority;
+        pe.confidence = be.confidence / 10000.0f;
+        t.entries.push_back(pe);
     }
+    t.index();
 
-    // Build lookup table
-    for (auto& pe : priorityDB) {
-        priorityLookup[pe.oui] = &pe;
+    t.rules.clear();
+    t.rules.reserve(hdr.ruleCount);
+    for (uint16_t i = 0; i < hdr.ruleCount; i++) {
+        PriorityBinRule br;
+        memcpy(&br, buf + rulesOff + i * sizeof(br), sizeof(br));
+        CorrelationRule cr;
+        cr.id          = str(br.idOff);
+        cr.name        = str(br.nameOff);
+        cr.description = str(br.descOff);
+        cr.anyMask     = mapMask(br.anyMask);
+        cr.allMask     = mapMask(br.allMask);
+        cr.excludeMask = mapMask(br.excludeMask);
+        cr.minDevices  = br.minDevices;
+        cr.windowSec   = br.windowSec;
+        cr.minScore    = br.minScore;
+        for (uint8_t k = 0; k < br.minPairs && k < RULE_MAX_GROUP_MINS; k++) {
+            if (!br.minGroup[k] || br.minGroup[k] > hdr.groupCount || !groupMap[br.minGroup[k]]) continue;
+            if (br.minCount[k] == 0) continue;     // always met — not a condition
+            cr.minGroup[cr.minPairs]   = groupMap[br.minGroup[k]];
+            cr.minCount[cr.minPairs++] = br.minCount[k];
+        }
+        cr.setAlertLevel(str(br.levelOff));
+        if (cr.hasCondition()) t.rules.push_back(cr);
     }
+    free(buf);
 
-    // Load correlation rules
-    correlationRules.clear();
-    JsonArray rules = doc["correlation_rules"];
-    for (JsonObject rule : rules) {
-        CorrelationRule cr;
-        cr.id = rule["id"].as<String>();
-        cr.name = rule["name"].as<String>();
-        cr.description = rule["description"].as<String>();
-        cr.minDevices = rule["min_devices"].as<int>();
-        cr.alertLevel = rule["alert_level"].as<String>();
-        JsonArray groups = rule["required_groups"];
-        for (const char* g : groups) {
-            cr.requiredGroups.push_back(String(g));
+    Serial.printf("Priority DB: %d entries, %d rules, %d groups loaded (compiled, %u bytes)\n",
+                  t.entries.size(), t.rules.size(), (int)t.groups.count - 1,
+                  (unsigned)size);
+    return true;
+}
+
+// Position `f` just inside the array value of `key` ("\"entries\"" etc.).
+// Returns false if the key is absent or the array is empty.
+static bool seekJsonArray(File& f, const char* key) {
+    f.seek(0);
+    if (!f.find(key) || !f.find("[")) return false;
+    while (f.available() && isspace(f.peek())) f.read();
+    return f.peek() != ']';
+}
+
+// Step over the array element starting at the current position (object,
+// array, string or scalar), tracking nesting and strings. Leaves the stream
+// before the ',' or ']' that follows, so an element that failed to parse
+// can be skipped and the next one still read.
+static void skipJsonElement(File& f) {
+    int depth = 0;
+    bool inString = false, escaped = false;
+    while (f.available()) {
+        char c = f.read();
+        if (inString) {
+            if (escaped)          escaped = false;
+            else if (c == '\\')   escaped = true;
+            else if (c == '"')    inString = false;
+            continue;
+        }
+        if (c == '"') {
+            inString = true;
+        } else if (c == '{' || c == '[') {
+            depth++;
+        } else if (c == '}' || c == ']' || c == ',') {
+            if (depth == 0) { f.seek(f.position() - 1); return; }   // end of a scalar element
+            if (c != ',' && --depth == 0) return;
         }
-        correlationRules.push_back(cr);
     }
+}
+
+// Streaming loader: one entries[] / correlation_rules[] element is
+// deserialized at a time through a filter into a small fixed document, so
+// parse overhead is the same for 20 entries or 2000. Entries are counted
+// first so t.entries is normally allocated exactly once. An element that is
+// malformed or too big for its document is skipped with a warning; the rest
+// of the table still loads.
+#define PRIORITY_ENTRY_DOC  512     // one filtered entry (strings are short)
+#define PRIORITY_RULE_DOC   1536    // one filtered rule incl. group lists
+
+bool loadPriorityDB(PriorityTable& t, const char* path) {
+    if (!SD.exists(path)) return false;
+    File file = SD.open(path);
+    if (!file) return false;
+    file.setTimeout(0);        // a truncated element fails at once, not after the 1 s Stream timeout
 
-    if (priorityDB.empty()) {
+    size_t count = 0;
+    if (seekJsonArray(file, "\"entries\"")) {
+        while (file.findUntil("\"oui\"", "]")) count++;  // sizing hint only
+    }
+    if (!count) {
+        file.close();
         Serial.println("[WARN] Priority JSON has no entries — static fallback");
         return false;
     }
-    Serial.printf("Priority DB: %d entries, %d rules loaded\n", priorityDB.size(), correlationRules.size());
+
+    StaticJsonDocument<128> entryFilter;
+    for (const char* k : {"oui", "label", "context", "correlation_group", "priority", "confidence"}) entryFilter[k] = true;
+
+    t.entries.clear();
+    t.entries.reserve(count);  // one allocation for the whole vector, no realloc churn
+
+    // Load entries
+    int skipped = 0;
+    {
+        StaticJsonDocument<PRIORITY_ENTRY_DOC> doc;
+        seekJsonArray(file, "\"entries\"");
+        do {
+            size_t start = file.position();
+            DeserializationError error = deserializeJson(doc, file, DeserializationOption::Filter(entryFilter));
+            if (error) {
+                Serial.printf("[WARN] Priority JSON entry %d: %s — skipped\n",
+                              (int)t.entries.size() + skipped, error.c_str());
+                skipped++;
+                file.seek(start);
+                skipJsonElement(file);
+                continue;
+            }
+            PriorityEntry pe;
+            strncpy(pe.oui,              doc["oui"]               | "", 13); pe.oui[13]=0;
+            strncpy(pe.label,            doc["label"]             | "", 31); pe.label[31]=0;
+            strncpy(pe.context,          doc["context"]           | "", 47); pe.context[47]=0;
+            pe.groupId = t.groups.intern(doc["correlation_group"] | "");
+            pe.priority   = doc["priority"].as<int>();
+            pe.confidence = doc["confidence"].as<float>();
+            t.entries.push_back(pe);
+        } while (file.findUntil(",", "]"));
+    }
+    if (t.entries.empty()) {
+        file.close();
+        Serial.printf("[WARN] Priority JSON: none of %d entries parsed — static fallback\n", skipped);
+        return false;
+    }
+
+    // Build lookup table
+    t.index();
+
+    // Load correlation rules
+    StaticJsonDocument<256> ruleFilter;
+    for (const char* k : {"id", "name", "description", "min_devices", "window_sec", "min_score", "alert_level",
+                          "required_groups", "all_groups", "exclude_groups", "group_min"}) ruleFilter[k] = true;
+    t.rules.clear();
+    if (seekJsonArray(file, "\"correlation_rules\"")) {
+        StaticJsonDocument<PRIORITY_RULE_DOC> rule;
+        int n = 0;
+        do {
+            size_t start = file.position();
+            DeserializationError error = deserializeJson(rule, file, DeserializationOption::Filter(ruleFilter));
+            n++;
+            if (error) {
+                Serial.printf("[WARN] Priority JSON rule %d: %s — skipped\n", n - 1, error.c_str());
+                file.seek(start);
+                skipJsonElement(file);
+                continue;
+            }
+            CorrelationRule cr;
+            cr.id = rule["id"].as<String>();
+            cr.name = rule["name"].as<String>();
+            cr.description = rule["description"].as<String>();
+            cr.minDevices = rule["min_devices"].as<int>();
+            cr.windowSec  = rule["window_sec"] | 0;
+            cr.minScore   = rule["min_score"] | 0.0f;
+            cr.setAlertLevel(rule["alert_level"].as<String>());
+            for (const char* g : rule["required_groups"].as<JsonArray>()) cr.anyMask     |= groupBit(t.groups.intern(g));
+            for (const char* g : rule["all_groups"].as<JsonArray>())      cr.allMask     |= groupBit(t.groups.intern(g));
+            for (const char* g : rule["exclude_groups"].as<JsonArray>())  cr.excludeMask |= groupBit(t.groups.intern(g));
+            for (JsonPair kv : rule["group_min"].as<JsonObject>()) {
+                uint8_t gid = t.groups.intern(kv.key().c_str());
+                int count = kv.value().as<int>();   // as<uint8_t>() would read 300 as 0
+                if (count < 1) {
+                    Serial.printf("[WARN] Rule '%s' group_min %s: count must be >= 1 — ignored\n",
+                                  cr.id.c_str(), kv.key().c_str());
+                    continue;
+                }
+                if (gid && cr.minPairs < RULE_MAX_GROUP_MINS) {
+                    cr.minGroup[cr.minPairs]   = gid;
+                    cr.minCount[cr.minPairs++] = (uint8_t)min(255, count);   // as build_priority_bin.py
+                }
+            }
+            if (!cr.hasCondition()) {
+                Serial.printf("[WARN] Rule '%s' has no condition that needs a sighting — skipped\n", cr.id.c_str());
+                continue;
+            }
+            t.rules.push_back(cr);
+        } while (file.findUntil(",", "]"));
+    }
+    file.close();
+
+    Serial.printf("Priority DB: %d entries, %d rules, %d groups loaded (streamed, %d B parse buffer)\n",
+                  t.entries.size(), t.rules.size(), (int)t.groups.count - 1,
+                  PRIORITY_RULE_DOC);
     return true;
 }
 
 // Fallback priority entries if no SD card
-void initializeStaticPriorityDB() {
-    priorityDB.clear();
-    priorityLookup.clear();
+void initializeStaticPriorityDB(PriorityTable& t) {
+    t.entries.clear();
+    t.groups = CorrelationGroups();  // drop names left by a failed SD load
+    auto add = [&t](const char* o, const char* l, const char* c, const char* g, int p, float f) {
+        t.entries.push_back(PriorityEntry(o, l, c, t.groups.intern(g), p, f));
+    };
 
     // Field-validated high-value targets
-    priorityDB.push_back({"00:60:37", "Skydio Controller", "Autonomous drone ops", "skydio_ops", 5, 0.98});
-    priorityDB.push_back({"90:9F:33", "Sky Drone", "Autonomous drone ops", "skydio_ops", 5, 0.95});
-    priorityDB.push_back({"60:60:1F", "DJI", "Commercial/police drone", "dji_ops", 5, 0.97});
-    priorityDB.push_back({"B8:69:F4", "Ubiquiti Networks", "UniFi cameras/APs", "ubiquiti_infra", 4, 0.88});
-    priorityDB.push_back({"00:12:12", "Hikvision", "Govt/council CCTV", "hikvision_net", 5, 0.99});
-    priorityDB.push_back({"00:40:8C", "Axis Communications", "Professional IP cameras", "axis_net", 5, 0.99});
-    priorityDB.push_back({"A4:DA:32", "Dahua Technology", "Govt/council CCTV", "dahua_net", 5, 0.99});
-    priorityDB.push_back({"3C:EF:8C", "Dahua Technology", "IP cameras and NVRs", "dahua_net", 5, 0.97});
-    priorityDB.push_back({"E0:50:8B", "Genetec", "Facial recognition", "genetec_net", 5, 0.96});
-    priorityDB.push_back({"00:18:7D", "Pelco (Motorola)", "Police/transport CCTV", "pelco_net", 5, 0.95});
-    priorityDB.push_back({"D8:60:CF", "Smart Dashcam", "Delivery/bodycam", "vehicle_cam", 3, 0.90});
-    priorityDB.push_back({"28:87:BA", "GoPro", "Action cams/bodycam", "gopro_cam", 3, 0.92});
-    priorityDB.push_back({"6C:C2:17", "Dahua Technology", "Security cameras", "dahua_net", 5, 0.97});
-    priorityDB.push_back({"B0:A7:B9", "Reolink", "WiFi cameras", "reolink_cam", 3, 0.88});
-    priorityDB.push_back({"50:C7:BF", "TP-Link Tapo", "Tapo cameras", "tplink_cam", 2, 0.85});
-    priorityDB.push_back({"18:E8:29", "Ubiquiti Networks", "UniFi cameras", "ubiquiti_infra", 4, 0.88});
-    priorityDB.push_back({"74:83:C2", "Ubiquiti Networks", "UniFi cameras", "ubiquiti_infra", 4, 0.88});
-    priorityDB.push_back({"18:B4:30", "Nest (Google)", "Consumer doorbell cam", "nest_home", 2, 0.85});
-    priorityDB.push_back({"EC:71:DB", "Ring (Amazon)", "Consumer doorbell cam", "ring_home", 2, 0.85});
-    priorityDB.push_back({"74:DA:88", "Sky CPE", "Consumer broadband", "consumer_isp", 1, 0.99});
-    priorityDB.push_back({"FC:F8:AE", "BT/EE Hub", "Consumer broadband", "consumer_isp", 1, 0.99});
-    priorityDB.push_back({"20:8B:FB", "TP-Link", "Consumer networking", "consumer_isp", 1, 0.99});
-
-    for (auto& pe : priorityDB) {
-        priorityLookup[pe.oui] = &pe;
-    }
+    add("00:60:37", "Skydio Controller", "Autonomous drone ops", "skydio_ops", 5, 0.98);
+    add("90:9F:33", "Sky Drone", "Autonomous drone ops", "skydio_ops", 5, 0.95);
+    add("60:60:1F", "DJI", "Commercial/police drone", "dji_ops", 5, 0.97);
+    add("B8:69:F4", "Ubiquiti Networks", "UniFi cameras/APs", "ubiquiti_infra", 4, 0.88);
+    add("00:12:12", "Hikvision", "Govt/council CCTV", "hikvision_net", 5, 0.99);
+    add("00:40:8C", "Axis Communications", "Professional IP cameras", "axis_net", 5, 0.99);
+    add("A4:DA:32", "Dahua Technology", "Govt/council CCTV", "dahua_net", 5, 0.99);
+    add("3C:EF:8C", "Dahua Technology", "IP cameras and NVRs", "dahua_net", 5, 0.97);
+    add("E0:50:8B", "Genetec", "Facial recognition", "genetec_net", 5, 0.96);
+    add("00:18:7D", "Pelco (Motorola)", "Police/transport CCTV", "pelco_net", 5, 0.95);
+    add("D8:60:CF", "Smart Dashcam", "Delivery/bodycam", "vehicle_cam", 3, 0.90);
+    add("28:87:BA", "GoPro", "Action cams/bodycam", "gopro_cam", 3, 0.92);
+    add("6C:C2:17", "Dahua Technology", "Security cameras", "dahua_net", 5, 0.97);
+    add("B0:A7:B9", "Reolink", "WiFi cameras", "reolink_cam", 3, 0.88);
+    add("50:C7:BF", "TP-Link Tapo", "Tapo cameras", "tplink_cam", 2, 0.85);
+    add("18:E8:29", "Ubiquiti Networks", "UniFi cameras", "ubiquiti_infra", 4, 0.88);
+    add("74:83:C2", "Ubiquiti Networks", "UniFi cameras", "ubiquiti_infra", 4, 0.88);
+    add("18:B4:30", "Nest (Google)", "Consumer doorbell cam", "nest_home", 2, 0.85);
+    add("EC:71:DB", "Ring (Amazon)", "Consumer doorbell cam", "ring_home", 2, 0.85);
+    add("74:DA:88", "Sky CPE", "Consumer broadband", "consumer_isp", 1, 0.99);
+    add("FC:F8:AE", "BT/EE Hub", "Consumer broadband", "consumer_isp", 1, 0.99);
+    add("20:8B:FB", "TP-Link", "Consumer networking", "consumer_isp", 1, 0.99);
+
+    t.index();
 
     // Static correlation rules
-    correlationRules.clear();
+    t.rules.clear();
     CorrelationRule skydio;
     skydio.id = "skydio_active_ops";
     skydio.name = "SKYDIO OPS ACTIVE";
     skydio.description = "Skydio controller + drone both detected";
-    skydio.requiredGroups.push_back("skydio_ops");
+    skydio.anyMask = groupBit(t.groups.intern("skydio_ops"));
     skydio.minDevices = 2;
-    skydio.alertLevel = "CRITICAL";
-    correlationRules.push_back(skydio);
+    skydio.setAlertLevel("CRITICAL");
+    t.rules.push_back(skydio);
 
     CorrelationRule dji;
     dji.id = "dji_active_ops";
     dji.name = "DJI DRONE OPS";
     dji.description = "DJI drone platform detected";
-    dji.requiredGroups.push_back("dji_ops");
+    dji.anyMask = groupBit(t.groups.intern("dji_ops"));
     dji.minDevices = 1;
-    dji.alertLevel = "HIGH";
-    correlationRules.push_back(dji);
+    dji.setAlertLevel("HIGH");
+    t.rules.push_back(dji);
 
     CorrelationRule cluster;
     cluster.id = "surveillance_cluster";
     cluster.name = "SURVEILLANCE CLUSTER";
     cluster.description = "Multiple surveillance devices - monitored zone";
-    cluster.requiredGroups.push_back("hikvision_net");
-    cluster.requiredGroups.push_back("axis_net");
-    cluster.requiredGroups.push_back("dahua_net");
-    cluster.requiredGroups.push_back("pelco_net");
-    cluster.requiredGroups.push_back("ubiquiti_infra");
+    for (const char* g : {"hikvision_net", "axis_net", "dahua_net", "pelco_net", "ubiquiti_infra"}) {
+        cluster.anyMask |= groupBit(t.groups.intern(g));
+    }
     cluster.minDevices = 3;
-    cluster.alertLevel = "HIGH";
-    correlationRules.push_back(cluster);
+    cluster.setAlertLevel("HIGH");
+    t.rules.push_back(cluster);
 
     CorrelationRule faceRecog;
     faceRecog.id = "facial_recognition_zone";
     faceRecog.name = "FACE RECOG ZONE";
     faceRecog.description = "Facial recognition infrastructure detected";
-    faceRecog.requiredGroups.push_back("genetec_net");
+    faceRecog.anyMask = groupBit(t.groups.intern("genetec_net"));
     faceRecog.minDevices = 1;
-    faceRecog.alertLevel = "CRITICAL";
-    correlationRules.push_back(faceRecog);
+    faceRecog.setAlertLevel("CRITICAL");
+    t.rules.push_back(faceRecog);
 }
 
 // ============================================================
 // CORRELATION ENGINE
 // ============================================================
 
-void runCorrelationEngine() {
-    // Count devices per correlation group
-    std::map<String, int> groupCounts;
-    xSemaphoreTake(xDetectionMutex, portMAX_DELAY);
-    for (auto& det : detections) {
-        if (!det.correlationGroup.isEmpty()) {
-            groupCounts[det.correlationGroup]++;
+// Group counters are maintained incrementally by addDetection() (add, evict,
+// re-classify) under xDetectionMutex. Each counter change re-evaluates only the
+// rules that reference that group, so an alert raises or clears on the sighting
+// that caused it rather than at the end of the scan cycle. Counters are a dense
+// array indexed by interned group ID, with a bitset of non-empty groups, so a
+// rule evaluation is a few mask tests plus a popcount-sized sum.
+
+uint16_t groupCounts[MAX_CORRELATION_GROUPS];          // live devices per correlation group ID
+GroupMask groupPresentMask = 0;                        // bit g set <=> groupCounts[g] > 0
+std::vector<uint16_t> groupRules[MAX_CORRELATION_GROUPS];  // group ID -> rules that read it
+std::vector<uint8_t> ruleActive;                       // per-rule: currently raised?
+static volatile int pendingCorrelationLED = 0;         // highest tier raised since last flush
+
+// ── Sliding windows + decaying evidence ───────────────────────────────────
+// Each group has a ring of CORR_BUCKETS time buckets. A device is counted once,
+// in the bucket of its most recent sighting: a re-sighting in a later bucket
+// moves it forward. "Distinct devices in the last T seconds" is then the sum of
+// the newest T/CORR_BUCKET_SEC buckets, kept as a running sum per configured
+// window so a sighting is O(windows) and a rule check is O(1). Buckets rotate
+// lazily (at most CORR_BUCKETS steps) whenever the clock is consulted.
+// Windows expire by time alone: a device evicted from the table stays counted
+// until its bucket ages out, and its bucket key is remembered (the last
+// CORR_EVICTED_KEYS evictions) so a re-sighting moves it instead of adding it.
+//
+// Evidence is an exponentially decayed sighting count per group
+// (score = score * e^(-dt/tau) + 1), decayed lazily on touch, O(1).
+//
+// Fixed memory: 64 groups × 60 buckets × 1 byte + 4 windows × 64 × 2 bytes,
+// plus 64 evicted keys × 12 bytes.
+#define CORR_BUCKET_SEC      15
+#define CORR_BUCKETS         60            // 15-minute horizon
+#define CORR_MAX_WINDOWS     4
+#define CORR_SCORE_TAU_SEC   300.0f        // evidence half-life ≈ 3.5 min
+#define CORR_EVICTED_KEYS    64
+
+static uint8_t  groupBuckets[MAX_CORRELATION_GROUPS][CORR_BUCKETS];
+static uint16_t windowSums[CORR_MAX_WINDOWS][MAX_CORRELATION_GROUPS];
+static uint8_t  windowBuckets[CORR_MAX_WINDOWS];   // window length in buckets
+static uint8_t  windowCount = 0;
+static uint32_t corrBucketNow = 0;                 // absolute bucket index of "now"
+static float    groupScore[MAX_CORRELATION_GROUPS];
+static uint32_t groupScoreMs[MAX_CORRELATION_GROUPS];
+
+// Where an evicted device is still counted in the windows (group 0 = free slot)
+struct EvictedWindowKey {
+    uint32_t macHash;
+    uint32_t bucket;
+    uint8_t  group;
+};
+static EvictedWindowKey evictedKeys[CORR_EVICTED_KEYS];
+static uint8_t          evictedNext = 0;
+
+static uint32_t corrMacHash(const String& mac) {
+    uint32_t h = 2166136261UL;
+    for (size_t i = 0; i < mac.length(); i++) { h ^= (uint8_t)mac[i]; h *= 16777619UL; }
+    return h;
+}
+
+static inline uint32_t corrBucketOf(unsigned long ms) { return ms / (CORR_BUCKET_SEC * 1000UL); }
+
+// Decayed evidence for a group as of `now`, folding the decay into storage
+static float decayedGroupScore(uint8_t g, unsigned long now) {
+    if (groupScore[g] > 0.0f) {
+        groupScore[g] *= expf(-(float)(now - groupScoreMs[g]) / (CORR_SCORE_TAU_SEC * 1000.0f));
+        if (groupScore[g] < 0.01f) groupScore[g] = 0.0f;
+    }
+    groupScoreMs[g] = now;
+    return groupScore[g];
+}
+
+// Advance the ring to `now`, dropping buckets that leave each window.
+// Returns true if any bucket rotated. Caller holds xDetectionMutex.
+static bool advanceCorrelationWindows(unsigned long now) {
+    uint32_t target = corrBucketOf(now);
+    if (target == corrBucketNow) return false;
+    if (target - corrBucketNow >= CORR_BUCKETS) {     // idle past the horizon: everything expired
+        memset(groupBuckets, 0, sizeof(groupBuckets));
+        memset(windowSums, 0, sizeof(windowSums));
+        corrBucketNow = target;
+        return true;
+    }
+    for (uint32_t step = corrBucketNow + 1; step <= target; step++) {
+        for (uint8_t w = 0; w < windowCount; w++) {
+            if (step < windowBuckets[w]) continue;
+            uint8_t leaving = (step - windowBuckets[w]) % CORR_BUCKETS;
+            for (uint8_t g = 1; g < MAX_CORRELATION_GROUPS; g++) windowSums[w][g] -= groupBuckets[g][leaving];
         }
+        uint8_t slot = step % CORR_BUCKETS;
+        for (uint8_t g = 1; g < MAX_CORRELATION_GROUPS; g++) groupBuckets[g][slot] = 0;
     }
-    xSemaphoreGive(xDetectionMutex);
+    corrBucketNow = target;
+    return true;
+}
+
+// Take one device out of group `g`'s bucket `bucket` (no-op once it has left
+// the horizon). Caller holds xDetectionMutex and has advanced the ring.
+static void unrecordGroupSighting(uint8_t g, uint32_t bucket) {
+    if (!g || g >= MAX_CORRELATION_GROUPS || corrBucketNow - bucket >= CORR_BUCKETS) return;
+    uint8_t slot = bucket % CORR_BUCKETS;
+    if (!groupBuckets[g][slot]) return;
+    groupBuckets[g][slot]--;
+    for (uint8_t w = 0; w < windowCount; w++) {
+        if (corrBucketNow - bucket < windowBuckets[w]) windowSums[w][g]--;
+    }
+}
+
+// Count device `d` in the current bucket of its group. It is first taken out
+// of the bucket and group it was counted under before (recorded on the
+// detection, so a group change after a reload decrements the right group).
+// Caller holds xDetectionMutex and has advanced the ring.
+static void recordGroupSighting(Detection& d, unsigned long now) {
+    uint8_t g = d.groupId < MAX_CORRELATION_GROUPS ? d.groupId : 0;
+    if (g) {
+        decayedGroupScore(g, now);
+        groupScore[g] += 1.0f;
+    }
+    if (d.windowGroup && d.windowGroup == g && d.windowBucket == corrBucketNow) return;  // already counted here
+    unrecordGroupSighting(d.windowGroup, d.windowBucket);
+    d.windowGroup = 0;
+    uint8_t slot = corrBucketNow % CORR_BUCKETS;
+    if (g && groupBuckets[g][slot] < 255) {
+        groupBuckets[g][slot]++;
+        for (uint8_t w = 0; w < windowCount; w++) windowSums[w][g]++;
+        d.windowGroup = g;
+        d.windowBucket = corrBucketNow;
+    }
+}
 
-    // Compute a hash of the current alerts so we can detect content changes,
-    // not just count changes (e.g. different alerts with the same count).
-    auto hashAlerts = [](const std::vector<CorrelationAlert>& alerts) -> uint32_t {
-        uint32_t h = 0;
-        for (auto& a : alerts) {
-            for (char c : a.name) h = h * 31 + c;
-            for (char c : a.alertLevel) h = h * 31 + c;
+// Re-evaluate one rule against the current counters. Caller holds xDetectionMutex.
+static void evaluateCorrelationRule(uint16_t r) {
+    const CorrelationRule& rule = priorityTable->rules[r];
+    const uint16_t* counts = (rule.windowIdx >= 0) ? windowSums[rule.windowIdx] : groupCounts;
+    GroupMask present = groupPresentMask;
+    if (rule.windowIdx >= 0) {
+        present = 0;
+        for (GroupMask m = rule.touchedMask(); m; m &= m - 1) {
+            int g = __builtin_ctzll(m);
+            if (counts[g]) present |= groupBit(g);
         }
-        return h;
-    };
-    uint32_t prevHash = hashAlerts(activeAlerts);
+    }
+    bool active = (present & rule.allMask) == rule.allMask &&
+                  !(present & rule.excludeMask);
+    for (uint8_t i = 0; active && i < rule.minPairs; i++) {
+        active = counts[rule.minGroup[i]] >= rule.minCount[i];
+    }
+    int matchingDevices = 0;
+    if (active) {
+        for (GroupMask m = rule.anyMask & present; m; m &= m - 1) {
+            matchingDevices += counts[__builtin_ctzll(m)];
+        }
+        active = matchingDevices >= rule.minDevices;
+    }
+    if (active && rule.minScore > 0.0f) {
+        float score = 0.0f;
+        unsigned long now = millis();
+        for (GroupMask m = rule.anyMask; m; m &= m - 1) score += decayedGroupScore(__builtin_ctzll(m), now);
+        active = score >= rule.minScore;
+    }
+    if (active == (bool)ruleActive[r]) return;
+    ruleActive[r] = active;
+
+    if (active) {
+        CorrelationAlert alert;
+        alert.name        = rule.name;
+        alert.description = rule.description;
+        alert.alertLevel  = rule.alertLevel;
+        alert.timestamp   = millis();
+        activeAlerts.insert(activeAlerts.begin(), alert);  // [0] = most recent
+        if (rule.alertTier > pendingCorrelationLED) pendingCorrelationLED = rule.alertTier;
+        Serial.printf("[CORR] RAISED %s (%d devices)\n", rule.name.c_str(), matchingDevices);
+    } else {
+        for (auto it = activeAlerts.begin(); it != activeAlerts.end(); ++it) {
+            if (it->name == rule.name) { activeAlerts.erase(it); break; }
+        }
+        Serial.printf("[CORR] cleared %s\n", rule.name.c_str());
+    }
+    displayDirty = true;
+}
+
+// Apply a +/- delta to a group counter and re-evaluate the affected rules.
+// Caller holds xDetectionMutex.
+void adjustGroupCount(uint8_t group, int delta) {
+    if (!group || group >= MAX_CORRELATION_GROUPS) return;
+    groupCounts[group] = (uint16_t)max(0, (int)groupCounts[group] + delta);
+    if (groupCounts[group]) groupPresentMask |= groupBit(group);
+    else                    groupPresentMask &= ~groupBit(group);
+    for (uint16_t r : groupRules[group]) evaluateCorrelationRule(r);
+}
+
+// Rules whose result can change with time alone (windowed or score-gated)
+static void evaluateTimedRules() {
+    const auto& rules = priorityTable->rules;
+    for (uint16_t r = 0; r < rules.size(); r++) {
+        if (rules[r].windowIdx >= 0 || rules[r].minScore > 0.0f) evaluateCorrelationRule(r);
+    }
+}
+
+// Account a sighting of `d` in the time windows and evidence scores, then
+// re-evaluate the rules that read its group (and the group it was counted
+// under before, if that changed). Caller holds xDetectionMutex.
+void noteGroupSighting(Detection& d) {
+    uint8_t before = d.windowGroup;
+    if (!before && (!d.groupId || d.groupId >= MAX_CORRELATION_GROUPS)) return;
+    unsigned long now = millis();
+    bool rotated = advanceCorrelationWindows(now);
+    recordGroupSighting(d, now);
+    if (rotated) evaluateTimedRules();
+    if (before && before != d.groupId) {
+        for (uint16_t r : groupRules[before]) evaluateCorrelationRule(r);
+    }
+    if (d.groupId < MAX_CORRELATION_GROUPS) {
+        for (uint16_t r : groupRules[d.groupId]) evaluateCorrelationRule(r);
+    }
+}
+
+// `d` is leaving the table. It stays counted in the time windows until its
+// bucket ages out; remember where, so a later sighting moves it rather than
+// counting it twice. Caller holds xDetectionMutex.
+void retireGroupSighting(const Detection& d) {
+    if (!d.windowGroup) return;
+    evictedKeys[evictedNext] = { corrMacHash(d.macAddress), d.windowBucket, d.windowGroup };
+    evictedNext = (evictedNext + 1) % CORR_EVICTED_KEYS;
+}
+
+// A device re-entering the table takes back the window slot it was counted
+// under when evicted (newest key wins), before noteGroupSighting() moves it.
+// Caller holds xDetectionMutex.
+void restoreGroupSighting(Detection& d) {
+    uint32_t h = corrMacHash(d.macAddress);
+    bool restored = false;
+    for (uint8_t i = 1; i <= CORR_EVICTED_KEYS; i++) {
+        EvictedWindowKey& k = evictedKeys[(evictedNext + CORR_EVICTED_KEYS - i) % CORR_EVICTED_KEYS];
+        if (!k.group || k.macHash != h) continue;
+        if (!restored) {
+            d.windowGroup  = k.group;
+            d.windowBucket = k.bucket;
+            restored = true;
+        }
+        k.group = 0;
+    }
+}
+
+// Periodic tick so windowed/decaying rules clear when sightings stop.
+// Cheap when no bucket has rotated.
+void correlationTick() {
+    xSemaphoreTake(xDetectionMutex, portMAX_DELAY);
+    if (advanceCorrelationWindows(millis())) evaluateTimedRules();
+    xSemaphoreGive(xDetectionMutex);
+    flushCorrelationAlerts();
+}
 
-    // Evaluate each rule
+// Fire the LED for rules raised since the last call. Must be called WITHOUT
+// xDetectionMutex held — alertLED() blocks for the pulse pattern.
+void flushCorrelationAlerts() {
+    int tier = pendingCorrelationLED;
+    if (!tier) return;
+    pendingCorrelationLED = 0;
+    alertLED(tier);
+}
+
+// A new priority table numbers its groups afresh. Move the per-group rings and
+// scores, and every detection's group IDs, onto the new numbering (idMap: old
+// ID -> new ID, 0 = group gone). Counters and window sums are rebuilt from
+// these by rebuildCorrelationIndex(). Caller holds xDetectionMutex.
+static void remapCorrelationGroups(const uint8_t* idMap) {
+    std::vector<uint8_t> oldBuckets((uint8_t*)groupBuckets, (uint8_t*)groupBuckets + sizeof(groupBuckets));
+    float    oldScore[MAX_CORRELATION_GROUPS];
+    uint32_t oldScoreMs[MAX_CORRELATION_GROUPS];
+    memcpy(oldScore, groupScore, sizeof(groupScore));
+    memcpy(oldScoreMs, groupScoreMs, sizeof(groupScoreMs));
+    memset(groupBuckets, 0, sizeof(groupBuckets));
+    memset(groupScore, 0, sizeof(groupScore));
+    for (uint8_t g = 1; g < MAX_CORRELATION_GROUPS; g++) {
+        uint8_t to = idMap[g];
+        if (!to) continue;
+        memcpy(groupBuckets[to], &oldBuckets[g * CORR_BUCKETS], CORR_BUCKETS);
+        groupScore[to]   = oldScore[g];
+        groupScoreMs[to] = oldScoreMs[g];
+    }
+    for (auto& d : detections) {
+        d.groupId     = d.groupId < MAX_CORRELATION_GROUPS ? idMap[d.groupId] : 0;
+        d.windowGroup = idMap[d.windowGroup];
+    }
+    for (auto& k : evictedKeys) k.group = idMap[k.group];
+}
+
+// Full rebuild: index rules by group, recount the table and re-evaluate every
+// rule. Only needed when a priority table is published (boot or hot reload).
+// Caller holds xDetectionMutex.
+static void rebuildCorrelationIndex() {
+    auto& correlationRules = priorityTable->rules;
+    for (auto& rules : groupRules) rules.clear();
+    for (uint16_t r = 0; r < correlationRules.size(); r++) {
+        for (GroupMask m = correlationRules[r].touchedMask(); m; m &= m - 1) {
+            groupRules[__builtin_ctzll(m)].push_back(r);
+        }
+    }
+    ruleActive.assign(correlationRules.size(), 0);
     activeAlerts.clear();
+    activeAlerts.reserve(correlationRules.size());
+
+    // Assign each windowed rule a window slot (rules sharing a length share a slot)
+    windowCount = 0;
     for (auto& rule : correlationRules) {
-        int matchingDevices = 0;
-        for (auto& group : rule.requiredGroups) {
-            auto it = groupCounts.find(group);
-            if (it != groupCounts.end()) {
-                matchingDevices += it->second;
+        rule.windowIdx = -1;
+        if (!rule.windowSec) continue;
+        uint8_t nb = constrain((rule.windowSec + CORR_BUCKET_SEC - 1) / CORR_BUCKET_SEC, 1, CORR_BUCKETS);
+        for (uint8_t w = 0; w < windowCount; w++) {
+            if (windowBuckets[w] == nb) { rule.windowIdx = w; break; }
+        }
+        if (rule.windowIdx < 0) {
+            if (windowCount >= CORR_MAX_WINDOWS) {
+                Serial.printf("[WARN] Rule '%s': more than %d distinct windows — using live counts\n",
+                              rule.id.c_str(), CORR_MAX_WINDOWS);
+                continue;
             }
+            windowBuckets[windowCount] = nb;
+            rule.windowIdx = windowCount++;
         }
-        if (matchingDevices >= rule.minDevices) {
-            CorrelationAlert alert;
-            alert.name = rule.name;
-            alert.description = rule.description;
-            alert.alertLevel = rule.alertLevel;
-            alert.timestamp = millis();
-            activeAlerts.push_back(alert);
-
-            // Trigger LED alerts for critical correlations
-            if (rule.alertLevel == "CRITICAL") {
-                alertLED(5);
-            } else if (rule.alertLevel == "HIGH") {
-                alertLED(4);
+    }
+    // Rebuild window sums from the ring (the ring itself survives a rule reload)
+    advanceCorrelationWindows(millis());
+    memset(windowSums, 0, sizeof(windowSums));
+    for (uint8_t w = 0; w < windowCount; w++) {
+        for (uint8_t age = 0; age < windowBuckets[w] && age <= corrBucketNow; age++) {
+            uint8_t slot = (corrBucketNow - age) % CORR_BUCKETS;
+            for (uint8_t g = 1; g < MAX_CORRELATION_GROUPS; g++) windowSums[w][g] += groupBuckets[g][slot];
+        }
+    }
+
+    memset(groupCounts, 0, sizeof(groupCounts));
+    groupPresentMask = 0;
+    for (auto& det : detections) {
+        if (det.groupId) { groupCounts[det.groupId]++; groupPresentMask |= groupBit(det.groupId); }
+    }
+    for (uint16_t r = 0; r < correlationRules.size(); r++) evaluateCorrelationRule(r);
+}
+
+// ============================================================
+// KEYWORD TABLES
+// ============================================================
+
+// Substring rules for devices the OUI index cannot place: BT company names
+// (not randomised even when the MAC is), SSIDs that carry a brand, and the
+// correlation group names in priority.json. Each set is compiled into an
+// Aho–Corasick automaton once per load, so checkOUI() does a single pass over
+// the string however many keywords there are. Earlier entries win when
+// several match, exactly as the old indexOf() loops did.
+//
+// /keywords.json on the SD card adds to these (its entries take precedence):
+//   { "ble_company": [ {"keyword": "Motorola Solutions", "category": "Body Cam", "priority": 3} ],
+//     "ssid":        [ {"keyword": "REOLINK", "category": "CCTV", "priority": 3} ],
+//     "group":       [ {"keyword": "council", "category": "Smart Pole"} ] }
+// category is a getCategoryName() name or a numeric ID.
+
+struct KeywordDefault { const char* keyword; DeviceCategory cat; int priority; };
+
+static const KeywordDefault BLE_KEYWORDS[] = {
+    // ── Drones ────────────────────────────────────────────────────
+    {"DJI",                  CAT_DRONE,            PRIORITY_HIGH},
+    {"Skydio",               CAT_DRONE,            PRIORITY_CRITICAL},
+    {"Parrot",               CAT_DRONE,            PRIORITY_MODERATE},
+    {"Autel",                CAT_DRONE,            PRIORITY_HIGH},
+    // ── Body-worn cameras ─────────────────────────────────────────
+    {"Axon",                 CAT_BODYCAM,          PRIORITY_HIGH},
+    {"Taser",                CAT_BODYCAM,          PRIORITY_HIGH},
+    {"Reveal Media",         CAT_BODYCAM,          PRIORITY_MODERATE},
+    {"WCCTV",                CAT_BODYCAM,          PRIORITY_MODERATE},
+    {"Motorola Solutions",   CAT_BODYCAM,          PRIORITY_MODERATE},
+    // ── Fixed / PTZ surveillance cameras ─────────────────────────
+    {"FLIR",                 CAT_CCTV,             PRIORITY_HIGH},
+    {"Hikvision",            CAT_CCTV,             PRIORITY_HIGH},
+    {"Dahua",                CAT_CCTV,             PRIORITY_HIGH},
+    {"Axis Comm",            CAT_CCTV,             PRIORITY_HIGH},
+    {"Hanwha",               CAT_CCTV,             PRIORITY_HIGH},
+    {"Bosch Security",       CAT_CCTV,             PRIORITY_HIGH},
+    {"Pelco",                CAT_CCTV,             PRIORITY_HIGH},
+    {"Uniview",              CAT_CCTV,             PRIORITY_HIGH},
+    {"Milestone",            CAT_CCTV,             PRIORITY_MODERATE},
+    {"IndigoVision",         CAT_CCTV,             PRIORITY_MODERATE},
+    // ── Facial recognition / AI analytics ────────────────────────
+    {"Avigilon",             CAT_FACIAL_RECOG,     PRIORITY_CRITICAL},
+    {"Genetec",              CAT_FACIAL_RECOG,     PRIORITY_HIGH},
+    {"NEC ",                 CAT_FACIAL_RECOG,     PRIORITY_HIGH},  // trailing space: "NEC" is inside "Connected"
+    {"Briefcam",             CAT_FACIAL_RECOG,     PRIORITY_CRITICAL},
+    // ── ANPR / traffic ────────────────────────────────────────────
+    {"Siemens",              CAT_ANPR,             PRIORITY_HIGH},
+    {"Jenoptik",             CAT_ANPR,             PRIORITY_HIGH},
+    {"Kapsch",               CAT_TRAFFIC,          PRIORITY_MODERATE},
+};
+
+static const KeywordDefault SSID_KEYWORDS[] = {
+    {"HIKVISION",  CAT_CCTV,         PRIORITY_HIGH},
+    {"DAHUA",      CAT_CCTV,         PRIORITY_HIGH},
+    {"AXIS-",      CAT_CCTV,         PRIORITY_HIGH},
+    {"AVIGILON",   CAT_FACIAL_RECOG, PRIORITY_CRITICAL},
+    {"GENETEC",    CAT_FACIAL_RECOG, PRIORITY_CRITICAL},
+    {"AXON-",      CAT_BODYCAM,      PRIORITY_HIGH},
+    {"DJI-",       CAT_DRONE,        PRIORITY_HIGH},
+    {"MAVIC",      CAT_DRONE,        PRIORITY_HIGH},
+    {"PHANTOM",    CAT_DRONE,        PRIORITY_MODERATE},
+    {"ANPR",       CAT_ANPR,         PRIORITY_HIGH},
+    {"NVR",        CAT_CCTV,         PRIORITY_MODERATE},
+    {"IPCAM",      CAT_CCTV,         PRIORITY_MODERATE},
+    {"CCTV",       CAT_CCTV,         PRIORITY_MODERATE},
+};
+
+static const KeywordDefault GROUP_KEYWORDS[] = {
+    {"drone",      CAT_DRONE,            0}, {"dji",        CAT_DRONE,            0},
+    {"skydio",     CAT_DRONE,            0}, {"parrot",     CAT_DRONE,            0},
+    {"body",       CAT_BODYCAM,          0}, {"axon",       CAT_BODYCAM,          0},
+    {"wcctv",      CAT_BODYCAM,          0}, {"reveal",     CAT_BODYCAM,          0},
+    {"anpr",       CAT_ANPR,             0},
+    {"face",       CAT_FACIAL_RECOG,     0}, {"genetec",    CAT_FACIAL_RECOG,     0},
+    {"nec_",       CAT_FACIAL_RECOG,     0}, {"cognitec",   CAT_FACIAL_RECOG,     0},
+    {"hikvis",     CAT_CCTV,             0}, {"dahua",      CAT_CCTV,             0},
+    {"pelco",      CAT_CCTV,             0}, {"axis_",      CAT_CCTV,             0},
+    {"traffic",    CAT_SMART_CITY_INFRA, 0}, {"smart_city", CAT_SMART_CITY_INFRA, 0},
+    {"city",       CAT_SMART_CITY_INFRA, 0},
+};
+
+#define KEYWORDS_PATH     "/keywords.json"
+#define KEYWORD_ENTRY_DOC 256
+
+// "Drone" / "drone" / "3" -> CAT_DRONE; CAT_UNKNOWN if unrecognised
+static DeviceCategory parseCategoryName(const char* name) {
+    if (!name || !*name) return CAT_UNKNOWN;
+    if (isDigit(name[0])) {
+        int id = atoi(name);
+        return (id >= 0 && id <= CAT_SMART_CITY_INFRA) ? (DeviceCategory)id : CAT_UNKNOWN;
+    }
+    for (int c = CAT_CCTV; c <= CAT_SMART_CITY_INFRA; c++) {
+        if (strcasecmp(name, getCategoryName((DeviceCategory)c)) == 0) return (DeviceCategory)c;
+    }
+    return CAT_UNKNOWN;
+}
+
+// Stream one section of /keywords.json into `m` (same element-at-a-time
+// parse as the priority loader). Returns the number of keywords added.
+// withPriority: entries must carry a priority of 1-5 (BLE company, SSID);
+// group keywords only set a category and store priority 0.
+static int loadKeywordSection(File& file, const char* key, KeywordMatcher& m, bool withPriority) {
+    if (!seekJsonArray(file, key)) return 0;
+    StaticJsonDocument<64> filter;
+    for (const char* k : {"keyword", "category", "priority"}) filter[k] = true;
+    StaticJsonDocument<KEYWORD_ENTRY_DOC> doc;
+    int added = 0;
+    do {
+        DeserializationError error = deserializeJson(doc, file, DeserializationOption::Filter(filter));
+        if (error) {
+            Serial.printf("[WARN] %s %s entry %d: %s — rest of section skipped\n",
+                          KEYWORDS_PATH, key, added, error.c_str());
+            break;
+        }
+        JsonVariant cat = doc["category"];
+        int id = cat.as<int>();
+        DeviceCategory c = cat.is<int>() ? ((id > 0 && id <= CAT_SMART_CITY_INFRA) ? (DeviceCategory)id : CAT_UNKNOWN)
+                                         : parseCategoryName(cat | "");
+        const char* kw = doc["keyword"] | "";
+        int pri = withPriority ? (doc["priority"] | 0) : 0;
+        if (withPriority && (pri < PRIORITY_BASELINE || pri > PRIORITY_CRITICAL)) {
+            Serial.printf("[WARN] %s %s: keyword '%s' priority must be 1-5 — skipped\n", KEYWORDS_PATH, key, kw);
+            continue;
+        }
+        if (c == CAT_UNKNOWN || !m.add(kw, c, pri)) {
+            Serial.printf("[WARN] %s %s: bad keyword '%s' — skipped\n", KEYWORDS_PATH, key, kw);
+            continue;
+        }
+        added++;
+    } while (file.findUntil(",", "]"));
+    return added;
+}
+
+// Build the three keyword automata for `t`: SD additions first (they win),
+// then the built-in tables. Called before the priority entries are indexed,
+// since the index uses groupKeywords to categorise priority entries.
+void loadKeywordTables(PriorityTable& t) {
+    struct Set { const char* key; KeywordMatcher* m; const KeywordDefault* defs; size_t n; bool withPriority; };
+    const Set sets[] = {
+        {"\"ble_company\"", &t.bleKeywords,   BLE_KEYWORDS,   sizeof(BLE_KEYWORDS) / sizeof(BLE_KEYWORDS[0]),     true},
+        {"\"ssid\"",        &t.ssidKeywords,  SSID_KEYWORDS,  sizeof(SSID_KEYWORDS) / sizeof(SSID_KEYWORDS[0]),   true},
+        {"\"group\"",       &t.groupKeywords, GROUP_KEYWORDS, sizeof(GROUP_KEYWORDS) / sizeof(GROUP_KEYWORDS[0]), false},
+    };
+    File file;
+    if (sdCardAvailable && SD.exists(KEYWORDS_PATH)) file = SD.open(KEYWORDS_PATH);
+    int fromSD = 0;
+    for (const Set& set : sets) {
+        set.m->clear();
+        if (file) fromSD += loadKeywordSection(file, set.key, *set.m, set.withPriority);
+        for (size_t i = 0; i < set.n; i++) set.m->add(set.defs[i].keyword, set.defs[i].cat, set.defs[i].priority);
+        set.m->build();
+    }
+    if (file) {
+        file.close();
+        Serial.printf("Keywords: %d from %s, %d BLE / %d SSID / %d group in total\n", fromSD, KEYWORDS_PATH,
+                      (int)t.bleKeywords.size(), (int)t.ssidKeywords.size(), (int)t.groupKeywords.size());
+    }
+}
+
+// Category implied by a correlation group name (CAT_UNKNOWN if none)
+DeviceCategory categoryFromGroup(const PriorityTable& t, uint8_t groupId) {
+    int k = t.groupKeywords.match(t.groups.name(groupId));
+    return k >= 0 ? (DeviceCategory)t.groupKeywords.info(k).category : CAT_UNKNOWN;
+}
+
+// ============================================================
+// CLASSIFICATION RULES
+// ============================================================
+
+// checkOUI() resolves the OUI, extracts a ClassFeatures vector and runs it
+// through t.classRules (see class_rules.h). The built-in rules below are the
+// heuristics that used to be hand-written branches there; /classify.json adds
+// rules ahead of them:
+//   { "rules": [
+//       { "id": "remote-id", "if": {"svc_uuid": "FFFA", "category": "unknown"},
+//         "then": {"category": "Drone", "priority": 4, "relevance": "high"}, "stop": true } ] }
+// "if" keys are features (category, priority, relevance, prefix_bits,
+// local_addr, public_addr, ble, company_id, svc_uuid, company_keyword,
+// name_keyword); a value is matched for equality, true/false mean non-zero /
+// zero, and {"not": v} / {"min": v} / {"max": v} give the other compares.
+// "then" takes category, priority, relevance, priority_max and drop.
+
+#define CLASS_RULES_PATH   "/classify.json"
+#define CLASS_RULE_DOC     768
+
+static const ClassRule BUILTIN_CLASS_RULES[] = {
+    // Randomised MAC, no OUI match, no BT company ID: anonymous consumer ping,
+    // counted on the status bar but not worth a row
+    { { {CF_CATEGORY, CO_EQ, CAT_UNKNOWN}, {CF_LOCAL_ADDR, CO_EQ, 1}, {CF_PREFIX_BITS, CO_EQ, 0},
+        {CF_COMPANY_ID, CO_EQ, CLASS_NO_COMPANY} }, 4, CS_RULE, CR_DROP,
+      CLASS_KEEP, CLASS_KEEP, CLASS_KEEP, "anon-random" },
+    // BT company name keyword — the company ID is not randomised, so DJI/Axon/FLIR
+    // are identified even behind a random MAC
+    { { {CF_BLE, CO_EQ, 1}, {CF_CATEGORY, CO_EQ, CAT_UNKNOWN}, {CF_COMPANY_KW, CO_NE, 0} }, 3,
+      CS_COMPANY_KEYWORD, 0, CLASS_KEEP, CLASS_KEEP, CLASS_KEEP, "ble-company" },
+    // SSID / BLE name keyword — cameras and NVRs that broadcast their brand
+    { { {CF_CATEGORY, CO_EQ, CAT_UNKNOWN}, {CF_NAME_KW, CO_NE, 0} }, 2,
+      CS_NAME_KEYWORD, CR_PRIORITY_MAX | CR_RELEVANCE_FROM_PRI, CLASS_KEEP, CLASS_KEEP, CLASS_KEEP, "name-keyword" },
+};
+
+static const char* const CLASS_FEATURE_NAMES[CF_COUNT] = {
+    "category", "priority", "relevance", "prefix_bits", "local_addr", "public_addr",
+    "ble", "company_id", "svc_uuid", "company_keyword", "name_keyword"
+};
+
+// Value of one condition / action field: number, hex string ("FFFA",
+// "0x004C"), category or relevance name, or true/false. Numbers outside the
+// feature's range (e.g. category 40, priority 9) fail the rule.
+static bool parseClassValue(uint8_t feature, JsonVariant v, uint16_t& out) {
+    if (v.is<bool>())     { out = v.as<bool>() ? 1 : 0; return feature != CF_SVC_MASK; }
+    long lo = 0, hi = 0xFFFF;
+    switch (feature) {
+        case CF_CATEGORY: case CF_COMPANY_KW: case CF_NAME_KW: hi = CAT_SMART_CITY_INFRA; break;
+        case CF_PRIORITY:    lo = PRIORITY_BASELINE; hi = PRIORITY_CRITICAL; break;
+        case CF_RELEVANCE:   lo = REL_LOW; hi = REL_HIGH; break;
+        case CF_PREFIX_BITS: hi = 48; break;
+        case CF_LOCAL_ADDR: case CF_PUBLIC_ADDR: case CF_BLE: hi = 1; break;
+    }
+    if (v.is<int>()) {
+        int n = v.as<int>();
+        if (n < lo || n > hi) return false;
+        out = (uint16_t)n;
+        return true;
+    }
+    const char* s = v | "";
+    if (!*s) return false;
+    if (feature == CF_CATEGORY || feature == CF_COMPANY_KW || feature == CF_NAME_KW) {
+        if (strcasecmp(s, "unknown") == 0 || strcasecmp(s, "none") == 0) { out = CAT_UNKNOWN; return true; }
+        out = parseCategoryName(s);
+        return out != CAT_UNKNOWN;
+    }
+    if (feature == CF_RELEVANCE) {
+        for (int r = REL_LOW; r <= REL_HIGH; r++) {
+            if (strcasecmp(s, getRelevanceName((RelevanceLevel)r)) == 0) { out = r; return true; }
+        }
+        return false;
+    }
+    char* end;
+    unsigned long n = strtoul(s, &end, 16);
+    if (*end || (long)n < lo || n > (unsigned long)hi) return false;
+    out = (uint16_t)n;
+    return true;
+}
+
+// Compile one /classify.json rule into `r`. False (rule skipped) on any error,
+// with `why` naming it where the cause is more specific than a malformed rule.
+static bool compileClassRule(ClassRuleSet& set, JsonObject src, ClassRule& r, const char*& why) {
+    why = "invalid";
+    memset(&r, 0, sizeof(r));
+    strncpy(r.id, src["id"] | "sd-rule", sizeof(r.id) - 1);
+    for (JsonPair kv : src["if"].as<JsonObject>()) {
+        int f = 0;
+        while (f < CF_COUNT && strcmp(kv.key().c_str(), CLASS_FEATURE_NAMES[f])) f++;
+        if (f == CF_COUNT) return false;
+        if (r.nCond >= CLASS_RULE_MAX_CONDS) return false;
+        ClassCond& c = r.cond[r.nCond++];
+        c.feature = f;
+        c.op = CO_EQ;
+        JsonVariant v = kv.value();
+        if (v.is<JsonObject>()) {
+            JsonObject o = v.as<JsonObject>();
+            if      (o.containsKey("not")) { c.op = CO_NE; v = o["not"]; }
+            else if (o.containsKey("min")) { c.op = CO_GE; v = o["min"]; }
+            else if (o.containsKey("max")) { c.op = CO_LE; v = o["max"]; }
+            else return false;
+        } else if (v.is<bool>() && f != CF_LOCAL_ADDR && f != CF_PUBLIC_ADDR && f != CF_BLE && f != CF_SVC_MASK) {
+            c.op = v.as<bool>() ? CO_NE : CO_EQ;   // "company_keyword": true = any hit
+            c.value = 0;
+            continue;
+        }
+        if (!parseClassValue(f, v, c.value)) return false;
+        if (f == CF_SVC_MASK) {
+            if (c.op != CO_EQ) return false;        // only "carries this UUID"
+            c.op = CO_ANY;
+            c.value = set.svcBit(c.value);
+            if (!c.value) return false;
+        }
+    }
+    JsonObject then = src["then"];
+    r.source    = CS_RULE;
+    r.flags     = (then["drop"] | false ? CR_DROP : 0) | (src["stop"] | false ? CR_STOP : 0) |
+                  (then["priority_max"] | false ? CR_PRIORITY_MAX : 0);
+    r.category  = CLASS_KEEP;
+    r.priority  = CLASS_KEEP;
+    r.relevance = CLASS_KEEP;
+    uint16_t v;
+    if (then.containsKey("category")) {
+        if (!parseClassValue(CF_CATEGORY, then["category"], v)) return false;
+        r.category = v;
+    }
+    if (then.containsKey("priority")) {
+        if (!parseClassValue(CF_PRIORITY, then["priority"], v)) { why = "priority must be 1-5"; return false; }
+        r.priority = v;
+    }
+    if (then.containsKey("relevance")) {
+        if (!parseClassValue(CF_RELEVANCE, then["relevance"], v)) return false;
+        r.relevance = v;
+    }
+    return r.nCond > 0;    // an unconditional rule would hit every frame
+}
+
+// SD rules first (in file order), then the built-ins
+void loadClassRules(PriorityTable& t) {
+    t.classRules.clear();
+    int fromSD = 0;
+    File file;
+    if (sdCardAvailable && SD.exists(CLASS_RULES_PATH)) file = SD.open(CLASS_RULES_PATH);
+    if (file && seekJsonArray(file, "\"rules\"")) {
+        StaticJsonDocument<CLASS_RULE_DOC> doc;
+        int n = 0;
+        do {
+            DeserializationError error = deserializeJson(doc, file);
+            if (error) {
+                Serial.printf("[WARN] %s rule %d: %s — remaining rules skipped\n", CLASS_RULES_PATH, n, error.c_str());
+                break;
+            }
+            ClassRule r;
+            const char* why;
+            if (!compileClassRule(t.classRules, doc.as<JsonObject>(), r, why)) {
+                Serial.printf("[WARN] %s rule %d ('%s') %s — skipped\n", CLASS_RULES_PATH, n, doc["id"] | "", why);
+            } else if (t.classRules.add(r)) {
+                fromSD++;
+            } else {
+                Serial.printf("[WARN] %s rule %d ('%s') table full — skipped\n", CLASS_RULES_PATH, n, doc["id"] | "");
             }
+            n++;
+        } while (file.findUntil(",", "]"));
+    }
+    if (file) file.close();
+    for (const ClassRule& r : BUILTIN_CLASS_RULES) t.classRules.add(r);
+    if (fromSD) Serial.printf("Classification: %d rules from %s, %d in total\n", fromSD, CLASS_RULES_PATH, (int)t.classRules.size());
+}
+
+// Record for a priority entry with no compiled OUI_DATABASE counterpart
+static ClassRecord priorityOnlyRecord(const PriorityTable& t, const PriorityEntry* pe) {
+    ClassRecord rec;
+    rec.oui        = nullptr;
+    rec.pri        = pe;
+    rec.category   = pe->groupId ? categoryFromGroup(t, pe->groupId) : CAT_UNKNOWN;
+    rec.relevance  = REL_LOW;
+    rec.deployment = DEPLOY_PRIVATE;
+    rec.priority   = pe->priority;
+    rec.groupId    = pe->groupId;
+    return rec;
+}
+
+// Sort and de-duplicate the priority entries (for a duplicate prefix the
+// later entry wins, as it always has), then merge the 24-bit ones with the
+// compiled OUI table into the classification index and file MA-M / MA-S
+// entries into their tiers. Runs once per load, never on the scan path.
+void PriorityTable::index() {
+    for (auto& pe : entries) {
+        uint64_t v = macPrefix(pe.oui, &pe.bits);
+        if (!prefixBitsValid(pe.bits)) { pe.bits = 0; pe.key = MAC_KEY_INVALID; continue; }
+        pe.key = v >> (48 - pe.bits);
+        formatPrefix(pe.oui, sizeof(pe.oui), pe.key, pe.bits);  // canonical "AA:BB:CC:D"
+    }
+    std::stable_sort(entries.begin(), entries.end(), [](const PriorityEntry& a, const PriorityEntry& b) {
+        return a.bits != b.bits ? a.bits < b.bits : a.key < b.key;
+    });
+    size_t out = 0;
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (!entries[i].bits) continue;
+        if (out && entries[out - 1].bits == entries[i].bits && entries[out - 1].key == entries[i].key) out--;
+        entries[out++] = entries[i];
+    }
+    entries.resize(out);
+    size_t n24 = 0;
+    while (n24 < entries.size() && entries[n24].bits == 24) n24++;
+
+    for (PrefixTier* tier : {&tier28, &tier36}) { tier->keys.clear(); tier->classes.clear(); }
+    for (size_t i = n24; i < entries.size(); i++) {
+        PrefixTier& tier = entries[i].bits == 28 ? tier28 : tier36;
+        tier.keys.push_back(entries[i].key);
+        tier.classes.push_back(priorityOnlyRecord(*this, &entries[i]));
+    }
+
+    // Compiled table in key order (first of any duplicate wins, as findOUI() did)
+    std::vector<std::pair<uint32_t, uint16_t>> compiled;
+    compiled.reserve(OUI_DATABASE_SIZE);
+    for (size_t i = 0; i < OUI_DATABASE_SIZE; i++) {
+        uint32_t k = ouiKey(OUI_DATABASE[i].oui);
+        if (k != OUI_KEY_INVALID) compiled.push_back({k, (uint16_t)i});
+    }
+    std::stable_sort(compiled.begin(), compiled.end(),
+                     [](const std::pair<uint32_t, uint16_t>& a, const std::pair<uint32_t, uint16_t>& b) {
+                         return a.first < b.first;
+                     });
+
+    keys.clear();
+    classes.clear();
+    keys.reserve(compiled.size() + n24);
+    classes.reserve(compiled.size() + n24);
+    size_t c = 0, p = 0;
+    while (c < compiled.size() || p < n24) {
+        uint32_t kc = c < compiled.size() ? compiled[c].first : OUI_KEY_INVALID;
+        uint32_t kp = p < n24 ? (uint32_t)entries[p].key : OUI_KEY_INVALID;
+        uint32_t key = min(kc, kp);
+        const OUIEntry* oe = (kc == key) ? &OUI_DATABASE[compiled[c].second] : nullptr;
+        const PriorityEntry* pe = (kp == key) ? &entries[p] : nullptr;
+        while (c < compiled.size() && compiled[c].first == key) c++;
+        if (pe) p++;
+
+        ClassRecord rec;
+        rec.oui        = oe;
+        rec.pri        = pe;
+        rec.category   = oe ? oe->category : CAT_UNKNOWN;
+        rec.relevance  = oe ? oe->relevance : REL_LOW;
+        rec.deployment = oe ? oe->deployment : DEPLOY_PRIVATE;
+        rec.priority   = oe ? ((oe->relevance == REL_HIGH) ? 4 : (oe->relevance == REL_MEDIUM) ? 3 : 2)
+                            : PRIORITY_LOW;
+        rec.groupId    = 0;
+        if (pe) {
+            rec.priority = pe->priority;
+            rec.groupId  = pe->groupId;
+            if (rec.category == CAT_UNKNOWN && rec.groupId) rec.category = categoryFromGroup(*this, rec.groupId);
         }
+        keys.push_back(key);
+        classes.push_back(rec);
     }
-    if (hashAlerts(activeAlerts) != prevHash) {
-        displayDirty = true;
+}
+
+// ============================================================
+// PRIORITY TABLE PUBLISH / HOT RELOAD
+// ============================================================
+
+// Readers outside xDetectionMutex (checkOUI, UI, web) take a reference for
+// the few lines they use the table; the correlation engine runs under the
+// mutex, and the swap happens under it too, so it never sees a mix of old
+// and new rules. A reload builds the next table in a background task and
+// only then swaps the pointer — nothing ever observes a half-built table.
+
+static portMUX_TYPE priorityTableMux = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool priorityReloadBusy = false;
+static uint32_t priorityFileSig = 0;          // size/mtime signature of the files last loaded
+static unsigned long lastPriorityWatch = 0;
+static const char* priorityUploadError = nullptr;  // set by the /api/priority upload handler
+
+#define PRIORITY_JSON_PATH     "/priority.json"
+#define PRIORITY_JSON_BAK_PATH "/priority.json.bak"  // set aside when a .bin is uploaded
+#define PRIORITY_WATCH_MS      5000           // SD file watcher period
+#define PRIORITY_UPLOAD_MAX    (256 * 1024)
+
+PriorityTable* acquirePriorityTable() {
+    portENTER_CRITICAL(&priorityTableMux);
+    PriorityTable* t = priorityTable;
+    t->refs++;
+    portEXIT_CRITICAL(&priorityTableMux);
+    return t;
+}
+
+void releasePriorityTable(PriorityTable* t) {
+    portENTER_CRITICAL(&priorityTableMux);
+    bool last = --t->refs == 0;
+    portEXIT_CRITICAL(&priorityTableMux);
+    if (last) delete t;
+}
+
+// Cheap change detector for the watcher: sizes and write times of the files
+static uint32_t priorityFilesSignature() {
+    uint32_t sig = 2166136261UL;
+    for (const char* path : {PRIORITY_BIN_PATH, PRIORITY_JSON_PATH, KEYWORDS_PATH, CLASS_RULES_PATH}) {
+        File f = SD.open(path);
+        uint32_t parts[2] = { f ? (uint32_t)f.size() : 0xFFFFFFFFUL, f ? (uint32_t)f.getLastWrite() : 0 };
+        if (f) f.close();
+        for (uint32_t v : parts) { sig ^= v; sig *= 16777619UL; }
     }
+    return sig;
+}
+
+// Fill `t` from SD: compiled image first, then JSON. False if neither loads.
+bool buildPriorityTable(PriorityTable& t) {
+    loadKeywordTables(t);  // first: the index categorises entries by group keyword
+    loadClassRules(t);
+    if (!sdCardAvailable) return false;
+    priorityFileSig = priorityFilesSignature();
+    if (loadPriorityBin(t, PRIORITY_BIN_PATH, PRIORITY_JSON_PATH)) { t.source = PRIORITY_BIN_PATH;  return true; }
+    if (loadPriorityDB(t, PRIORITY_JSON_PATH))                     { t.source = PRIORITY_JSON_PATH; return true; }
+    return false;
+}
+
+// Swap in `next`, re-classify the live table against it and rebuild the rule
+// index — all under xDetectionMutex. Only detections whose OUI entry changed
+// are re-classified; group counters are recounted by rebuildCorrelationIndex().
+void publishPriorityTable(PriorityTable* next) {
+    xSemaphoreTake(xDetectionMutex, portMAX_DELAY);
+    PriorityTable* prev = priorityTable;
+    portENTER_CRITICAL(&priorityTableMux);
+    priorityTable = next;
+    portEXIT_CRITICAL(&priorityTableMux);
+
+    int changed = 0;
+    if (prev) {
+        // Live state moves onto the new table's group IDs, matched by name
+        uint8_t idMap[MAX_CORRELATION_GROUPS] = {0};
+        for (uint8_t g = 1; g < prev->groups.count; g++) idMap[g] = next->groups.find(prev->groups.name(g));
+        remapCorrelationGroups(idMap);
+
+        for (auto& d : detections) {
+            uint64_t key = macKey(d.macAddress.c_str());
+            const PriorityEntry* oldPe = prev->findPriority(key);
+            const ClassRecord* rec = next->findMac(key);
+            const PriorityEntry* newPe = rec ? rec->pri : nullptr;
+            if (!oldPe && !newPe) continue;
+            if (oldPe && newPe && idMap[oldPe->groupId] == newPe->groupId && oldPe->priority == newPe->priority &&
+                oldPe->confidence == newPe->confidence && strcmp(oldPe->label, newPe->label) == 0 &&
+                strcmp(oldPe->context, newPe->context) == 0) continue;
+
+            d.groupId = newPe ? newPe->groupId : 0;  // counted afresh by rebuildCorrelationIndex()
+            // An entry that disappeared keeps its last label; it just stops correlating
+            if (newPe) {
+                d.manufacturer = newPe->label;
+                d.context      = newPe->context;
+                d.priority     = newPe->priority;
+                d.confidence   = newPe->confidence;
+                if (d.category == CAT_UNKNOWN) d.category = (DeviceCategory)rec->category;
+            }
+            d.threatScore = computeThreatScore(d);
+            changed++;
+        }
+        if (changed) {
+            std::sort(detections.begin(), detections.end(), [](const Detection& a, const Detection& b) {
+                if (a.threatScore != b.threatScore) return a.threatScore > b.threatScore;
+                if (a.priority    != b.priority)    return a.priority    > b.priority;
+                if (a.timestamp   != b.timestamp)   return a.timestamp   > b.timestamp;
+                return a.rssi > b.rssi;
+            });
+        }
+    }
+    rebuildCorrelationIndex();
+    xSemaphoreGive(xDetectionMutex);
+
+    if (prev) {
+        Serial.printf("[PRIORITY] Reloaded from %s: %d entries, %d rules, %d detections re-classified\n",
+                      next->source, (int)next->entries.size(), (int)next->rules.size(), changed);
+        releasePriorityTable(prev);  // freed here, or by the last reader still holding it
+    }
+    flushCorrelationAlerts();
+    displayDirty = true;
+}
+
+static void PriorityReloadTask(void* param) {
+    unsigned long t0 = millis();
+    PriorityTable* next = new PriorityTable;
+    if (buildPriorityTable(*next)) {
+        Serial.printf("[PRIORITY] Built in %lu ms — publishing\n", millis() - t0);
+        publishPriorityTable(next);
+    } else {
+        delete next;
+        Serial.println("[PRIORITY] Reload failed — keeping the current table");
+    }
+    portENTER_CRITICAL(&priorityTableMux);
+    priorityReloadBusy = false;
+    portEXIT_CRITICAL(&priorityTableMux);
+    vTaskDelete(NULL);
+}
+
+// Start a background rebuild unless one is already running
+bool requestPriorityReload(const char* reason) {
+    portENTER_CRITICAL(&priorityTableMux);
+    bool busy = priorityReloadBusy;
+    priorityReloadBusy = true;
+    portEXIT_CRITICAL(&priorityTableMux);
+    if (busy) return false;
+    Serial.printf("[PRIORITY] Reload requested (%s)\n", reason);
+    if (xTaskCreatePinnedToCore(PriorityReloadTask, "PriReload", 8192, NULL, 1, NULL, 0) != pdPASS) {
+        portENTER_CRITICAL(&priorityTableMux);
+        priorityReloadBusy = false;
+        portEXIT_CRITICAL(&priorityTableMux);
+        return false;
+    }
+    return true;
+}
+
+// Called from ScanTask: reload when priority.json / .bin, keywords.json or classify.json change on the card
+void checkPriorityFiles() {
+    if (!sdCardAvailable || priorityReloadBusy) return;
+    if (millis() - lastPriorityWatch < PRIORITY_WATCH_MS) return;
+    lastPriorityWatch = millis();
+    if (priorityFilesSignature() != priorityFileSig) requestPriorityReload("SD file changed");
 }
 
 // ============================================================
@@ -767,57 +2229,346 @@ int computeThreatScore(const Detection& det) {
 // BLE SCAN CALLBACK
 // ============================================================
 
+// While a target is locked: feed its samples to the tracker and pass only
+// its once-a-second refresh on to the queue; drop every other device
+static bool trackGate(const uint8_t* mac, int8_t rssi) {
+    if (!trackerActive()) return true;
+    if (!trackerMatch(mac)) return false;
+    return trackerSample(rssi);
+}
+
 class MyAdvertisedDeviceCallbacks: public NimBLEAdvertisedDeviceCallbacks {
     void onResult(NimBLEAdvertisedDevice* advertisedDevice) {
-        BLEMeta meta;
-
-        // Device name
-        String bleName = advertisedDevice->haveName() ? advertisedDevice->getName().c_str() : "";
-
-        // Manufacturer specific data → Bluetooth SIG company ID
-        if (advertisedDevice->haveManufacturerData()) {
-            std::string mfrData = advertisedDevice->getManufacturerData();
-            if (mfrData.size() >= 2) {
-                uint16_t companyId = (uint8_t)mfrData[0] | ((uint8_t)mfrData[1] << 8);
-                meta.company = lookupBTCompany(companyId);
-                if (meta.company.isEmpty()) {
-                    char buf[8]; snprintf(buf, sizeof(buf), "BT:%04X", companyId);
-                    meta.company = String(buf);
-                }
-            }
+        Sighting sg;
+        const uint8_t* a = advertisedDevice->getAddress().getNative();   // little-endian
+        for (int i = 0; i < 6; i++) sg.mac[i] = a[5 - i];
+        sg.rssi = (int8_t)advertisedDevice->getRSSI();
+        radioCount(RADIO_BLE);
+        if (!trackGate(sg.mac, sg.rssi)) return;
+
+        // One pass over the raw advert + scan response; no NimBLE accessor
+        // copies (each of those re-walks the payload and builds a std::string)
+        BleAdv adv;
+        bleAdvParse(advertisedDevice->getPayload(), advertisedDevice->getPayloadLength(), adv);
+
+        sg.channel = 0;
+        sg.rxChannel = 0;
+        sg.isBLE = true;
+        sg.fromAP = false;
+        sg.hopStep = false;
+        sg.publicAddr = (advertisedDevice->getAddressType() == BLE_ADDR_PUBLIC);
+        sg.hasTxPower = adv.hasTxPower;
+        sg.txPower = adv.txPower;
+        sg.companyId = adv.hasCompanyId() ? adv.companyId() : CLASS_NO_COMPANY;
+        // Service UUIDs of every size + service data UUIDs, for the rule table
+        sg.svcCount = (uint8_t)bleAdvShortUuids(adv, sg.svcUuids, BLE_META_MAX_UUIDS);
+        size_t n = adv.name ? min((size_t)adv.nameLen, (size_t)SIGHTING_NAME_LEN) : 0;
+        memcpy(sg.name, adv.name, n);
+        sg.name[n] = '\0';
+
+        if (xQueueSend(sightingQueue, &sg, 0) != pdTRUE) radioDrop(RADIO_BLE);
+    }
+};
+
+// One instance for the life of the scan (the scan holds a raw pointer)
+static MyAdvertisedDeviceCallbacks bleCallbacks;
+
+// ============================================================
+// WIFI PROMISCUOUS CALLBACK
+// ============================================================
+
+void onPromiscuousPacket(const uint8_t* mac, int8_t rssi, uint8_t channel, uint8_t rxChannel, const char* ssid,
+                         bool fromAP) {
+    radioCount(RADIO_WIFI_SNIFF);
+    if (!trackGate(mac, rssi)) return;
+
+    Sighting sg;
+    memcpy(sg.mac, mac, 6);
+    sg.rssi = rssi;
+    sg.channel = channel;
+    sg.rxChannel = rxChannel;
+    sg.isBLE = false;
+    sg.fromAP = fromAP;
+    sg.hopStep = hopperActive();
+    sg.publicAddr = false;
+    sg.hasTxPower = false;
+    sg.txPower = 0;
+    sg.companyId = CLASS_NO_COMPANY;
+    sg.svcCount = 0;
+    // ssid is non-null (may be empty string) — kept for AP/beacon identification
+    strncpy(sg.name, ssid, SIGHTING_NAME_LEN);
+    sg.name[SIGHTING_NAME_LEN] = '\0';
+
+    if (xQueueSend(sightingQueue, &sg, 0) != pdTRUE) radioDrop(RADIO_WIFI_SNIFF);
+}
+
+// Access points heard by the sniffer since the last cycle (one per BSSID per pass)
+static int sniffedAPs = 0;
+
+// Blue LED blinks per BLE advert handled; the scan itself runs continuously,
+// so holding it on would say nothing. Tracking keeps it lit as its own cue.
+#define BLE_LED_PULSE_MS 30
+static unsigned long bleLedOffAt = 0;
+
+// ScanTask side: the lookups the callbacks used to do inline
+static void processSighting(const Sighting& sg) {
+    char macStr[18];
+    snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
+             sg.mac[0], sg.mac[1], sg.mac[2], sg.mac[3], sg.mac[4], sg.mac[5]);
+    if (!sg.isBLE) {
+        if (sg.fromAP) sniffedAPs++;
+        checkOUI(String(macStr), sg.rssi, false, String(sg.name), nullptr, sg.channel,
+                 sg.hopStep ? sg.rxChannel : 0);
+        return;
+    }
+
+    BLEMeta meta;
+    // Manufacturer specific data → Bluetooth SIG company ID
+    if (sg.companyId != CLASS_NO_COMPANY) {
+        meta.companyId = sg.companyId;
+        meta.company = lookupBTCompany(sg.companyId);
+        if (meta.company.isEmpty()) {
+            char buf[8]; snprintf(buf, sizeof(buf), "BT:%04X", sg.companyId);
+            meta.company = String(buf);
         }
+    }
+    // Rule features get every UUID; the device type hint is the first recognised
+    meta.svcCount = sg.svcCount;
+    memcpy(meta.svcUuids, sg.svcUuids, sg.svcCount * sizeof(uint16_t));
+    for (uint8_t i = 0; i < meta.svcCount && meta.svcHint.isEmpty(); i++) {
+        meta.svcHint = getBLESvcHint(meta.svcUuids[i]);
+    }
+    meta.hasTxPower = sg.hasTxPower;          // for distance estimate
+    meta.txPower = sg.txPower;
+    meta.publicAddr = sg.publicAddr;
+    if (!trackerActive()) {
+        digitalWrite(LED_B_PIN, HIGH);
+        bleLedOffAt = millis() + BLE_LED_PULSE_MS;
+    }
+    checkOUI(String(macStr), sg.rssi, true, String(sg.name), &meta);
+}
 
-        // Service UUIDs → device type hint
-        for (int i = 0; i < (int)advertisedDevice->getServiceUUIDCount(); i++) {
-            NimBLEUUID u = advertisedDevice->getServiceUUID(i);
-            if (u.bitSize() == 16) {
-                meta.svcHint = getBLESvcHint(u.getNative()->u16.value);
-                if (!meta.svcHint.isEmpty()) break;
-            }
+// Wait up to `wait` for the first sighting, then take whatever else is queued
+static void drainSightings(TickType_t wait) {
+    Sighting sg;
+    if (xQueueReceive(sightingQueue, &sg, wait) == pdTRUE) {
+        do { processSighting(sg); } while (xQueueReceive(sightingQueue, &sg, 0) == pdTRUE);
+    }
+    if (bleLedOffAt && (long)(millis() - bleLedOffAt) >= 0) {
+        bleLedOffAt = 0;
+        if (!trackerActive()) digitalWrite(LED_B_PIN, LOW);
+    }
+}
+
+static void startSniffer() {
+    startWiFiPromiscuous(onPromiscuousPacket);
+    radioOn(RADIO_WIFI_SNIFF);
+}
+
+static void stopSniffer() {
+    hopperStop(AP_CHANNEL);
+    stopWiFiPromiscuous();
+    radioOff(RADIO_WIFI_SNIFF);
+}
+
+// Home returns for the next pass. The away bound only moves once enough
+// dashboard refreshes have come in since it last moved, so each step is
+// judged on traffic that actually ran under it.
+static uint16_t hopAwayMs = 0;
+static uint32_t hopAwaySetAt = 0;
+
+static void planHomeReturns() {
+    if (!webPortalActive || WiFi.softAPgetStationNum() == 0) {
+        hopperSetHome(AP_CHANNEL, 0, 0);    // nobody to serve: hop freely
+        return;
+    }
+    if (hopAwayMs == 0) {
+        hopAwayMs = constrain(config.portalP95Ms / 2, HOP_AWAY_MIN_MS, HOP_AWAY_MAX_MS);
+        hopAwaySetAt = millis();
+    }
+    PortalLatency lat;
+    if (portalLatencySummary(hopAwaySetAt, &lat) >= PORTAL_P95_MIN_SAMPLES) {
+        uint16_t prev = hopAwayMs;
+        if (lat.p95Ms > config.portalP95Ms) {
+            hopAwayMs = max(HOP_AWAY_MIN_MS, hopAwayMs * 3 / 4);
+        } else if (lat.p95Ms < config.portalP95Ms / 2) {
+            hopAwayMs = min(HOP_AWAY_MAX_MS, hopAwayMs * 5 / 4);
         }
+        hopAwaySetAt = millis();
+        if (hopAwayMs != prev) {
+            Serial.printf("[HOP] Portal P95 %u ms (target %u): away bound %u -> %u ms\n",
+                          lat.p95Ms, config.portalP95Ms, prev, hopAwayMs);
+        }
+    }
+    hopperSetHome(AP_CHANNEL, hopAwayMs, HOP_HOME_HOLD_MS);
+}
 
-        // TX power (for distance estimate)
-        meta.hasTxPower = advertisedDevice->haveTXPower();
-        if (meta.hasTxPower) meta.txPower = (int8_t)advertisedDevice->getTXPower();
+// ============================================================
+// TARGET LOCK
+// ============================================================
+// Everything radio-side runs in ScanTask; the web and UI tasks only queue
+// a TrackRequest. A WiFi target parks the sniffer on its channel with the
+// BLE scan off; a BLE target gets a white-listed, unfiltered scan with the
+// sniffer off. Unlocking hands the radios back to the normal cycle.
+
+static uint32_t trackEventId = 0;
+static void onBLEScanEnded(NimBLEScanResults);
+
+// The white list matches on address type too, and a detection doesn't
+// keep it — list the address as both
+static void bleWhiteList(const char* macStr, bool add) {
+    NimBLEAddress pub(std::string(macStr), BLE_ADDR_PUBLIC);
+    NimBLEAddress rnd(std::string(macStr), BLE_ADDR_RANDOM);
+    if (add) { NimBLEDevice::whiteListAdd(pub); NimBLEDevice::whiteListAdd(rnd); }
+    else     { NimBLEDevice::whiteListRemove(pub); NimBLEDevice::whiteListRemove(rnd); }
+}
 
-        // Address type
-        meta.publicAddr = (advertisedDevice->getAddressType() == BLE_ADDR_PUBLIC);
+// WiFi lock on a channel other than the hotspot's: with clients connected the
+// target's channel alternates with AP_CHANNEL holds under the same away bound
+// as a scan pass (planHomeReturns), so the dashboard and the reading stream
+// stay up. With nobody connected the radio stays on the target's channel.
+static uint8_t trackChannel = 0;     // WiFi target channel, 0 = no WiFi lock
+static bool trackSharing = false;    // currently alternating with AP_CHANNEL
+
+static void serviceTrackChannel() {
+    if (!trackChannel || trackChannel == AP_CHANNEL) return;
+    bool share = webPortalActive && WiFi.softAPgetStationNum() > 0;
+    if (share) {
+        if (hopperActive()) return;
+        HopStep step = {trackChannel, TRACK_SHARE_PASS_MS};
+        hopperSetPlan(&step, 1);
+        planHomeReturns();
+        hopperSweep(AP_CHANNEL);
+    } else if (trackSharing) {
+        hopperStop(trackChannel);
+    }
+    trackSharing = share;
+}
+
+static void endTracking() {
+    TrackReading r;
+    trackerRead(&r);
+    if (!r.active) return;
+    trackerStop();
 
-        checkOUI(advertisedDevice->getAddress().toString().c_str(),
-                 advertisedDevice->getRSSI(), true, bleName, &meta);
+    char macStr[18];
+    snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
+             r.mac[0], r.mac[1], r.mac[2], r.mac[3], r.mac[4], r.mac[5]);
+    NimBLEScan* pBLEScan = NimBLEDevice::getScan();
+    if (r.isBLE) {
+        if (pBLEScan->isScanning()) pBLEScan->stop();
+        radioOff(RADIO_BLE);
+        bleWhiteList(macStr, false);
+        pBLEScan->setFilterPolicy(BLE_HCI_SCAN_FILT_NO_WL);
+        pBLEScan->setDuplicateFilter(true);
+    } else {
+        setPromiscuousTarget(nullptr);
+        hopperStop(AP_CHANNEL);    // a shared lock may be mid-pass; the next cycle sweeps afresh
+        trackChannel = 0;
+        trackSharing = false;
     }
-};
+    bleScanRestart = true;     // back to the configured interval / window; startBLEScan() turns RADIO_BLE on
+    lastScanTime = 0;          // and a full cycle straight away
+
+    char buf[48];
+    snprintf(buf, sizeof(buf), "{\"mac\":\"%s\"}", macStr);
+    trackEvents.send(buf, "end", ++trackEventId);
+    if (currentScreen == SCREEN_TRACK) currentScreen = SCREEN_MAIN;
+    displayDirty = true;
+    Serial.printf("[TRACK] Released %s after %lu s, %lu samples\n",
+                  macStr, (unsigned long)(r.elapsedMs / 1000), (unsigned long)r.samples);
+}
+
+static void beginTracking(const TrackRequest& req) {
+    endTracking();             // switching targets
+    char macStr[18];
+    snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
+             req.mac[0], req.mac[1], req.mac[2], req.mac[3], req.mac[4], req.mac[5]);
+
+    NimBLEScan* pBLEScan = NimBLEDevice::getScan();
+    if (pBLEScan->isScanning()) pBLEScan->stop();
+    radioOff(RADIO_BLE);       // on again below for a BLE target, else when the lock ends
+    trackerStart(req.mac, req.isBLE, req.channel);
+    if (req.isBLE) {
+        if (radioIsOn(RADIO_WIFI_SNIFF)) stopSniffer();
+        bleWhiteList(macStr, true);
+        pBLEScan->setFilterPolicy(BLE_HCI_SCAN_FILT_USE_WL);
+        pBLEScan->setDuplicateFilter(false);   // every advert is a sample
+        pBLEScan->setInterval(TRACK_BLE_SCAN_MS);
+        pBLEScan->setWindow(TRACK_BLE_SCAN_MS);
+        if (pBLEScan->start(0, onBLEScanEnded, false)) radioOn(RADIO_BLE, 1.0f);
+        else Serial.println("[TRACK] BLE scan failed to start");
+        digitalWrite(LED_G_PIN, LOW);
+        digitalWrite(LED_B_PIN, HIGH);
+    } else {
+        if (!radioIsOn(RADIO_WIFI_SNIFF)) startSniffer();
+        hopperStop(req.channel);
+        trackChannel = req.channel;
+        trackSharing = false;
+        serviceTrackChannel();
+        setPromiscuousTarget(req.mac);
+        digitalWrite(LED_B_PIN, LOW);
+        digitalWrite(LED_G_PIN, HIGH);
+    }
+    currentScreen = SCREEN_TRACK;
+    displayDirty = true;
+    Serial.printf("[TRACK] Locked on %s (%s, ch %u)\n", macStr, req.isBLE ? "BLE" : "WiFi", req.channel);
+}
+
+static void publishTrackReading() {
+    TrackReading r;
+    trackerRead(&r);
+    if (trackEvents.count() > 0) {
+        char buf[192];
+        snprintf(buf, sizeof(buf),
+                 "{\"mac\":\"%02X:%02X:%02X:%02X:%02X:%02X\",\"rssi\":%.1f,\"raw\":%d,\"trend\":%.1f,"
+                 "\"rate\":%.1f,\"samples\":%lu,\"age\":%lu,\"lost\":%s}",
+                 r.mac[0], r.mac[1], r.mac[2], r.mac[3], r.mac[4], r.mac[5],
+                 r.rssi, r.rawRssi, r.trendDbps, r.rateHz, (unsigned long)r.samples,
+                 (unsigned long)r.ageMs, r.ageMs >= TRACK_STALE_MS ? "true" : "false");
+        trackEvents.send(buf, "reading", ++trackEventId);
+    }
+    if (currentScreen == SCREEN_TRACK) displayDirty = true;
+}
+
+// Lock on a device from the detection list; its protocol and channel come
+// from the list entry. False if it isn't listed or has no known channel.
+bool requestTrackLock(const String& mac) {
+    TrackRequest req = {};
+    if (!trackerParseMac(mac.c_str(), req.mac)) return false;
+    bool found = false;
+    xSemaphoreTake(xDetectionMutex, portMAX_DELAY);
+    for (auto& d : detections) {
+        if (d.macAddress.equalsIgnoreCase(mac)) {
+            req.isBLE = d.isBLE;
+            req.channel = d.channel;
+            found = true;
+            break;
+        }
+    }
+    xSemaphoreGive(xDetectionMutex);
+    if (!found || (!req.isBLE && (req.channel < 1 || req.channel > WIFI_CHANNELS))) return false;
+    xQueueOverwrite(trackQueue, &req);
+    return true;
+}
 
-// ============================================================
-// WIFI PROMISCUOUS CALLBACK
-// ============================================================
+void requestTrackStop() {
+    TrackRequest req = {};
+    req.stop = true;
+    xQueueOverwrite(trackQueue, &req);
+}
 
-void onPromiscuousPacket(const uint8_t* mac, int8_t rssi, uint8_t channel, const char* ssid) {
-    char macStr[18];
-    snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
-             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
-    // ssid is non-null (may be empty string) — pass through for AP/beacon identification
-    checkOUI(String(macStr), rssi, false, String(ssid), nullptr, channel);
+// Switch scan profile. Everything is read from the profile live; the BLE scan
+// is restarted so it picks up the new timing (unless the user has set their own).
+void applyScanProfile(ScanMode mode) {
+    const ScanProfile& p = scanProfile(mode);
+    config.scanMode = mode;
+    bleScanRestart = true;
+    lastScanTime = 0;          // next cycle starts under the new profile
+    scanProfileActivate(mode);
+    displayDirty = true;
+    Serial.printf("[SCAN] Profile: %s (cycle %u ms, est. %.0f mA)\n", scanModeName(mode), p.cycleMs,
+                  scanProfileEstimateMa(mode, webPortalActive, config.brightness));
 }
 
 // ============================================================
@@ -833,39 +2584,79 @@ void ScanTask(void *pvParameters) {
             if (!sdCardAvailable) {
                 if (SD.begin(SD_CS, sdSPI)) {
                     sdCardAvailable = true;
-                    ouiCache.clear();  // force re-lookup with newly mounted card
+                    ouiCacheClear();   // force re-lookup with newly mounted card
                     btCache.clear();
                     Serial.println("[SD] Card remounted — caches cleared");
                 }
             }
         }
+        checkPriorityFiles();  // hot-reload priority.json / priority.bin edited on the card
+        flushDetectionLog(false);
 
-        if (config.setupComplete && millis() - lastScanTime >= (unsigned long)scanInterval) {
-            scanning = true;
-            if (config.enableBLE) {
-                digitalWrite(LED_B_PIN, HIGH);  // Blue = BLE scan
-                scanBLE();
-                digitalWrite(LED_B_PIN, LOW);
+        TrackRequest req;
+        if (xQueueReceive(trackQueue, &req, 0) == pdTRUE) {
+            if (req.stop) endTracking();
+            else          beginTracking(req);
+        }
+        if (trackerActive()) {
+            // Target lock: no scan cycle, readings out at TRACK_REPORT_MS
+            static unsigned long lastReport = 0;
+            unsigned long since = millis() - lastReport;
+            if (since >= TRACK_REPORT_MS) {
+                publishTrackReading();
+                lastReport = millis();
+                since = 0;
             }
+            serviceTrackChannel();
+            correlationTick();
+            drainSightings(pdMS_TO_TICKS(TRACK_REPORT_MS - since));
+            continue;
+        }
+
+        const ScanProfile& prof = scanProfile(config.scanMode);
+        if (config.setupComplete && millis() - lastScanTime >= prof.cycleMs) {
+            scanning = true;
+            serviceBLEScan();   // BLE runs continuously; this only restarts / counts
             if (config.enableWiFi) {
                 digitalWrite(LED_G_PIN, HIGH);  // Green = WiFi scan
-                scanWiFi();
-                // Promiscuous mode: catches probe requests, hidden APs, non-broadcasting devices
-                startWiFiPromiscuous(onPromiscuousPacket);
-                scanAllChannels(onPromiscuousPacket, 150);
-                stopWiFiPromiscuous();
-                digitalWrite(LED_G_PIN, LOW);
+                if (config.wifiActiveScan) {
+                    // Fallback: blocking active sweep first; it needs the radio out of promiscuous mode
+                    if (radioIsOn(RADIO_WIFI_SNIFF)) stopSniffer();
+                    scanWiFi();
+                } else {
+                    // APs come from the beacons and probe responses the last pass heard
+                    lastWiFiCount = sniffedAPs;
+                    totalScanned += sniffedAPs;
+                    Serial.printf("[SCAN] WiFi: %d access points from beacons\n", sniffedAPs);
+                }
+                sniffedAPs = 0;
+                // Promiscuous mode: beacons, probe requests, hidden APs, non-broadcasting devices.
+                // The hop timer walks the plan in the background, then parks on the
+                // portal's channel (capture continues, AP clients keep their link)
+                // unless the profile turns capture off between sweeps.
+                // Green LED stays lit until the pass completes.
+                if (!radioIsOn(RADIO_WIFI_SNIFF)) startSniffer();
+                if (config.hopAdaptive) hopperAdaptPlan(HOP_PASS_SHARES * prof.hopDwellMs, config.hopExplorePct);
+                else                    hopperDefaultPlan(prof.hopDwellMs);
+                planHomeReturns();
+                hopperSweep(AP_CHANNEL);
+            } else if (radioIsOn(RADIO_WIFI_SNIFF)) {
+                stopSniffer();
             }
+            radioWindowClose();
             scanning = false;
             lastScanTime = millis();
 
-            // Run correlation engine after each scan cycle
-            runCorrelationEngine();
-
             Serial.printf("[SCAN] Cycle complete: BLE=%d WiFi=%d | Total=%d matched=%d | Detections=%d\n",
                           lastBLECount, lastWiFiCount, totalScanned, totalMatched, detections.size());
         }
-        vTaskDelay(pdMS_TO_TICKS(100));
+        correlationTick();  // rotate time windows so windowed alerts clear when sightings stop
+        drainSightings(pdMS_TO_TICKS(100));   // also the loop's 100 ms pacing
+        if (!hopperActive()) {
+            digitalWrite(LED_G_PIN, LOW);
+            // Pass done: the profile decides whether capture stays parked until the next one
+            if (!prof.wifiPark && radioIsOn(RADIO_WIFI_SNIFF)) stopSniffer();
+        }
     }
 }
 
@@ -891,10 +2682,10 @@ void UITask(void *pvParameters) {
         }
         batteryVoltage = readBattery();
 
-        // Periodic refresh every 5 seconds — reduces flicker from fillScreen redraws.
-        // Touch events and screen changes still trigger immediate redraws.
+        // Periodic refresh at the scan profile's cadence — reduces flicker from
+        // fillScreen redraws. Touch events and screen changes still redraw at once.
         static unsigned long lastPeriodicRefresh = 0;
-        if (millis() - lastPeriodicRefresh >= 5000) {
+        if (millis() - lastPeriodicRefresh >= scanProfile(config.scanMode).displayRefreshMs) {
             displayDirty = true;
             lastPeriodicRefresh = millis();
         }
@@ -925,6 +2716,7 @@ void UITask(void *pvParameters) {
 // and the hitbox extends from ROW_Y - SETTINGS_ROW_PAD to ROW_Y + SETTINGS_ROW_HEIGHT - SETTINGS_ROW_PAD.
 static const int SETTINGS_ROW_Y[]     = {42, 66, 90, 114, 138};
 static const int SETTINGS_ROW_HEIGHT  = 24;
+static const int SETTINGS_PROFILE_Y   = 162;     // scan profile selector, below the toggles
 static const int SETTINGS_HIT_X_MIN   = 20;
 static const int SETTINGS_HIT_X_MAX   = 260;
 
@@ -975,6 +2767,9 @@ void setup() {
     Serial.println("UK-OUI-SPY PRO v" VERSION);
     Serial.println("============================");
     xDetectionMutex = xSemaphoreCreateMutex();
+    sightingQueue = xQueueCreate(SIGHTING_QUEUE_LEN, sizeof(Sighting));
+    trackQueue = xQueueCreate(1, sizeof(TrackRequest));
+    hopperDefaultPlan(scanProfile(config.scanMode).hopDwellMs);
 
     // Pin setup
     Serial.println("[BOOT] Configuring GPIO...");
@@ -1051,6 +2846,8 @@ void setup() {
     Serial.println("[BOOT] loadConfig OK");
     Serial.printf("[BOOT] Touch cal: X=%d..%d  Y=%d..%d\n",
                   config.calXMin, config.calXMax, config.calYMin, config.calYMax);
+    scanProfileActivate(config.scanMode);   // stored BLE interval / window stay as saved
+    Serial.printf("[BOOT] Scan profile: %s\n", scanModeName(config.scanMode));
 
     // Skip wizard — boot straight to main screen
     config.setupComplete = true;
@@ -1065,6 +2862,7 @@ void setup() {
         SD.mkdir("/sessions");
         snprintf(sessionLogPath, sizeof(sessionLogPath), "/sessions/%s.csv", sessionId);
         Serial.printf("[BOOT] Log path: %s\n", sessionLogPath);
+        sessionIndexBegin(SD, sessionId);
         // Read WiFi credentials from /wifi.txt (SSID line 1, password line 2)
         if (SD.exists("/wifi.txt")) {
             File wf = SD.open("/wifi.txt", FILE_READ);
@@ -1091,7 +2889,13 @@ void setup() {
 
     // Load priority database (SD first, then static fallback)
     Serial.println("[BOOT] Loading priority DB...");
-    if (!loadPriorityDB("/priority.json")) initializeStaticPriorityDB();
+    unsigned long priT0 = millis();
+    uint32_t priHeap0 = ESP.getFreeHeap();
+    PriorityTable* bootTable = new PriorityTable;
+    if (!buildPriorityTable(*bootTable)) initializeStaticPriorityDB(*bootTable);
+    Serial.printf("[BOOT] Priority DB from %s in %lu ms (heap %d KB -> %d KB)\n",
+                  bootTable->source, millis() - priT0, (int)(priHeap0 / 1024), (int)(ESP.getFreeHeap() / 1024));
+    publishPriorityTable(bootTable);  // index rules by group; counters are incremental from here on
     Serial.println("[BOOT] Priority DB OK");
 
     Serial.println("[BOOT] initBLE...");
@@ -1104,6 +2908,7 @@ void setup() {
     Serial.println("[BOOT] initWiFi...");
     initWiFi();
     Serial.println("[BOOT] initWiFi OK");
+    radioSetShare((RadioShare)config.radioShare);   // both stacks up: coexistence applies now
     bootTag("WiFi scanner",
             config.enableWiFi ? "ACTIVE" : "DISABLED",
             config.enableWiFi ? 0x07E0   : 0x4A49);               // green / grey
@@ -1173,7 +2978,16 @@ void initSDCard() {
     sdSPI.begin(SD_SCLK, SD_MISO, SD_MOSI, SD_CS);
     sdCardAvailable = SD.begin(SD_CS, sdSPI);
 }
-void initBLE() { NimBLEDevice::init("UK-OUI-SPY"); }
+void initBLE() {
+    // Filter configuration must precede init()
+    NimBLEDevice::setScanFilterMode(0);   // CONFIG_BTDM_SCAN_DUPL_TYPE_DEVICE: by address
+    NimBLEDevice::setScanDuplicateCacheSize(BLE_DUP_CACHE_SIZE);
+    NimBLEDevice::init("UK-OUI-SPY");
+    NimBLEScan* pBLEScan = NimBLEDevice::getScan();
+    pBLEScan->setAdvertisedDeviceCallbacks(&bleCallbacks, false);
+    pBLEScan->setDuplicateFilter(true);
+    pBLEScan->setMaxResults(0);           // stream only, keep nothing
+}
 void initWiFi() {
     if (config.enableWebPortal) {
         WiFi.mode(WIFI_AP_STA);
@@ -1198,30 +3012,79 @@ void initWiFi() {
     }
 }
 
-void scanBLE() {
+// ── Continuous BLE scan ───────────────────────────────────────────────────
+// One scan runs indefinitely in the NimBLE host task and streams every advert
+// to a single, persistent callback object. Nothing is stored (max results 0),
+// and the controller filters duplicates, so ScanTask never blocks on BLE.
+
+static uint32_t bleCountedAdverts = 0;
+
+static void onBLEScanEnded(NimBLEScanResults) {
+    radioOff(RADIO_BLE);
+    Serial.println("[SCAN] BLE scan stopped");
+}
+
+static void startBLEScan() {
+    NimBLEScan* pBLEScan = NimBLEDevice::getScan();
+    uint16_t interval = bleScanInterval(), window = bleScanWindow();
+    pBLEScan->setInterval(interval);
+    pBLEScan->setWindow(window);
+    if (!pBLEScan->start(0, onBLEScanEnded, false)) {
+        Serial.println("[SCAN] BLE scan failed to start");
+        return;
+    }
+    radioOn(RADIO_BLE, (float)window / interval);
+    Serial.printf("[SCAN] BLE continuous scan: interval %u ms, window %u ms%s\n",
+                  interval, window, config.bleIntervalMs ? " (custom)" : "");
+}
+
+// Called once per scan cycle from ScanTask
+void serviceBLEScan() {
     NimBLEScan* pBLEScan = NimBLEDevice::getScan();
-    pBLEScan->setAdvertisedDeviceCallbacks(new MyAdvertisedDeviceCallbacks(), true);
-    pBLEScan->start(2, false);
-    int found = pBLEScan->getResults().getCount();
-    lastBLECount = found;
-    totalScanned += found;
-    Serial.printf("[SCAN] BLE: %d devices found\n", found);
-    pBLEScan->clearResults();
+    if (!config.enableBLE) {
+        if (pBLEScan->isScanning()) pBLEScan->stop();
+        radioOff(RADIO_BLE);
+        digitalWrite(LED_B_PIN, LOW);
+        lastBLECount = 0;
+        return;
+    }
+    if (bleScanRestart && pBLEScan->isScanning()) {
+        pBLEScan->stop();
+        radioOff(RADIO_BLE);
+    }
+    bleScanRestart = false;
+    if (!pBLEScan->isScanning()) startBLEScan();
+
+    uint32_t seen = radioEvents(RADIO_BLE);
+    lastBLECount = (int)(seen - bleCountedAdverts);
+    totalScanned += lastBLECount;
+    bleCountedAdverts = seen;
+    pBLEScan->clearDuplicateCache();   // next cycle reports every device again
+    Serial.printf("[SCAN] BLE: %d devices this cycle\n", lastBLECount);
 }
 
+// Fallback AP discovery (config.wifiActiveScan): a blocking active probe on
+// every channel, for APs that beacon too rarely to be caught in one pass.
+// Off by default — the sniffer's beacons and probe responses cover the rest.
 void scanWiFi() {
+    radioOn(RADIO_WIFI_SCAN);
     int n = WiFi.scanNetworks(false, true, false, 100);
+    radioOff(RADIO_WIFI_SCAN);
+    radioCount(RADIO_WIFI_SCAN, max(n, 0));
     lastWiFiCount = max(n, 0);
     totalScanned += max(n, 0);
     Serial.printf("[SCAN] WiFi: %d networks found\n", n);
-    for (int i = 0; i < n; ++i) checkOUI(WiFi.BSSIDstr(i), WiFi.RSSI(i), false, WiFi.SSID(i));
+    for (int i = 0; i < n; ++i) checkOUI(WiFi.BSSIDstr(i), WiFi.RSSI(i), false, WiFi.SSID(i), nullptr, WiFi.channel(i));
 }
 
 // ============================================================
 // OUI CHECK WITH PRIORITY ENRICHMENT
 // ============================================================
 
-void checkOUI(String macAddress, int8_t rssi, bool isBLE, String name, BLEMeta* bleMeta, uint8_t channel) {
+// hopChannel: receive channel of a frame heard during a hop step (0 = none). It
+// can differ from `channel`, which for beacons is the AP's advertised one.
+void checkOUI(String macAddress, int8_t rssi, bool isBLE, String name, BLEMeta* bleMeta, uint8_t channel,
+              uint8_t hopChannel) {
     String mac = macAddress;
     mac.toUpperCase();
     String oui = mac.substring(0, 8);
@@ -1236,7 +3099,6 @@ void checkOUI(String macAddress, int8_t rssi, bool isBLE, String name, BLEMeta*
     det.sightings = 1;
     det.isBLE = isBLE;
     det.context = "";
-    det.correlationGroup = "";
     det.channel = channel;
     if (isBLE && bleMeta) {
         det.bleCompany    = bleMeta->company;
@@ -1246,172 +3108,155 @@ void checkOUI(String macAddress, int8_t rssi, bool isBLE, String name, BLEMeta*
         det.blePublicAddr = bleMeta->publicAddr;
     }
 
-    // Check OUI database
-    const OUIEntry* entry = findOUI(oui);
-    if (entry) {
-        totalMatched++;
-        Serial.printf("[OUI] MATCH: %s -> %s\n", oui.c_str(), entry->manufacturer);
-        det.manufacturer = entry->manufacturer;
-        det.category = entry->category;
-        det.relevance = entry->relevance;
-        det.deployment = entry->deployment;
-        det.priority = (det.relevance == REL_HIGH) ? 4 : (det.relevance == REL_MEDIUM) ? 3 : 2;
+    // One longest-prefix probe of the unified index: compiled OUI table + priority DB,
+    // merged at load. The reference is held until addDetection() has used its group ID.
+    PriorityTable* pt = acquirePriorityTable();
+    uint32_t key = ouiKey(oui.c_str());
+    uint8_t recBits = 0;
+    const ClassRecord* rec = pt->findMac(macKey(mac.c_str()), &recBits);
+    // A 24-bit record for an OUI that IEEE has sub-assigned describes the block
+    // owner, not this device — a longer MA-M/MA-S match on the card wins.
+    String sdName;
+    uint8_t sdBits = 0;
+    if (recBits == 24 && ouiHasSubBlocks(key)) {
+        sdName = sdLookupOUI(mac, &sdBits);
+        if (sdBits > 24) rec = nullptr;
+    }
+    if (rec) {
+        if (rec->oui) {
+            totalMatched++;
+            Serial.printf("[OUI] MATCH: %s -> %s\n", oui.c_str(), rec->oui->manufacturer);
+        }
+        det.manufacturer = rec->manufacturer();
+        det.context      = rec->context();
+        det.category     = (DeviceCategory)rec->category;
+        det.relevance    = (RelevanceLevel)rec->relevance;
+        det.deployment   = (DeploymentType)rec->deployment;
+        det.priority     = rec->priority;
+        det.confidence   = rec->confidence();
+        det.groupId      = rec->groupId;
     } else {
-        int firstByte = strtol(oui.substring(0, 2).c_str(), nullptr, 16);
-        if (firstByte & 0x02) {
-            // Locally-administered (privacy/randomised) MAC.
-            // Only keep if we have a BLE company ID — that gives us real intelligence.
-            // Anything else is an anonymous consumer ping with nothing identifiable.
-            if (isBLE && bleMeta && !bleMeta->company.isEmpty()) {
-                det.manufacturer = bleMeta->company;
-            } else {
-                totalAnonRND++;  // count but don't display — shown as RND counter in status bar
-                return;
-            }
+        det.category  = CAT_UNKNOWN;
+        det.relevance = REL_LOW;
+        det.priority  = PRIORITY_LOW;
+    }
+    // A real OUI the index does not know: resolve it from the SD IEEE database
+    // now, so the rules see the prefix length it actually matched
+    bool localAddr = key & 0x020000;   // locally administered (privacy/randomised)
+    if (!rec && !localAddr && sdName.isEmpty()) sdName = sdLookupOUI(mac, &sdBits);
+
+    // Feature vector, extracted once; the rule table does the rest in one pass
+    bool hasMeta = isBLE && bleMeta;
+    ClassFeatures f;
+    f.v[CF_CATEGORY]    = det.category;
+    f.v[CF_PRIORITY]    = det.priority;
+    f.v[CF_RELEVANCE]   = det.relevance;
+    f.v[CF_PREFIX_BITS] = rec ? recBits : sdBits;
+    f.v[CF_LOCAL_ADDR]  = localAddr;
+    f.v[CF_PUBLIC_ADDR] = hasMeta && bleMeta->publicAddr;
+    f.v[CF_BLE]         = isBLE;
+    f.v[CF_COMPANY_ID]  = hasMeta ? bleMeta->companyId : CLASS_NO_COMPANY;
+    f.v[CF_SVC_MASK]    = hasMeta ? pt->classRules.svcMask(bleMeta->svcUuids, bleMeta->svcCount) : 0;
+    f.companyKw = det.bleCompany.isEmpty() ? -1 : pt->bleKeywords.match(det.bleCompany.c_str(), det.bleCompany.length());
+    f.nameKw    = det.ssid.isEmpty()       ? -1 : pt->ssidKeywords.match(det.ssid.c_str(), det.ssid.length());
+    f.v[CF_COMPANY_KW]  = f.companyKw >= 0 ? pt->bleKeywords.info(f.companyKw).category : CAT_UNKNOWN;
+    f.v[CF_NAME_KW]     = f.nameKw >= 0    ? pt->ssidKeywords.info(f.nameKw).category   : CAT_UNKNOWN;
+
+    ClassOutcome oc = pt->classRules.evaluate(f, pt->bleKeywords, pt->ssidKeywords);
+    if (oc.drop) {
+        releasePriorityTable(pt);
+        if (f.v[CF_LOCAL_ADDR]) totalAnonRND++;  // count but don't display — shown as RND counter in status bar
+        return;
+    }
+    for (uint8_t i = 0; i < oc.fired && i < CLASS_MAX_FIRED; i++) {
+        const ClassRule& r = pt->classRules.rule(oc.firedRule[i]);
+        const char* kw = r.source == CS_COMPANY_KEYWORD && f.companyKw >= 0 ? pt->bleKeywords.info(f.companyKw).keyword
+                       : r.source == CS_NAME_KEYWORD && f.nameKw >= 0     ? pt->ssidKeywords.info(f.nameKw).keyword
+                       : "";
+        Serial.printf("[RULE] %s %s%s%s -> cat=%d pri=%d (%s)\n", mac.c_str(), r.id, *kw ? ": " : "", kw,
+                      f.v[CF_CATEGORY], f.v[CF_PRIORITY], isBLE ? det.bleCompany.c_str() : det.ssid.c_str());
+    }
+    det.category  = (DeviceCategory)f.v[CF_CATEGORY];
+    det.priority  = f.v[CF_PRIORITY];
+    det.relevance = (RelevanceLevel)f.v[CF_RELEVANCE];
+
+    if (!rec) {
+        if (f.v[CF_LOCAL_ADDR]) {
+            // Randomised MAC kept by a rule: the BT company is the only real name
+            det.manufacturer = hasMeta && !bleMeta->company.isEmpty() ? bleMeta->company : oui;
         } else {
-            // Real OUI: try SD IEEE database, then fall back to raw OUI prefix
-            String sdName = sdLookupOUI(oui);
+            // Real OUI: SD IEEE database name (looked up above), then the raw OUI prefix
             if (!sdName.isEmpty()) {
                 det.manufacturer = sdName;
-            } else if (isBLE && bleMeta && !bleMeta->company.isEmpty()) {
+            } else if (hasMeta && !bleMeta->company.isEmpty()) {
                 det.manufacturer = bleMeta->company;  // BT company as extra fallback
             } else {
                 det.manufacturer = oui;
             }
         }
-        det.category = CAT_UNKNOWN;
-        det.relevance = REL_LOW;
-        det.priority = PRIORITY_LOW;
-    }
-
-    // Enrich with priority database
-    auto priIt = priorityLookup.find(oui);
-    if (priIt != priorityLookup.end()) {
-        if (!det.manufacturer.length()) totalMatched++;  // count stage-2 only hits
-        det.manufacturer = priIt->second->label;
-        det.context = priIt->second->context;
-        det.correlationGroup = priIt->second->correlationGroup;
-        det.priority = priIt->second->priority;
-        det.confidence = priIt->second->confidence;
-    }
-
-    // Infer category from correlationGroup when OUI database has no category match.
-    // Devices in priority.json often lack a compiled OUI entry so category stays UNKNOWN
-    // without this step — which means no category badge and wrong typeStr on the card.
-    if (det.category == CAT_UNKNOWN && !det.correlationGroup.isEmpty()) {
-        String cg = det.correlationGroup;
-        cg.toLowerCase();
-        if      (cg.indexOf("drone") >= 0 || cg.indexOf("dji") >= 0 ||
-                 cg.indexOf("skydio") >= 0 || cg.indexOf("parrot") >= 0)
-            det.category = CAT_DRONE;
-        else if (cg.indexOf("body") >= 0 || cg.indexOf("axon") >= 0 ||
-                 cg.indexOf("wcctv") >= 0 || cg.indexOf("reveal") >= 0)
-            det.category = CAT_BODYCAM;
-        else if (cg.indexOf("anpr") >= 0)
-            det.category = CAT_ANPR;
-        else if (cg.indexOf("face") >= 0 || cg.indexOf("genetec") >= 0 ||
-                 cg.indexOf("nec_") >= 0 || cg.indexOf("cognitec") >= 0)
-            det.category = CAT_FACIAL_RECOG;
-        else if (cg.indexOf("hikvis") >= 0 || cg.indexOf("dahua") >= 0 ||
-                 cg.indexOf("pelco") >= 0  || cg.indexOf("axis_") >= 0)
-            det.category = CAT_CCTV;
-        else if (cg.indexOf("traffic") >= 0 || cg.indexOf("smart_city") >= 0 ||
-                 cg.indexOf("city") >= 0)
-            det.category = CAT_SMART_CITY_INFRA;
-    }
-
-    // BLE company-based surveillance boost — catches randomised-MAC devices
-    // Manufacturer-specific data company ID is NOT randomised, so DJI/Axon/FLIR
-    // can be identified by BT company ID even when MAC is random.
-    if (isBLE && det.category == CAT_UNKNOWN && !det.bleCompany.isEmpty()) {
-        struct BLEBoost { const char* keyword; DeviceCategory cat; int priority; };
-        static const BLEBoost boosts[] = {
-            // ── Drones ────────────────────────────────────────────────────
-            {"DJI",                  CAT_DRONE,            PRIORITY_HIGH},
-            {"Skydio",               CAT_DRONE,            PRIORITY_CRITICAL},
-            {"Parrot",               CAT_DRONE,            PRIORITY_MODERATE},
-            {"Autel",                CAT_DRONE,            PRIORITY_HIGH},
-            // ── Body-worn cameras ─────────────────────────────────────────
-            {"Axon",                 CAT_BODYCAM,          PRIORITY_HIGH},
-            {"Taser",                CAT_BODYCAM,          PRIORITY_HIGH},
-            {"Reveal Media",         CAT_BODYCAM,          PRIORITY_MODERATE},
-            {"WCCTV",                CAT_BODYCAM,          PRIORITY_MODERATE},
-            {"Motorola Solutions",   CAT_BODYCAM,          PRIORITY_MODERATE},
-            // ── Fixed / PTZ surveillance cameras ─────────────────────────
-            {"FLIR",                 CAT_CCTV,             PRIORITY_HIGH},
-            {"Hikvision",            CAT_CCTV,             PRIORITY_HIGH},
-            {"Dahua",                CAT_CCTV,             PRIORITY_HIGH},
-            {"Axis Comm",            CAT_CCTV,             PRIORITY_HIGH},
-            {"Hanwha",               CAT_CCTV,             PRIORITY_HIGH},
-            {"Bosch Security",       CAT_CCTV,             PRIORITY_HIGH},
-            {"Pelco",                CAT_CCTV,             PRIORITY_HIGH},
-            {"Uniview",              CAT_CCTV,             PRIORITY_HIGH},
-            {"Milestone",            CAT_CCTV,             PRIORITY_MODERATE},
-            {"IndigoVision",         CAT_CCTV,             PRIORITY_MODERATE},
-            // ── Facial recognition / AI analytics ────────────────────────
-            {"Avigilon",             CAT_FACIAL_RECOG,     PRIORITY_CRITICAL},
-            {"Genetec",              CAT_FACIAL_RECOG,     PRIORITY_HIGH},
-            {"NEC",                  CAT_FACIAL_RECOG,     PRIORITY_HIGH},
-            {"Briefcam",             CAT_FACIAL_RECOG,     PRIORITY_CRITICAL},
-            // ── ANPR / traffic ────────────────────────────────────────────
-            {"Siemens",              CAT_ANPR,             PRIORITY_HIGH},
-            {"Jenoptik",             CAT_ANPR,             PRIORITY_HIGH},
-            {"Kapsch",               CAT_TRAFFIC,          PRIORITY_MODERATE},
-        };
-        for (const auto& b : boosts) {
-            if (det.bleCompany.indexOf(b.keyword) >= 0) {
-                det.category = b.cat;
-                det.priority  = b.priority;
-                Serial.printf("[BLE-BOOST] %s -> %s (company: %s)\n",
-                              mac.c_str(), b.keyword, det.bleCompany.c_str());
-                break;
-            }
-        }
-    }
-
-    // SSID keyword detection — catches cameras/NVRs that broadcast their brand as SSID
-    // (e.g. "HIKVISION-NVR-01", "Dahua_IPC", "AXIS-P3245") even when OUI is unresolved
-    if (det.category == CAT_UNKNOWN && !det.ssid.isEmpty()) {
-        struct SSIDBoost { const char* keyword; DeviceCategory cat; int pri; };
-        static const SSIDBoost ssidBoosts[] = {
-            {"HIKVISION",  CAT_CCTV,         PRIORITY_HIGH},
-            {"DAHUA",      CAT_CCTV,         PRIORITY_HIGH},
-            {"AXIS-",      CAT_CCTV,         PRIORITY_HIGH},
-            {"AVIGILON",   CAT_FACIAL_RECOG, PRIORITY_CRITICAL},
-            {"GENETEC",    CAT_FACIAL_RECOG, PRIORITY_CRITICAL},
-            {"AXON-",      CAT_BODYCAM,      PRIORITY_HIGH},
-            {"DJI-",       CAT_DRONE,        PRIORITY_HIGH},
-            {"MAVIC",      CAT_DRONE,        PRIORITY_HIGH},
-            {"PHANTOM",    CAT_DRONE,        PRIORITY_MODERATE},
-            {"ANPR",       CAT_ANPR,         PRIORITY_HIGH},
-            {"NVR",        CAT_CCTV,         PRIORITY_MODERATE},
-            {"IPCAM",      CAT_CCTV,         PRIORITY_MODERATE},
-            {"CCTV",       CAT_CCTV,         PRIORITY_MODERATE},
-        };
-        String ssidU = det.ssid;
-        ssidU.toUpperCase();
-        for (const auto& sb : ssidBoosts) {
-            if (ssidU.indexOf(sb.keyword) >= 0) {
-                det.category  = sb.cat;
-                det.priority  = max(det.priority, sb.pri);
-                det.relevance = (sb.pri >= PRIORITY_HIGH) ? REL_HIGH : REL_MEDIUM;
-                Serial.printf("[SSID-BOOST] %s -> cat=%d pri=%d (SSID: %s)\n",
-                              mac.c_str(), (int)sb.cat, sb.pri, det.ssid.c_str());
-                break;
-            }
-        }
     }
 
     det.threatScore = computeThreatScore(det);
-    bool isNewDetection = addDetection(det);
+    bool isNewDetection = addDetection(det, pt);
+    releasePriorityTable(pt);
+    scanProfileNoteDetection(isNewDetection);
+    if (hopChannel && det.priority >= PRIORITY_HIGH) hopperCreditHit(hopChannel);   // steers adaptive dwell
+    flushCorrelationAlerts();  // rules touched by this sighting were re-evaluated inside addDetection
+    followerRecord(mac, det.manufacturer, rssi, isBLE);
 
     // Alert only on first detection — prevents constant LED spam on persistent devices
     if (isNewDetection && det.priority >= PRIORITY_MODERATE) {
         alertLED(det.priority);
     }
 
-    // Log to SD card
+    // Log to SD card — buffered, written at the scan profile's cadence by flushDetectionLog()
     if (config.enableLogging && sdCardAvailable) {
+        String proto  = isBLE ? "BLE" : "WiFi";
+        String catStr = getCategoryName(det.category);
+        // Quote fields that may contain commas
+        auto q = [](const String& s) -> String {
+            if (s.indexOf(',') >= 0) return "\"" + s + "\"";
+            return s;
+        };
+        String logData =
+            String(millis()) + "," +
+            mac              + "," +
+            proto            + "," +
+            q(det.manufacturer) + "," +
+            q(det.bleCompany)   + "," +
+            q(det.ssid)         + "," +
+            q(catStr)           + "," +
+            String(det.priority) + "," +
+            String(rssi)         + "," +
+            String(det.sightings);
+        xSemaphoreTake(xDetectionMutex, portMAX_DELAY);
+        logBuffer += logData;
+        logBuffer += "\r\n";
+        logRows.push_back({ mac, det.manufacturer, det.priority });
+        xSemaphoreGive(xDetectionMutex);
+    }
+}
+
+// Writes the buffered CSV lines and this session's catalogue record
+// (rewritten in place, ~100 bytes) once per profile logFlushMs, or early when
+// the buffer fills. One open/append/close per flush instead of per sighting.
+// Rows reach the catalogue only once they are on the card.
+// closing: final flush before deep sleep, also marks the session closed.
+void flushDetectionLog(bool closing) {
+    static unsigned long lastFlush = 0;
+    if (!closing && millis() - lastFlush < scanProfile(config.scanMode).logFlushMs &&
+        logBuffer.length() < LOG_BUFFER_MAX) {
+        return;
+    }
+    lastFlush = millis();
+    String pending;
+    std::vector<LoggedRow> rows;
+    xSemaphoreTake(xDetectionMutex, portMAX_DELAY);
+    std::swap(pending, logBuffer);
+    std::swap(rows, logRows);
+    xSemaphoreGive(xDetectionMutex);
+    if (!sdCardAvailable) return;
+    if (pending.length() > 0) {
         // Write CSV header on first entry
         bool needHeader = !SD.exists(sessionLogPath);
         File f = SD.open(sessionLogPath, FILE_APPEND);
@@ -1419,31 +3264,25 @@ void checkOUI(String macAddress, int8_t rssi, bool isBLE, String name, BLEMeta*
             if (needHeader) {
                 f.println("timestamp_ms,mac,protocol,manufacturer,company,ssid,category,priority,rssi,sightings");
             }
-            String proto  = isBLE ? "BLE" : "WiFi";
-            String catStr = getCategoryName(det.category);
-            // Quote fields that may contain commas
-            auto q = [](const String& s) -> String {
-                if (s.indexOf(',') >= 0) return "\"" + s + "\"";
-                return s;
-            };
-            String logData =
-                String(millis()) + "," +
-                mac              + "," +
-                proto            + "," +
-                q(det.manufacturer) + "," +
-                q(det.bleCompany)   + "," +
-                q(det.ssid)         + "," +
-                q(catStr)           + "," +
-                String(det.priority) + "," +
-                String(rssi)         + "," +
-                String(det.sightings);
-            f.println(logData); f.flush(); f.close();
+            size_t written = f.print(pending);
+            f.close();
+            if (written == pending.length()) {
+                for (const LoggedRow& r : rows) sessionIndexRecord(r.mac, r.vendor, r.priority);
+            } else {
+                Serial.printf("[SD] Log write short — %u of %u bytes\n", (unsigned)written, (unsigned)pending.length());
+            }
+        } else {
+            Serial.printf("[SD] Log write failed — %u bytes dropped\n", (unsigned)pending.length());
         }
     }
+    sessionIndexFlush(SD, closing);
 }
 
-bool addDetection(Detection det) {
+// `source` is the table det was classified against; if a reload has swapped
+// it out since, det's group ID is translated to the live table's by name.
+bool addDetection(Detection det, const PriorityTable* source) {
     xSemaphoreTake(xDetectionMutex, portMAX_DELAY);
+    if (det.groupId && source != priorityTable) det.groupId = priorityTable->groups.find(source->groups.name(det.groupId));
     bool found = false;
     for (auto &d : detections) {
         if (d.macAddress == det.macAddress) {
@@ -1451,6 +3290,14 @@ bool addDetection(Detection det) {
             d.timestamp = millis();
             d.sightings++;
             if (d.ssid.isEmpty() && !det.ssid.isEmpty()) d.ssid = det.ssid;
+            // Re-classified (e.g. priority DB changed) — move it between group counters;
+            // the windows move it out of the group it was counted under
+            if (d.groupId != det.groupId) {
+                adjustGroupCount(d.groupId, -1);
+                adjustGroupCount(det.groupId, +1);
+                d.groupId = det.groupId;
+            }
+            noteGroupSighting(d);
             // Recompute threat score with updated sightings and RSSI
             d.threatScore = computeThreatScore(d);
             found = true;
@@ -1459,7 +3306,15 @@ bool addDetection(Detection det) {
     }
     if (!found) {
         detections.insert(detections.begin(), det);
-        if ((int)detections.size() > MAX_DETECTIONS) { detections.pop_back(); totalEvicted++; }
+        adjustGroupCount(det.groupId, +1);
+        restoreGroupSighting(detections.front());
+        noteGroupSighting(detections.front());
+        if ((int)detections.size() > MAX_DETECTIONS) {
+            adjustGroupCount(detections.back().groupId, -1);
+            retireGroupSighting(detections.back());
+            detections.pop_back();
+            totalEvicted++;
+        }
     }
     // Sort: highest threat score first; ties broken by priority, then most recent, then RSSI
     std::sort(detections.begin(), detections.end(), [](const Detection& a, const Detection& b) {
@@ -1478,6 +3333,278 @@ bool addDetection(Detection det) {
 // WEB PORTAL
 // ============================================================
 
+// ── DETECTIONS API ────────────────────────────────────────────────────────
+// GET /api/detections accepts optional query parameters, all evaluated here
+// during serialization so a client only receives the rows it will display:
+//   minPriority=N        tier floor (1-5)
+//   proto=ble|wifi       protocol filter
+//   category=a,b,...     category names (as getCategoryName) or numeric IDs
+//   sort=threat|priority|rssi|recent|dwell   (default threat = table order)
+//   limit=N&offset=N     pagination over the filtered, sorted result
+//   fields=mac,rssi,...  only emit these keys per detection
+// A phone watching tier 4-5 only asks ?minPriority=4&fields=mac,manufacturer,rssi
+// and gets a few hundred bytes instead of the whole table.
+
+enum DetField : uint32_t {
+    DF_MAC = 0, DF_MANUFACTURER, DF_SSID, DF_BLE_COMPANY, DF_BLE_SVC_HINT, DF_CORR_GROUP,
+    DF_CONTEXT, DF_CATEGORY, DF_RELEVANCE, DF_PRIORITY, DF_THREAT, DF_RSSI, DF_TX_POWER,
+    DF_HAS_TX_POWER, DF_IS_BLE, DF_PUBLIC_ADDR, DF_SIGHTINGS, DF_STATIONARY, DF_FIRST_SEEN,
+    DF_LAST_SEEN, DF_AGE_SEC, DF_DWELL_SEC, DF_DEPLOYMENT, DF_CONFIDENCE, DF_CHANNEL,
+    DF_COUNT
+};
+// JSON key per field — index must match DetField
+static const char* const DET_FIELD_NAMES[DF_COUNT] = {
+    "mac", "manufacturer", "ssid", "bleCompany", "bleSvcHint", "correlationGroup",
+    "context", "category", "relevance", "priority", "threat", "rssi", "txPower",
+    "hasTxPower", "isBLE", "publicAddr", "sightings", "stationary", "firstSeen",
+    "lastSeen", "ageSec", "dwellSec", "deployment", "confidence", "channel"
+};
+static const uint32_t DET_FIELDS_ALL = (1UL << DF_COUNT) - 1;
+
+// Parse "mac,rssi,threat" into a DetField bitmask. Unknown names are ignored;
+// an empty or fully-unknown list falls back to every field.
+static uint32_t parseDetFields(const String& list) {
+    uint32_t mask = 0;
+    int start = 0;
+    while (start <= (int)list.length()) {
+        int comma = list.indexOf(',', start);
+        if (comma < 0) comma = list.length();
+        String name = list.substring(start, comma);
+        name.trim();
+        for (int f = 0; f < DF_COUNT; f++) {
+            if (name.equalsIgnoreCase(DET_FIELD_NAMES[f])) { mask |= 1UL << f; break; }
+        }
+        start = comma + 1;
+    }
+    return mask ? mask : DET_FIELDS_ALL;
+}
+
+// Parse "drone,cctv" or "3,1" into a DeviceCategory bitmask (0 = no filter)
+static uint32_t parseCategoryMask(const String& list) {
+    uint32_t mask = 0;
+    int start = 0;
+    while (start <= (int)list.length()) {
+        int comma = list.indexOf(',', start);
+        if (comma < 0) comma = list.length();
+        String name = list.substring(start, comma);
+        name.trim();
+        if (name.length() > 0) {
+            if (isDigit(name[0])) {
+                int id = name.toInt();
+                if (id >= 0 && id <= CAT_SMART_CITY_INFRA) mask |= 1UL << id;
+            } else {
+                for (int c = CAT_UNKNOWN; c <= CAT_SMART_CITY_INFRA; c++) {
+                    if (name.equalsIgnoreCase(getCategoryName((DeviceCategory)c))) { mask |= 1UL << c; break; }
+                }
+            }
+        }
+        start = comma + 1;
+    }
+    return mask;
+}
+
+static void serializeDetection(JsonObject obj, const Detection& d, const PriorityTable& t, uint32_t fields, unsigned long now) {
+    auto want = [fields](DetField f) { return (fields >> f) & 1UL; };
+    if (want(DF_MAC))          obj["mac"]              = d.macAddress;
+    if (want(DF_MANUFACTURER)) obj["manufacturer"]     = d.manufacturer;
+    if (want(DF_SSID))         obj["ssid"]             = d.ssid;
+    if (want(DF_BLE_COMPANY))  obj["bleCompany"]       = d.bleCompany;
+    if (want(DF_BLE_SVC_HINT)) obj["bleSvcHint"]       = d.bleSvcHint;
+    if (want(DF_CORR_GROUP))   obj["correlationGroup"] = t.groups.name(d.groupId);
+    if (want(DF_CONTEXT))      obj["context"]          = d.context;
+    if (want(DF_CATEGORY))     obj["category"]         = getCategoryName(d.category);
+    if (want(DF_RELEVANCE))    obj["relevance"]        = getRelevanceName(d.relevance);
+    if (want(DF_PRIORITY))     obj["priority"]         = d.priority;
+    if (want(DF_THREAT))       obj["threat"]           = d.threatScore;
+    if (want(DF_RSSI))         obj["rssi"]             = d.rssi;
+    if (want(DF_TX_POWER))     obj["txPower"]          = d.hasTxPower ? d.txPower : 0;
+    if (want(DF_HAS_TX_POWER)) obj["hasTxPower"]       = d.hasTxPower;
+    if (want(DF_IS_BLE))       obj["isBLE"]            = d.isBLE;
+    if (want(DF_PUBLIC_ADDR))  obj["publicAddr"]       = d.blePublicAddr;
+    if (want(DF_SIGHTINGS))    obj["sightings"]        = d.sightings;
+    if (want(DF_STATIONARY))   obj["stationary"]       = (d.sightings > 3);
+    if (want(DF_FIRST_SEEN))   obj["firstSeen"]        = d.firstSeen;
+    if (want(DF_LAST_SEEN))    obj["lastSeen"]         = d.timestamp;
+    if (want(DF_AGE_SEC))      obj["ageSec"]           = (now - d.timestamp) / 1000;
+    if (want(DF_DWELL_SEC))    obj["dwellSec"]         = (now - d.firstSeen) / 1000;
+    if (want(DF_DEPLOYMENT))   obj["deployment"]       = getDeploymentName(d.deployment);
+    if (want(DF_CONFIDENCE))   obj["confidence"]       = d.confidence;
+    if (want(DF_CHANNEL))      obj["channel"]          = d.channel;
+}
+
+// One row into its own document. Rows with unusually long strings (context,
+// SSID, names) retry with a larger one; a row that still does not fit is sent
+// truncated and reported rather than cut silently.
+#define DET_ROW_DOC     1024
+#define DET_ROW_DOC_MAX 4096
+static void streamDetectionRow(Print& out, const Detection& d, const PriorityTable& t, uint32_t fields, unsigned long now) {
+    for (size_t cap = DET_ROW_DOC; ; cap *= 2) {
+        DynamicJsonDocument row(cap);
+        serializeDetection(row.to<JsonObject>(), d, t, fields, now);
+        if (row.overflowed() && cap < DET_ROW_DOC_MAX) continue;
+        if (row.overflowed()) {
+            Serial.printf("[API] /api/detections: row %s exceeds %u bytes — truncated\n",
+                          d.macAddress.c_str(), (unsigned)DET_ROW_DOC_MAX);
+        }
+        serializeJson(row, out);
+        return;
+    }
+}
+
+void handleDetectionsRequest(AsyncWebServerRequest *req) {
+    auto param = [req](const char* name) -> String {
+        return req->hasParam(name) ? req->getParam(name)->value() : String();
+    };
+    int minPriority    = param("minPriority").toInt();
+    String proto       = param("proto");
+    uint32_t catMask   = parseCategoryMask(param("category"));
+    String sortKey     = param("sort");
+    int offset         = max(0L, param("offset").toInt());
+    int limit          = req->hasParam("limit") ? max(0L, param("limit").toInt()) : MAX_DETECTIONS;
+    uint32_t fields    = req->hasParam("fields") ? parseDetFields(param("fields")) : DET_FIELDS_ALL;
+    bool onlyBLE  = proto.equalsIgnoreCase("ble");
+    bool onlyWiFi = proto.equalsIgnoreCase("wifi");
+
+    // Filter + sort on (index, key) pairs under the mutex; copy only the requested page.
+    // The table is already kept in threat order, so the default sort is a no-op.
+    struct Row { uint16_t idx; long key; };
+    std::vector<Row> rows;
+    std::vector<Detection> page;
+    int total, highCount = 0;
+    unsigned long now = millis();
+
+    xSemaphoreTake(xDetectionMutex, portMAX_DELAY);
+    total = (int)detections.size();
+    rows.reserve(total);
+    for (int i = 0; i < total; i++) {
+        const Detection& d = detections[i];
+        if (d.priority >= PRIORITY_HIGH) highCount++;
+        if (d.priority < minPriority) continue;
+        if ((onlyBLE && !d.isBLE) || (onlyWiFi && d.isBLE)) continue;
+        if (catMask && !((catMask >> d.category) & 1UL)) continue;
+        long key = 0;
+        if      (sortKey == "priority") key = d.priority;
+        else if (sortKey == "rssi")     key = d.rssi;
+        else if (sortKey == "recent")   key = (long)d.timestamp;
+        else if (sortKey == "dwell")    key = (long)(now - d.firstSeen);
+        rows.push_back({(uint16_t)i, key});
+    }
+    if (!sortKey.isEmpty() && sortKey != "threat") {
+        std::stable_sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) { return a.key > b.key; });
+    }
+    int matched = (int)rows.size();
+    int first   = min(offset, matched);
+    int last    = min(matched, first + limit);
+    page.reserve(last - first);
+    for (int i = first; i < last; i++) page.push_back(detections[rows[i].idx]);
+    PriorityTable* table = acquirePriorityTable();  // the one the page's group IDs belong to
+    xSemaphoreGive(xDetectionMutex);
+
+    // Streamed one row at a time, so no document is sized from a guess at the page
+    AsyncResponseStream *res = req->beginResponseStream("application/json");
+    res->printf("{\"total\":%d,\"matched\":%d,\"offset\":%d,\"capacity\":%d,\"evicted\":%d,\"highCount\":%d,\"detections\":[",
+                total, matched, first, MAX_DETECTIONS, (int)totalEvicted, highCount);
+    for (size_t i = 0; i < page.size(); i++) {
+        if (i) res->print(',');
+        streamDetectionRow(*res, page[i], *table, fields, now);
+    }
+    releasePriorityTable(table);
+    res->print("]}");
+    req->send(res);
+}
+
+// ── SESSION LOG STREAMING ────────────────────────────────────────────────
+// Log endpoints never buffer whole files: responses are filled straight from
+// the open File in whatever chunk size AsyncTCP asks for.
+
+#define LOG_TAIL_DEFAULT 50
+#define LOG_TAIL_MAX     1000
+#define LOG_TAIL_BLOCK   512   // bytes read per backwards step when seeking the tail
+
+// Current session by default; ?session=XXXX-XXXX selects a past one.
+// The ID is validated as 4 hex + '-' + 4 hex so it can never escape /sessions/.
+static bool resolveSessionLogPath(AsyncWebServerRequest *req, char* out, size_t outLen) {
+    if (!req->hasParam("session")) {
+        strncpy(out, sessionLogPath, outLen - 1); out[outLen - 1] = 0;
+        return true;
+    }
+    const String& id = req->getParam("session")->value();
+    if (id.length() != 9 || id[4] != '-') return false;
+    for (int i = 0; i < 9; i++) {
+        if (i != 4 && !isxdigit((unsigned char)id[i])) return false;
+    }
+    snprintf(out, outLen, "/sessions/%s.csv", id.c_str());
+    return true;
+}
+
+// Offset of the first byte of the last `lines` lines, found by reading
+// backwards from EOF in fixed blocks. A trailing newline does not count as a line.
+static size_t findTailOffset(File& f, int lines) {
+    uint8_t buf[LOG_TAIL_BLOCK];
+    size_t pos = f.size();
+    bool skipTrailing = true;
+    while (pos > 0) {
+        size_t n = min((size_t)LOG_TAIL_BLOCK, pos);
+        pos -= n;
+        f.seek(pos);
+        if (f.read(buf, n) != n) return 0;
+        for (int i = (int)n - 1; i >= 0; i--) {
+            if (buf[i] != '\n') { skipTrailing = false; continue; }
+            if (skipTrailing) { skipTrailing = false; continue; }
+            if (--lines == 0) return pos + i + 1;
+        }
+    }
+    return 0;
+}
+
+// Parse a single "bytes=a-b" / "bytes=a-" / "bytes=-n" range against `size`.
+// Multi-range requests are not supported; the first range is served.
+static bool parseByteRange(const String& header, size_t size, size_t& first, size_t& last) {
+    if (!header.startsWith("bytes=")) return false;
+    int dash = header.indexOf('-', 6);
+    if (dash < 0) return false;
+    int comma = header.indexOf(',', dash);
+    String a = header.substring(6, dash);
+    String b = header.substring(dash + 1, comma < 0 ? header.length() : comma);
+    a.trim(); b.trim();
+    if (a.isEmpty()) {                       // suffix range: last n bytes
+        long n = b.toInt();
+        if (n <= 0) return false;
+        first = (size_t)n >= size ? 0 : size - n;
+        last  = size - 1;
+        return true;
+    }
+    long s = a.toInt();
+    if (s < 0 || (size_t)s >= size) return false;
+    first = s;
+    last  = b.isEmpty() ? size - 1 : min((size_t)b.toInt(), size - 1);
+    return last >= first;
+}
+
+// Send `len` bytes of `f` starting at `offset`. The File is held by the filler
+// lambda and closed when AsyncWebServer releases the response.
+static void streamFileRange(AsyncWebServerRequest *req, File f, size_t offset, size_t len,
+                            const char* contentType, int code, const char* attachName = nullptr) {
+    size_t total = f.size();
+    AsyncWebServerResponse *res = req->beginResponse(contentType, len,
+        [f, offset, len](uint8_t *buf, size_t maxLen, size_t index) mutable -> size_t {
+            if (index >= len) return 0;
+            size_t n = min(maxLen, len - index);
+            if (!f.seek(offset + index)) return 0;
+            return f.read(buf, n);
+        });
+    res->setCode(code);
+    res->addHeader("Accept-Ranges", "bytes");
+    if (code == 206) {
+        res->addHeader("Content-Range", "bytes " + String((unsigned long)offset) + "-" +
+                       String((unsigned long)(offset + len - 1)) + "/" + String((unsigned long)total));
+    }
+    if (attachName) {
+        res->addHeader("Content-Disposition", "attachment; filename=\"" + String(attachName) + "\"");
+    }
+    req->send(res);
+}
+
 void setupWebServer() {
     // Serve dashboard
     webServer.on("/", HTTP_GET, [](AsyncWebServerRequest *req){
@@ -1488,61 +3615,25 @@ void setupWebServer() {
     webServer.on("/hotspot-detect.html", HTTP_GET, [](AsyncWebServerRequest *req){ req->redirect("/"); });
     webServer.on("/connecttest.txt", HTTP_GET, [](AsyncWebServerRequest *req){ req->redirect("/"); });
 
-    // API: Get detections
-    webServer.on("/api/detections", HTTP_GET, [](AsyncWebServerRequest *req){
-        DynamicJsonDocument doc(20480);  // 50 detections * ~400 bytes each
-        xSemaphoreTake(xDetectionMutex, portMAX_DELAY);
-        auto snap = detections;
-        xSemaphoreGive(xDetectionMutex);
-        doc["total"]    = snap.size();
-        doc["capacity"] = MAX_DETECTIONS;
-        doc["evicted"]  = totalEvicted;
-        int highCount = 0;
-        JsonArray arr = doc.createNestedArray("detections");
-        for (auto &d : snap) {
-            if (d.priority >= PRIORITY_HIGH) highCount++;
-            JsonObject obj = arr.createNestedObject();
-            obj["mac"]           = d.macAddress;
-            obj["manufacturer"]  = d.manufacturer;
-            obj["ssid"]          = d.ssid;
-            obj["bleCompany"]    = d.bleCompany;
-            obj["bleSvcHint"]    = d.bleSvcHint;
-            obj["correlationGroup"] = d.correlationGroup;
-            obj["context"]       = d.context;
-            obj["category"]      = getCategoryName(d.category);
-            obj["relevance"]     = getRelevanceName(d.relevance);
-            obj["priority"]      = d.priority;
-            obj["threat"]        = d.threatScore;
-            obj["rssi"]          = d.rssi;
-            obj["txPower"]       = d.hasTxPower ? d.txPower : 0;
-            obj["hasTxPower"]    = d.hasTxPower;
-            obj["isBLE"]         = d.isBLE;
-            obj["publicAddr"]    = d.blePublicAddr;
-            obj["sightings"]     = d.sightings;
-            obj["stationary"]    = (d.sightings > 3);
-            obj["firstSeen"]     = d.firstSeen;
-            obj["lastSeen"]      = d.timestamp;
-            obj["ageSec"]        = (millis() - d.timestamp) / 1000;
-            obj["dwellSec"]      = (millis() - d.firstSeen) / 1000;
-            obj["deployment"]    = getDeploymentName(d.deployment);
-            obj["confidence"]    = d.confidence;
-            obj["channel"]       = d.channel;
-        }
-        doc["highCount"] = highCount;
-        String response;
-        serializeJson(doc, response);
-        req->send(200, "application/json", response);
-    });
+    // API: Get detections — filtered, sorted and paginated on-device (see DETECTIONS API above)
+    webServer.on("/api/detections", HTTP_GET, handleDetectionsRequest);
 
     // API: Get system status
     webServer.on("/api/status", HTTP_GET, [](AsyncWebServerRequest *req){
+        // The dashboard reports how long its previous refresh took
+        if (req->hasParam("rtt")) portalLatencyAdd(req->getParam("rtt")->value().toInt());
         DynamicJsonDocument doc(1024);
         doc["firmware"] = VERSION;
         int bp = constrain(map((int)(batteryVoltage * 100), 330, 420, 0, 100), 0, 100);
         doc["battery"] = bp;
         doc["freeHeap"] = ESP.getFreeHeap() / 1024;
         doc["ouiCount"] = OUI_DATABASE_SIZE;
-        doc["priorityCount"] = priorityDB.size();
+        PriorityTable* pt = acquirePriorityTable();
+        doc["priorityCount"]  = pt->entries.size();
+        doc["priorityRules"]  = pt->rules.size();
+        doc["prioritySource"] = pt->source;
+        releasePriorityTable(pt);
+        doc["priorityReloading"] = priorityReloadBusy;
         doc["sdCard"] = sdCardAvailable;
         doc["touch"] = touchAvailable;
         doc["scanning"] = scanning;
@@ -1561,6 +3652,165 @@ void setupWebServer() {
         req->send(200, "application/json", response);
     });
 
+    // API: Radio time-share and per-radio duty cycle
+    webServer.on("/api/radio", HTTP_GET, [](AsyncWebServerRequest *req){
+        DynamicJsonDocument doc(768);
+        doc["share"] = radioShareName(radioShare());
+        doc["wifiActiveScan"] = config.wifiActiveScan;
+        doc["bleWindowPct"] = 100 * bleScanWindow() / bleScanInterval();
+        doc["queued"] = uxQueueMessagesWaiting(sightingQueue);
+        for (uint8_t i = 0; i < RADIO_USE_COUNT; i++) {
+            RadioDuty d;
+            radioDuty((RadioUse)i, &d);
+            JsonObject r = doc.createNestedObject(radioUseName((RadioUse)i));
+            r["on"]          = radioIsOn((RadioUse)i);
+            r["dutyPct"]     = roundf(d.dutyPct * 10) / 10;
+            r["dutyAvgPct"]  = roundf(d.dutyAvgPct * 10) / 10;
+            r["eventsPerSec"] = roundf(d.eventsPerSec * 10) / 10;
+            r["activeSec"]   = d.activeMs / 1000;
+            r["events"]      = d.events;
+            r["dropped"]     = d.dropped;
+        }
+        String response;
+        serializeJson(doc, response);
+        req->send(200, "application/json", response);
+    });
+
+    // API: Scan profiles — parameters, modelled current and measured yield
+    webServer.on("/api/profiles", HTTP_GET, [](AsyncWebServerRequest *req){
+        DynamicJsonDocument doc(1536);
+        doc["active"] = scanModeName(config.scanMode);
+        doc["portal"] = webPortalActive;    // the hotspot keeps WiFi RX on: counted in estMa
+        JsonArray arr = doc.createNestedArray("profiles");
+        for (uint8_t i = 0; i < SCAN_MODE_COUNT; i++) {
+            const ScanProfile& p = scanProfile((ScanMode)i);
+            ScanProfileStats st;
+            scanProfileStats((ScanMode)i, &st);
+            float minutes = st.activeMs / 60000.0f;
+            JsonObject o = arr.createNestedObject();
+            o["name"]             = scanModeName((ScanMode)i);
+            o["cycleMs"]          = p.cycleMs;
+            o["bleInterval"]      = p.bleIntervalMs;
+            o["bleWindow"]        = p.bleWindowMs;
+            o["hopDwellMs"]       = p.hopDwellMs;
+            o["wifiPark"]         = p.wifiPark;
+            o["logFlushMs"]       = p.logFlushMs;
+            o["displayRefreshMs"] = p.displayRefreshMs;
+            o["estMa"]            = roundf(scanProfileEstimateMa((ScanMode)i, webPortalActive, config.brightness));
+            o["activeSec"]        = st.activeMs / 1000;
+            o["newDevices"]       = st.newDevices;
+            o["sightings"]        = st.sightings;
+            o["newPerMin"]        = minutes > 0 ? roundf(st.newDevices / minutes * 10) / 10 : 0;
+            o["sightingsPerMin"]  = minutes > 0 ? roundf(st.sightings / minutes * 10) / 10 : 0;
+        }
+        String response;
+        serializeJson(doc, response);
+        req->send(200, "application/json", response);
+    });
+
+    // API: Channel hopper — plan, measured dwell per channel, timer jitter
+    webServer.on("/api/hopper", HTTP_GET, [](AsyncWebServerRequest *req){
+        static HopperStats hs;              // ~500 bytes: keep off the async_tcp stack
+        hopperStats(&hs);
+        DynamicJsonDocument doc(6144);
+        doc["active"] = hs.active;
+        doc["channel"] = hs.channel;
+        doc["hops"] = hs.hops;
+        doc["sweeps"] = hs.sweeps;
+        doc["lastSweepMs"] = hs.lastSweepMs;
+        doc["jitterAvgUs"] = hs.jitterAvgUs;
+        doc["jitterMaxUs"] = hs.jitterMaxUs;
+        doc["adaptive"] = config.hopAdaptive;
+        doc["explorePct"] = config.hopExplorePct;
+        JsonObject home = doc.createNestedObject("home");
+        home["channel"] = hs.homeChannel;
+        home["maxAwayMs"] = hs.maxAwayMs;
+        home["holdMs"] = HOP_HOME_HOLD_MS;
+        home["returns"] = hs.homeReturns;
+        home["lastAwayMaxMs"] = hs.lastAwayMaxMs;
+        PortalLatency lat;
+        portalLatencySummary(millis() - 60000, &lat);
+        JsonObject portal = doc.createNestedObject("portal");
+        portal["targetP95Ms"] = config.portalP95Ms;
+        portal["samples"] = lat.count;             // dashboard refreshes, last minute
+        portal["p50Ms"] = lat.p50Ms;
+        portal["p95Ms"] = lat.p95Ms;
+        portal["maxMs"] = lat.maxMs;
+        static HopStep steps[HOP_PLAN_MAX];
+        uint8_t n = hopperGetPlan(steps, HOP_PLAN_MAX);
+        JsonArray plan = doc.createNestedArray("plan");
+        for (uint8_t i = 0; i < n; i++) {
+            JsonArray step = plan.createNestedArray();
+            step.add(steps[i].channel);
+            step.add(steps[i].dwellMs);
+        }
+        JsonArray chans = doc.createNestedArray("channels");
+        for (int c = 1; c <= WIFI_CHANNELS; c++) {
+            const HopChannelStats& cs = hs.ch[c];
+            JsonObject o = chans.createNestedObject();
+            o["ch"] = c;
+            o["planMs"] = cs.planDwellMs;
+            o["visits"] = cs.visits;
+            o["avgDwellMs"] = cs.visits ? cs.dwellMs / cs.visits : 0;
+            o["lastDwellMs"] = cs.lastDwellMs;
+            o["frames"] = cs.frames;
+            o["newMacs"] = cs.newMacs;
+            o["hits"] = cs.hits;
+            o["yield"] = roundf(cs.yield * 100) / 100;
+        }
+        String response;
+        serializeJson(doc, response);
+        req->send(200, "application/json", response);
+    });
+
+    // API: Target lock — current reading; POST {"mac":...} locks, DELETE releases.
+    // Readings stream on /api/track/events ("reading" at ~15 Hz, "end" on release).
+    webServer.on("/api/track", HTTP_GET, [](AsyncWebServerRequest *req){
+        TrackReading r;
+        trackerRead(&r);
+        DynamicJsonDocument doc(384);
+        doc["active"] = r.active;
+        if (r.active) {
+            char mac[18];
+            snprintf(mac, sizeof(mac), "%02X:%02X:%02X:%02X:%02X:%02X",
+                     r.mac[0], r.mac[1], r.mac[2], r.mac[3], r.mac[4], r.mac[5]);
+            doc["mac"]       = mac;
+            doc["type"]      = r.isBLE ? "BLE" : "WiFi";
+            doc["channel"]   = r.channel;
+            doc["rssi"]      = roundf(r.rssi * 10) / 10;
+            doc["raw"]       = r.rawRssi;
+            doc["trend"]     = roundf(r.trendDbps * 10) / 10;
+            doc["rate"]      = roundf(r.rateHz * 10) / 10;
+            doc["samples"]   = r.samples;
+            doc["age"]       = r.ageMs;
+            doc["lost"]      = r.ageMs >= TRACK_STALE_MS;
+            doc["elapsed"]   = r.elapsedMs / 1000;
+        }
+        String response;
+        serializeJson(doc, response);
+        req->send(200, "application/json", response);
+    });
+    webServer.on("/api/track", HTTP_POST, [](AsyncWebServerRequest *req){},
+        NULL,
+        [](AsyncWebServerRequest *req, uint8_t *data, size_t len, size_t index, size_t total){
+            StaticJsonDocument<128> doc;
+            if (deserializeJson(doc, data, len)) {
+                req->send(400, "application/json", "{\"error\":\"bad JSON\"}");
+                return;
+            }
+            if (!requestTrackLock(doc["mac"] | "")) {
+                req->send(404, "application/json", "{\"error\":\"mac must be a listed detection with a known channel\"}");
+                return;
+            }
+            req->send(202, "application/json", "{\"status\":\"locking\"}");
+        }
+    );
+    webServer.on("/api/track", HTTP_DELETE, [](AsyncWebServerRequest *req){
+        requestTrackStop();
+        req->send(200, "application/json", "{\"status\":\"released\"}");
+    });
+    webServer.addHandler(&trackEvents);
+
     // API: Get config
     webServer.on("/api/config", HTTP_GET, [](AsyncWebServerRequest *req){
         DynamicJsonDocument doc(512);
@@ -1572,6 +3822,15 @@ void setupWebServer() {
         doc["webPortal"] = config.enableWebPortal;
         doc["brightness"] = config.brightness;
         doc["apPassword"] = config.apPassword;
+        doc["bleInterval"] = bleScanInterval();
+        doc["bleWindow"] = bleScanWindow();
+        doc["bleCustom"] = config.bleIntervalMs != 0;   // false: following the scan profile
+        doc["radioShare"] = radioShareName((RadioShare)config.radioShare);
+        doc["hopAdaptive"] = config.hopAdaptive;
+        doc["hopExplorePct"] = config.hopExplorePct;
+        doc["portalP95Ms"] = config.portalP95Ms;
+        doc["wifiActiveScan"] = config.wifiActiveScan;
+        doc["scanMode"] = scanModeName(config.scanMode);
         String response;
         serializeJson(doc, response);
         req->send(200, "application/json", response);
@@ -1586,54 +3845,241 @@ void setupWebServer() {
                 req->send(400, "application/json", "{\"error\":\"bad JSON\"}");
                 return;
             }
-            if (doc.containsKey("ble")) config.enableBLE = doc["ble"];
-            if (doc.containsKey("wifi")) config.enableWiFi = doc["wifi"];
-            if (doc.containsKey("logging")) config.enableLogging = doc["logging"];
-            if (doc.containsKey("autoBrightness")) config.autoBrightness = doc["autoBrightness"];
-            if (doc.containsKey("brightness")) {
-                config.brightness = doc["brightness"];
-                setBrightness(config.brightness);
-            }
+            // Parse and validate every field into a copy first, so a 400 leaves
+            // the live config, the radios and the hotspot exactly as they were
+            Config next = config;
+            if (doc.containsKey("ble")) next.enableBLE = doc["ble"];
+            if (doc.containsKey("wifi")) next.enableWiFi = doc["wifi"];
+            if (doc.containsKey("logging")) next.enableLogging = doc["logging"];
+            if (doc.containsKey("autoBrightness")) next.autoBrightness = doc["autoBrightness"];
+            if (doc.containsKey("brightness")) next.brightness = doc["brightness"];
+            bool apRestart = false;
             if (doc.containsKey("apPassword")) {
                 String newPass = doc["apPassword"].as<String>();
                 if (newPass.length() >= 8 && newPass.length() <= 19) {
-                    strncpy(config.apPassword, newPass.c_str(), 19);
-                    config.apPassword[19] = 0;
-                    // Restart AP with new password
-                    WiFi.softAP(AP_SSID, config.apPassword, AP_CHANNEL, 0, AP_MAX_CONN);
+                    strncpy(next.apPassword, newPass.c_str(), 19);
+                    next.apPassword[19] = 0;
+                    apRestart = true;
+                }
+            }
+            if (doc.containsKey("scanMode")) {
+                ScanMode mode;
+                if (!scanModeParse(doc["scanMode"] | "", &mode)) {
+                    req->send(400, "application/json", "{\"error\":\"scanMode must be quick, normal or powersave\"}");
+                    return;
+                }
+                next.scanMode = mode;
+            }
+            bool bleTiming = doc.containsKey("bleInterval") || doc.containsKey("bleWindow");
+            if (bleTiming) {
+                int interval = doc["bleInterval"] | (int)bleScanInterval();
+                int window = doc["bleWindow"] | (int)bleScanWindow();
+                if (interval == 0 || window == 0) {
+                    interval = window = 0;     // back to the scan profile's timing
+                } else if (interval < BLE_SCAN_MS_MIN || interval > BLE_SCAN_MS_MAX ||
+                           window < BLE_SCAN_MS_MIN || window > interval) {
+                    req->send(400, "application/json", "{\"error\":\"bleWindow must be 3..bleInterval, bleInterval 3..10240 ms (0 = profile)\"}");
+                    return;
+                }
+                next.bleIntervalMs = (uint16_t)interval;
+                next.bleWindowMs = (uint16_t)window;
+            }
+            if (doc.containsKey("hopAdaptive")) next.hopAdaptive = doc["hopAdaptive"];
+            if (doc.containsKey("wifiActiveScan")) next.wifiActiveScan = doc["wifiActiveScan"];
+            if (doc.containsKey("hopExplorePct")) {
+                int pct = doc["hopExplorePct"] | -1;
+                if (pct < 0 || pct > 100) {
+                    req->send(400, "application/json", "{\"error\":\"hopExplorePct must be 0-100\"}");
+                    return;
+                }
+                next.hopExplorePct = (uint8_t)pct;
+            }
+            if (doc.containsKey("portalP95Ms")) {
+                int target = doc["portalP95Ms"] | -1;
+                if (target < PORTAL_P95_MIN_MS || target > PORTAL_P95_MAX_MS) {
+                    req->send(400, "application/json", "{\"error\":\"portalP95Ms must be 200-10000\"}");
+                    return;
+                }
+                next.portalP95Ms = (uint16_t)target;
+            }
+            if (doc.containsKey("radioShare")) {
+                RadioShare share;
+                if (!radioShareParse(doc["radioShare"] | "", &share)) {
+                    req->send(400, "application/json", "{\"error\":\"radioShare must be balanced, wifi or ble\"}");
+                    return;
                 }
+                next.radioShare = share;
             }
+
+            // Everything validated: commit, then apply the side effects
+            bool modeChanged = next.scanMode != config.scanMode;
+            config = next;
+            if (doc.containsKey("brightness")) setBrightness(config.brightness);
+            if (apRestart) WiFi.softAP(AP_SSID, config.apPassword, AP_CHANNEL, 0, AP_MAX_CONN);
+            if (modeChanged) applyScanProfile(config.scanMode);
+            if (bleTiming) bleScanRestart = true;
+            if (doc.containsKey("portalP95Ms")) hopAwayMs = 0;   // re-seed the away bound from the new target
+            if (doc.containsKey("radioShare")) radioSetShare((RadioShare)config.radioShare);
             saveConfig();
             displayDirty = true;
             req->send(200, "application/json", "{\"status\":\"ok\"}");
         }
     );
 
-    // API: Get raw logs (last 50 lines)
+    // API: Upload priority.json or priority.bin — written beside the live file,
+    // renamed into place, then rebuilt and swapped in by the reload task
+    webServer.on("/api/priority", HTTP_POST,
+        [](AsyncWebServerRequest *req){
+            if (priorityUploadError) {
+                req->send(400, "application/json", String("{\"error\":\"") + priorityUploadError + "\"}");
+                priorityUploadError = nullptr;
+                return;
+            }
+            bool started = requestPriorityReload("upload");
+            req->send(200, "application/json", started ? "{\"status\":\"reloading\"}"
+                                                       : "{\"status\":\"queued\"}");
+        },
+        [](AsyncWebServerRequest *req, const String& filename, size_t index, uint8_t *data, size_t len, bool final){
+            static File upload;
+            static const char* target = nullptr;
+            static size_t written = 0;
+            if (index == 0) {
+                if (upload) upload.close();
+                priorityUploadError = nullptr;
+                target = filename.endsWith(".bin")  ? PRIORITY_BIN_PATH  :
+                         filename.endsWith(".json") ? PRIORITY_JSON_PATH : nullptr;
+                if (!sdCardAvailable) { priorityUploadError = "no SD card"; return; }
+                if (!target)          { priorityUploadError = "expected .json or .bin"; return; }
+                upload = SD.open("/priority.tmp", FILE_WRITE);
+                written = 0;
+                if (!upload) { priorityUploadError = "cannot write SD"; return; }
+            }
+            if (!upload) return;
+            written += len;
+            if (written > PRIORITY_UPLOAD_MAX || upload.write(data, len) != len) {
+                upload.close();
+                SD.remove("/priority.tmp");
+                priorityUploadError = (written > PRIORITY_UPLOAD_MAX ? "file too large" : "SD write failed");
+                return;
+            }
+            if (final) {
+                upload.close();
+                SD.remove(target);
+                if (!SD.rename("/priority.tmp", target)) { priorityUploadError = "rename failed"; return; }
+                // A hand-supplied JSON supersedes any compiled image on the card;
+                // a pushed image is kept from being judged stale by an older JSON
+                if (strcmp(target, PRIORITY_JSON_PATH) == 0 && SD.exists(PRIORITY_BIN_PATH)) SD.remove(PRIORITY_BIN_PATH);
+                if (strcmp(target, PRIORITY_BIN_PATH) == 0 && SD.exists(PRIORITY_JSON_PATH)) {
+                    SD.remove(PRIORITY_JSON_BAK_PATH);
+                    SD.rename(PRIORITY_JSON_PATH, PRIORITY_JSON_BAK_PATH);
+                }
+                Serial.printf("[PRIORITY] Uploaded %s (%u bytes)\n", target, (unsigned)written);
+            }
+        }
+    );
+
+    // API: Session catalogue — one summary per session from /sessions/index.bin, no CSV opened
+    webServer.on("/api/sessions", HTTP_GET, [](AsyncWebServerRequest *req){
+        if (!sdCardAvailable) {
+            req->send(200, "application/json", "{\"sessions\":[]}");
+            return;
+        }
+        struct Ctx { AsyncResponseStream *res; bool first; };
+        Ctx ctx = { req->beginResponseStream("application/json"), true };
+        ctx.res->printf("{\"current\":\"%s\",\"sessions\":[", sessionId);
+        sessionIndexForEach(SD, [](const SessionSummary& stored, void* p) -> bool {
+            Ctx& c = *(Ctx*)p;
+            // The running session's on-card record lags by up to one cycle — use the live one
+            SessionSummary s = strcmp(stored.sessionId, sessionId) == 0 ? sessionIndexCurrent() : stored;
+            StaticJsonDocument<512> doc;
+            doc["id"]         = s.sessionId;
+            doc["start"]      = s.startEpoch;
+            doc["end"]        = s.endEpoch;
+            doc["duration"]   = s.durationSec;
+            doc["rows"]       = s.rows;
+            doc["uniqueMacs"] = s.uniqueMacs;
+            doc["maxTier"]    = s.maxTier;
+            doc["closed"]     = (s.flags & SESSION_FLAG_CLOSED) != 0;
+            doc["saturated"]  = (s.flags & SESSION_FLAG_SATURATED) != 0;
+            JsonArray vendors = doc.createNestedArray("topVendors");
+            for (auto& v : s.topVendors) {
+                if (!v.count) break;
+                JsonObject o = vendors.createNestedObject();
+                o["name"]  = v.name;
+                o["count"] = v.count;
+            }
+            if (!c.first) c.res->print(",");
+            c.first = false;
+            serializeJson(doc, *c.res);
+            return true;
+        }, &ctx);
+        ctx.res->print("]}");
+        req->send(ctx.res);
+    });
+
+    // API: Followers — devices present across the most time buckets this session
+    webServer.on("/api/followers", HTTP_GET, [](AsyncWebServerRequest *req){
+        FollowerInfo top[FOLLOWER_LIST_MAX];
+        int n = followerTop(top, FOLLOWER_LIST_MAX);
+        uint32_t nowSec = millis() / 1000;
+        DynamicJsonDocument doc(256 + n * 256);
+        doc["bucketSec"] = FOLLOWER_BUCKET_SEC;
+        doc["uptime"]    = nowSec;
+        JsonArray arr = doc.createNestedArray("followers");
+        for (int i = 0; i < n; i++) {
+            JsonObject o = arr.createNestedObject();
+            o["mac"]       = top[i].mac;
+            o["vendor"]    = top[i].vendor;
+            o["score"]     = top[i].score;
+            o["type"]      = top[i].isBLE ? "BLE" : "WiFi";
+            o["rssi"]      = top[i].lastRssi;
+            o["buckets"]   = top[i].buckets;
+            o["firstSeen"] = nowSec - top[i].firstSeenSec;   // seconds ago
+            o["lastSeen"]  = nowSec - top[i].lastSeenSec;
+        }
+        AsyncResponseStream *res = req->beginResponseStream("application/json");
+        serializeJson(doc, *res);
+        req->send(res);
+    });
+
+    // API: Tail of a session log — ?tail=N lines (default 50), ?session=XXXX-XXXX for past sessions
     webServer.on("/api/logs", HTTP_GET, [](AsyncWebServerRequest *req){
-        if (!sdCardAvailable || !SD.exists(sessionLogPath)) {
+        char path[32];
+        if (!sdCardAvailable || !resolveSessionLogPath(req, path, sizeof(path)) || !SD.exists(path)) {
             req->send(200, "text/plain", "No log data available.");
             return;
         }
-        File f = SD.open(sessionLogPath);
+        File f = SD.open(path, FILE_READ);
         if (!f) { req->send(500, "text/plain", "Error reading log."); return; }
-        String content = "";
-        int lines = 0;
-        while (f.available() && lines < 50) {
-            content += f.readStringUntil('\n') + "\n";
-            lines++;
-        }
-        f.close();
-        req->send(200, "text/plain", content);
+        int tail = req->hasParam("tail") ? req->getParam("tail")->value().toInt() : LOG_TAIL_DEFAULT;
+        tail = constrain(tail, 1, LOG_TAIL_MAX);
+        size_t start = findTailOffset(f, tail);
+        streamFileRange(req, f, start, f.size() - start, "text/plain", 200);
     });
 
-    // API: Download CSV
+    // API: Download a session log CSV (current by default) — honours HTTP Range
     webServer.on("/api/logs/download", HTTP_GET, [](AsyncWebServerRequest *req){
-        if (!sdCardAvailable || !SD.exists("/detections.csv")) {
+        char path[32];
+        if (!sdCardAvailable || !resolveSessionLogPath(req, path, sizeof(path)) || !SD.exists(path)) {
             req->send(404, "text/plain", "No log file found.");
             return;
         }
-        req->send(SD, "/detections.csv", "text/csv", true);
+        File f = SD.open(path, FILE_READ);
+        if (!f) { req->send(500, "text/plain", "Error reading log."); return; }
+        size_t size = f.size();
+        size_t first = 0, last = size ? size - 1 : 0;
+        int code = 200;
+        if (req->hasHeader("Range") && size > 0) {
+            if (!parseByteRange(req->getHeader("Range")->value(), size, first, last)) {
+                AsyncWebServerResponse *res = req->beginResponse(416, "text/plain", "Range not satisfiable");
+                res->addHeader("Content-Range", "bytes */" + String((unsigned long)size));
+                req->send(res);
+                return;
+            }
+            code = 206;
+        }
+        streamFileRange(req, f, first, size ? last - first + 1 : 0, "text/csv", code,
+                        strrchr(path, '/') + 1);
     });
 
     webServer.begin();
@@ -1654,6 +4100,7 @@ void updateDisplay() {
         case SCREEN_RADAR:    drawRadarScreen(); break;
         case SCREEN_SETTINGS: drawSettingsScreen(); break;
         case SCREEN_INFO:     drawInfoScreen(); break;
+        case SCREEN_TRACK:    drawTrackScreen(); break;
         default:              currentScreen = SCREEN_MAIN; drawMainScreen(); break;
     }
 }
@@ -1780,6 +4227,7 @@ void drawMainScreen() {
     scrollOffset = constrain(scrollOffset, 0, maxScroll);
 
     // Draw tier headers and items
+    listCards.clear();
     int y = yStart;
     int currentTier = -1;
     int itemIndex = 0;
@@ -1825,9 +4273,11 @@ void drawMainScreen() {
         // Priority colour bar (8px)
         tft.fillRect(5, y, 8, 42, getTierColor(det.priority));
 
+        listCards.push_back({(int16_t)y, det.macAddress});
+
         // Protocol badge (top-right)
         uint16_t badgeCol = det.isBLE ? 0x001F : 0xF800;  // BGR fills: 0x001F=red(BLE), 0xF800=blue(WiFi)
-        tft.fillRoundRect(265, y + 2, 42, 12, 2, badgeCol);
+        tft.fillRoundRect(LIST_BADGE_X, y + LIST_BADGE_Y, LIST_BADGE_W, LIST_BADGE_H, 2, badgeCol);
         tft.setTextSize(1);
         tft.setTextColor(TFT_WHITE);
         tft.setCursor(269, y + 4);
@@ -1956,9 +4406,11 @@ void drawMainScreen() {
 // ============================================================
 
 void drawCorrelationBanner() {
-    if (activeAlerts.empty()) return;
-
-    auto& alert = activeAlerts[0];  // Show most recent
+    // Alerts are raised/cleared from the scan side under the detection mutex — copy first
+    xSemaphoreTake(xDetectionMutex, portMAX_DELAY);
+    if (activeAlerts.empty()) { xSemaphoreGive(xDetectionMutex); return; }
+    CorrelationAlert alert = activeAlerts[0];  // Show most recent
+    xSemaphoreGive(xDetectionMutex);
     uint16_t bgCol = (alert.alertLevel == "CRITICAL") ? COL_ALERT_BG : 0x0208;  // BGR: dark amber (64,64,0)
 
     tft.fillRect(0, 29, 320, 22, bgCol);
@@ -2100,12 +4552,15 @@ void drawRadarScreen() {
     tft.setTextColor(COL_DIMTEXT); tft.setCursor(50, 196); tft.print("WiFi");
 
     // ── Correlation alert bar ────────────────────────────────
-    if (!activeAlerts.empty()) {
+    xSemaphoreTake(xDetectionMutex, portMAX_DELAY);
+    String topAlert = activeAlerts.empty() ? String() : activeAlerts[0].name;
+    xSemaphoreGive(xDetectionMutex);
+    if (!topAlert.isEmpty()) {
         tft.fillRect(0, 195, 320, 13, COL_ALERT_BG);
         tft.setTextSize(1);
         tft.setTextColor(COL_TIER5);
         tft.setCursor(4, 197);
-        tft.printf("! %s", activeAlerts[0].name.c_str());
+        tft.printf("! %s", topAlert.c_str());
     }
 
     drawNavbar();
@@ -2125,6 +4580,7 @@ void drawSettingsScreen() {
     drawToggle(20, 90,  config.enableLogging,   "SD Logging");
     drawToggle(20, 114, config.autoBrightness,  "Auto-Brightness");
     drawToggle(20, 138, config.enableWebPortal, "Web Portal");
+    drawProfileSelector(20, SETTINGS_PROFILE_Y);
     drawNavbar();
     tft.endWrite();
 }
@@ -2142,6 +4598,23 @@ void drawToggle(int x, int y, bool state, const char* label) {
     tft.print(label);
 }
 
+// Tap cycles QUICK -> NORMAL -> POWER SAVE; modelled draw shown beside it
+void drawProfileSelector(int x, int y) {
+    static const char* const LABELS[SCAN_MODE_COUNT] = {"QUICK", "NORMAL", "POWER SAVE"};
+    static const uint16_t COLOURS[SCAN_MODE_COUNT] = {0x001F, COL_ACCENT, 0x07E0};   // red / accent / green
+    ScanMode mode = config.scanMode;
+    tft.fillRoundRect(x + 150, y, 80, 22, 11, COLOURS[mode]);
+    tft.setTextSize(1);
+    tft.setTextColor(TFT_WHITE);
+    tft.setCursor(x + 190 - (int)strlen(LABELS[mode]) * 3, y + 7);
+    tft.print(LABELS[mode]);
+    tft.setCursor(x, y + 6);
+    tft.print("Scan Profile");
+    tft.setTextColor(COL_DIMTEXT);
+    tft.setCursor(x + 236, y + 7);
+    tft.printf("~%.0fmA", scanProfileEstimateMa(mode, webPortalActive, config.brightness));
+}
+
 // ============================================================
 // INFO SCREEN
 // ============================================================
@@ -2165,16 +4638,156 @@ void drawInfoScreen() {
 
     drawRow("Firmware:", VERSION);
     drawRow("OUI Database:", String(OUI_DATABASE_SIZE) + " entries");
-    drawRow("Priority DB:", String(priorityDB.size()) + " entries");
+    PriorityTable* pt = acquirePriorityTable();
+    drawRow("Priority DB:", String(pt->entries.size()) + " entries");
+    releasePriorityTable(pt);
     drawRow("Active Alerts:", String(activeAlerts.size()));
     drawRow("Detections:", String(detections.size()) +
                           (totalEvicted ? " (" + String(totalEvicted) + " dropped)" : ""));
     drawRow("Free Memory:", String(ESP.getFreeHeap() / 1024) + " KB");
 
+    // Followers — devices that keep showing up across time buckets
+    FollowerInfo top[3];
+    int nf = followerTop(top, 3);
+    tft.drawFastHLine(20, y - 4, 280, 0x2104);
+    tft.setTextColor(COL_DIMTEXT);
+    tft.setCursor(20, y);
+    tft.print("FOLLOWERS");
+    if (!nf) {
+        tft.setCursor(170, y);
+        tft.print("none yet");
+    }
+    y += 12;
+    for (int i = 0; i < nf; i++) {
+        tft.setTextColor(top[i].score >= 60 ? COL_TIER4 : TFT_WHITE);
+        tft.setCursor(20, y);
+        tft.printf("%3u%% %s %.14s", top[i].score, top[i].mac, top[i].vendor[0] ? top[i].vendor : "Unknown");
+        y += 12;
+    }
+
     drawNavbar();
     tft.endWrite();
 }
 
+// ============================================================
+// TRACK SCREEN (hot/cold target lock)
+// ============================================================
+
+#define TRACK_RSSI_COLD  -95    // bar empty / full blue
+#define TRACK_RSSI_HOT   -35    // bar full / full red
+#define TRACK_TREND_DEAD 1.0f   // dB/s either side shown as steady
+
+// Blue (cold) → red (hot), BGR565 like the rest of the palette
+static uint16_t heatColor(float heat) {
+    uint16_t r = (uint16_t)(heat * 31);
+    uint16_t b = (uint16_t)((1.0f - heat) * 31);
+    return (b << 11) | r;
+}
+
+// Redrawn at the reading rate, so only the first draw for a target clears
+// the screen; after that every field overwrites itself in place.
+void drawTrackScreen() {
+    static unsigned long drawnAt = 0;
+    static uint8_t drawnMac[6];
+    TrackReading r;
+    trackerRead(&r);
+    bool fresh = millis() - drawnAt > 500 || memcmp(drawnMac, r.mac, 6) != 0;
+    drawnAt = millis();
+    memcpy(drawnMac, r.mac, 6);
+
+    char mac[18];
+    snprintf(mac, sizeof(mac), "%02X:%02X:%02X:%02X:%02X:%02X",
+             r.mac[0], r.mac[1], r.mac[2], r.mac[3], r.mac[4], r.mac[5]);
+
+    tft.startWrite();
+    if (fresh) {
+        tft.fillScreen(COL_BG);
+        drawHeader("TRACKING");
+
+        String name;
+        int priority = PRIORITY_BASELINE;
+        xSemaphoreTake(xDetectionMutex, portMAX_DELAY);
+        for (auto& d : detections) {
+            if (d.macAddress.equalsIgnoreCase(mac)) {
+                name = d.manufacturer;
+                if (!d.ssid.isEmpty()) name += " / " + d.ssid;
+                priority = d.priority;
+                break;
+            }
+        }
+        xSemaphoreGive(xDetectionMutex);
+        if (name.length() > 44) name = name.substring(0, 41) + "...";
+
+        tft.setTextSize(1);
+        tft.fillRect(0, 32, 4, 24, getTierColor(priority));
+        tft.setTextColor(TFT_WHITE);
+        tft.setCursor(10, 34);
+        tft.print(name.isEmpty() ? "Unknown device" : name);
+        tft.setTextColor(COL_DIMTEXT);
+        tft.setCursor(10, 47);
+        if (r.isBLE) tft.printf("%s  BLE", mac);
+        else         tft.printf("%s  WiFi ch %u", mac, r.channel);
+
+        tft.setTextColor(COL_DIMTEXT);
+        tft.setCursor(200, 108);
+        tft.print("dBm");
+
+        // Stop bar in place of the navbar
+        tft.fillRect(0, 210, 320, 30, COL_NAVBAR);
+        tft.drawFastHLine(0, 210, 320, 0x2104);
+        tft.setTextColor(COL_ACCENT);
+        tft.setCursor(112, 219);
+        tft.print("TAP TO STOP");
+    }
+
+    bool lost = r.samples == 0 || r.ageMs >= TRACK_STALE_MS;
+    float heat = constrain((r.rssi - TRACK_RSSI_COLD) / (float)(TRACK_RSSI_HOT - TRACK_RSSI_COLD), 0.0f, 1.0f);
+    uint16_t col = lost ? COL_DIMTEXT : heatColor(heat);
+
+    // Filtered RSSI, large
+    tft.setTextSize(6);
+    tft.setTextColor(col, COL_BG);
+    tft.setCursor(20, 66);
+    if (r.samples) tft.printf("%4d", (int)lroundf(r.rssi));
+    else           tft.print("  --");
+
+    // Trend arrow: up = warmer, down = colder
+    tft.fillRect(240, 62, 64, 56, COL_BG);
+    if (!lost && r.trendDbps > TRACK_TREND_DEAD) {
+        tft.fillTriangle(272, 64, 244, 112, 300, 112, heatColor(1.0f));
+    } else if (!lost && r.trendDbps < -TRACK_TREND_DEAD) {
+        tft.fillTriangle(244, 66, 300, 66, 272, 114, heatColor(0.0f));
+    } else {
+        tft.fillRect(248, 86, 48, 8, COL_DIMTEXT);
+    }
+
+    // Heat bar
+    int fill = (int)(heat * 296);
+    if (r.samples == 0) fill = 0;
+    tft.fillRect(12, 134, fill, 22, col);
+    tft.fillRect(12 + fill, 134, 296 - fill, 22, COL_CARD);
+    tft.drawRect(11, 133, 298, 24, COL_DIMTEXT);
+
+    tft.setTextSize(2);
+    tft.setCursor(12, 166);
+    if (lost) {
+        tft.setTextColor(COL_TIER4, COL_BG);
+        tft.print(r.samples ? "SIGNAL LOST " : "LISTENING...");
+    } else {
+        tft.setTextColor(TFT_WHITE, COL_BG);
+        tft.print(r.trendDbps > TRACK_TREND_DEAD ? "WARMER      " :
+                  r.trendDbps < -TRACK_TREND_DEAD ? "COLDER      " : "STEADY      ");
+    }
+
+    tft.setTextSize(1);
+    tft.setTextColor(COL_DIMTEXT, COL_BG);
+    tft.setCursor(12, 192);
+    tft.printf("raw %4d  %+5.1f dB/s  %5.1f Hz  n=%-6lu %3lus ",
+               r.rawRssi, r.trendDbps, r.rateHz, (unsigned long)r.samples,
+               (unsigned long)(r.elapsedMs / 1000));
+    tft.endWrite();
+}
+
 // ============================================================
 // WIZARD SCREEN
 // ============================================================
@@ -2198,8 +4811,10 @@ void drawWizardScreen() {
         tft.setCursor(20, 85); tft.printf("Touch: %s", touchAvailable ? "OK" : "ERROR");
         tft.setCursor(20, 100); tft.printf("SD Card: %s", sdCardAvailable ? "DETECTED" : "NOT FOUND");
         tft.setCursor(20, 115); tft.printf("OUI DB: %d entries", OUI_DATABASE_SIZE);
-        tft.setCursor(20, 130); tft.printf("Priority DB: %d entries", priorityDB.size());
-        tft.setCursor(20, 145); tft.printf("Corr. Rules: %d", correlationRules.size());
+        PriorityTable* pt = acquirePriorityTable();
+        tft.setCursor(20, 130); tft.printf("Priority DB: %d entries", pt->entries.size());
+        tft.setCursor(20, 145); tft.printf("Corr. Rules: %d", pt->rules.size());
+        releasePriorityTable(pt);
     } else {
         tft.setCursor(20, 60); tft.print("SETUP COMPLETE");
         tft.setCursor(20, 85); tft.setTextColor(COL_ACCENT);
@@ -2220,6 +4835,16 @@ void drawWizardScreen() {
 // TOUCH HANDLING
 // ============================================================
 
+// Card whose protocol badge contains (x, y), if any
+static const ListCard* listBadgeAt(uint16_t x, uint16_t y) {
+    if (x < LIST_BADGE_X || x >= LIST_BADGE_X + LIST_BADGE_W) return nullptr;
+    for (const auto& c : listCards) {
+        int top = c.top + LIST_BADGE_Y;
+        if (y >= top && y < top + LIST_BADGE_H) return &c;
+    }
+    return nullptr;
+}
+
 void handleTouchGestures() {
     static unsigned long lastTouch = 0;
     uint16_t x, y;
@@ -2227,7 +4852,10 @@ void handleTouchGestures() {
     if (millis() - lastTouch < 150) return;  // Debounce
     lastTouch = millis();
 
-    if (y >= 208) {
+    if (currentScreen == SCREEN_TRACK) {
+        // Stop bar — the list picks up where it left off once the lock is released
+        if (y >= 208) requestTrackStop();
+    } else if (y >= 208) {
         // Navbar tap
         int newScreen = x / 80;
         if (newScreen >= 0 && newScreen <= 3) {
@@ -2240,6 +4868,20 @@ void handleTouchGestures() {
             // Header tap — toggle scan pause
             scanPaused = !scanPaused;
             displayDirty = true;
+        } else if (const ListCard* card = listBadgeAt(x, y)) {
+            // Protocol badge — lock on once it has been held; a brush while scrolling does nothing
+            static String pressMac;
+            static unsigned long pressStart = 0, pressSeen = 0;
+            unsigned long now = millis();
+            if (card->mac != pressMac || now - pressSeen > 300) {   // new press (touches repeat every ~150 ms)
+                pressMac = card->mac;
+                pressStart = now;
+            }
+            pressSeen = now;
+            if (pressStart && now - pressStart >= TRACK_LONG_PRESS_MS) {
+                pressStart = 0;   // once per press
+                if (!requestTrackLock(card->mac)) Serial.printf("[TRACK] Cannot lock %s\n", card->mac.c_str());
+            }
         } else if (y < 120 && scrollOffset > 0) {
             scrollOffset--;
             displayDirty = true;
@@ -2248,6 +4890,13 @@ void handleTouchGestures() {
             displayDirty = true;
         }
     } else if (currentScreen == SCREEN_SETTINGS) {
+        if (x > SETTINGS_HIT_X_MIN && x < SETTINGS_HIT_X_MAX &&
+            y >= SETTINGS_ROW_Y[4] + SETTINGS_ROW_HEIGHT - 5 &&          // starts where the Web Portal row ends
+            y < SETTINGS_PROFILE_Y + SETTINGS_ROW_HEIGHT - 5) {
+            applyScanProfile((ScanMode)((config.scanMode + 1) % SCAN_MODE_COUNT));
+            saveConfig();
+            return;
+        }
         // Toggle taps — widen hit area to full row width for easier tapping
         if (x > SETTINGS_HIT_X_MIN && x < SETTINGS_HIT_X_MAX) {
             bool* toggles[] = {
@@ -2279,6 +4928,12 @@ void handleBootButton() {
     lastPress = millis();
     lastInteractionTime = millis();
 
+    if (currentScreen == SCREEN_TRACK) {
+        requestTrackStop();
+        Serial.println("[BOOT BTN] Track stop");
+        return;
+    }
+
     // Cycle through screens (wizard is always skipped now)
     Screen prev = currentScreen;
     int s = (int)currentScreen + 1;
@@ -2318,6 +4973,14 @@ void saveConfig() {
     preferences.putBool("webp", config.enableWebPortal);
     preferences.putInt("sleepT", config.sleepTimeout);
     preferences.putString("apPass", config.apPassword);
+    preferences.putUShort("bleIntU", config.bleIntervalMs);
+    preferences.putUShort("bleWinU", config.bleWindowMs);
+    preferences.putUChar("rShare", config.radioShare);
+    preferences.putBool("hopAdapt", config.hopAdaptive);
+    preferences.putUChar("hopExpl", config.hopExplorePct);
+    preferences.putUShort("p95Tgt", config.portalP95Ms);
+    preferences.putBool("wScan", config.wifiActiveScan);
+    preferences.putUChar("scanMode", config.scanMode);
     // Touch calibration
     preferences.putInt("calXMin", config.calXMin);
     preferences.putInt("calXMax", config.calXMax);
@@ -2337,6 +5000,23 @@ void loadConfig() {
     config.sleepTimeout    = preferences.getInt("sleepT", 1800);  // 30 min default
     String ap = preferences.getString("apPass", "spypro2026");
     strncpy(config.apPassword, ap.c_str(), 19); config.apPassword[19] = 0;
+    // New keys: the old ones also held values copied in from a profile switch
+    config.bleIntervalMs = preferences.getUShort("bleIntU", 0);
+    config.bleWindowMs   = preferences.getUShort("bleWinU", 0);
+    config.radioShare    = preferences.getUChar("rShare", RADIO_SHARE_BALANCED);
+    if (config.radioShare >= RADIO_SHARE_COUNT) config.radioShare = RADIO_SHARE_BALANCED;
+    config.hopAdaptive   = preferences.getBool("hopAdapt", true);
+    config.hopExplorePct = min((int)preferences.getUChar("hopExpl", HOP_EXPLORE_PCT_DEFAULT), 100);
+    config.portalP95Ms   = constrain((int)preferences.getUShort("p95Tgt", PORTAL_P95_DEFAULT_MS),
+                                     PORTAL_P95_MIN_MS, PORTAL_P95_MAX_MS);
+    config.wifiActiveScan = preferences.getBool("wScan", false);
+    config.scanMode      = (ScanMode)preferences.getUChar("scanMode", SCAN_NORMAL);
+    if (config.scanMode >= SCAN_MODE_COUNT) config.scanMode = SCAN_NORMAL;
+    if (config.bleIntervalMs < BLE_SCAN_MS_MIN || config.bleIntervalMs > BLE_SCAN_MS_MAX ||
+        config.bleWindowMs < BLE_SCAN_MS_MIN || config.bleWindowMs > config.bleIntervalMs) {
+        config.bleIntervalMs = 0;      // none (or invalid): follow the profile
+        config.bleWindowMs = 0;
+    }
     // Touch calibration — default to device-measured 4-corner values
     config.calXMin = preferences.getInt("calXMin", TOUCH_CAL_X_MIN_DEFAULT);
     config.calXMax = preferences.getInt("calXMax", TOUCH_CAL_X_MAX_DEFAULT);
@@ -2356,6 +5036,7 @@ void loadConfig() {
 }
 
 void enterDeepSleep() {
+    flushDetectionLog(true);   // pending log lines, and mark this session closed in the catalogue
     tft.fillScreen(COL_BG);
     tft.setTextSize(1);
     tft.setTextColor(COL_DIMTEXT);
@@ -0,0 +1,49 @@
+#include "portal_latency.h"
+#include <algorithm>
+
+struct LatencySample {
+    uint32_t atMs;
+    uint16_t ms;
+};
+
+static portMUX_TYPE latMux = portMUX_INITIALIZER_UNLOCKED;
+static LatencySample ring[PORTAL_LAT_SAMPLES];
+static uint8_t ringNext = 0;
+static uint8_t ringCount = 0;
+
+void portalLatencyAdd(uint32_t ms) {
+    if (ms > PORTAL_LAT_MAX_MS) return;
+    uint32_t now = millis();
+    portENTER_CRITICAL(&latMux);
+    ring[ringNext] = {now, (uint16_t)ms};
+    ringNext = (ringNext + 1) % PORTAL_LAT_SAMPLES;
+    if (ringCount < PORTAL_LAT_SAMPLES) ringCount++;
+    portEXIT_CRITICAL(&latMux);
+}
+
+// Nearest-rank percentile of a sorted run
+static uint16_t percentile(const uint16_t* sorted, uint16_t n, uint8_t pct) {
+    uint16_t rank = (uint16_t)((n * pct + 99) / 100);
+    return sorted[rank ? rank - 1 : 0];
+}
+
+uint16_t portalLatencySummary(uint32_t sinceMs, PortalLatency* out) {
+    uint16_t ms[PORTAL_LAT_SAMPLES];
+    uint16_t n = 0;
+    uint32_t now = millis();
+    portENTER_CRITICAL(&latMux);
+    for (uint8_t i = 0; i < ringCount; i++) {
+        // Compare ages so a millis() wrap doesn't drop everything
+        if (now - ring[i].atMs <= now - sinceMs) ms[n++] = ring[i].ms;
+    }
+    portEXIT_CRITICAL(&latMux);
+
+    *out = PortalLatency();
+    out->count = n;
+    if (!n) return 0;
+    std::sort(ms, ms + n);
+    out->p50Ms = percentile(ms, n, 50);
+    out->p95Ms = percentile(ms, n, 95);
+    out->maxMs = ms[n - 1];
+    return n;
+}
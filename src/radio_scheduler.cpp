@@ -0,0 +1,143 @@
+#include "radio_scheduler.h"
+#include "esp_coexist.h"
+
+// ── State ─────────────────────────────────────────────────────────────────
+// Active time is accrued lazily: while a listener is on, its open interval
+// (since onSince) is folded into the totals whenever it is switched off or
+// a window closes.
+
+struct RadioState {
+    bool     on;
+    float    airShare;
+    uint32_t onSince;           // millis() of the open interval
+    float    activeMs;          // since boot
+    float    windowMs;          // this window
+    uint32_t events;
+    uint32_t windowEvents;
+    uint32_t dropped;
+    float    dutyPct;
+    float    dutyAvgPct;
+    float    eventsPerSec;
+};
+
+static portMUX_TYPE radioMux = portMUX_INITIALIZER_UNLOCKED;
+static RadioState radios[RADIO_USE_COUNT];
+static RadioShare share = RADIO_SHARE_BALANCED;
+static uint32_t windowStart = 0;
+
+static const char* const SHARE_NAMES[RADIO_SHARE_COUNT] = {"balanced", "wifi", "ble"};
+static const char* const USE_NAMES[RADIO_USE_COUNT] = {"ble", "wifiSniff", "wifiScan"};
+
+#define DUTY_SMOOTHING 0.2f     // EWMA weight of the newest window
+
+// Caller holds radioMux
+static void accrue(RadioState& r, uint32_t now) {
+    if (!r.on) return;
+    float ms = (float)(now - r.onSince) * r.airShare;
+    r.activeMs += ms;
+    r.windowMs += ms;
+    r.onSince = now;
+}
+
+// ── Share policy ──────────────────────────────────────────────────────────
+
+void radioSetShare(RadioShare s) {
+    if (s >= RADIO_SHARE_COUNT) s = RADIO_SHARE_BALANCED;
+    share = s;
+    esp_coex_prefer_t pref = s == RADIO_SHARE_WIFI ? ESP_COEX_PREFER_WIFI
+                           : s == RADIO_SHARE_BLE  ? ESP_COEX_PREFER_BT
+                           :                         ESP_COEX_PREFER_BALANCE;
+    if (esp_coex_preference_set(pref) != 0) {
+        Serial.printf("[RADIO] Coexistence preference '%s' rejected\n", SHARE_NAMES[s]);
+        return;
+    }
+    Serial.printf("[RADIO] Coexistence preference: %s\n", SHARE_NAMES[s]);
+}
+
+RadioShare radioShare() { return share; }
+
+const char* radioShareName(RadioShare s) {
+    return s < RADIO_SHARE_COUNT ? SHARE_NAMES[s] : "?";
+}
+
+bool radioShareParse(const char* name, RadioShare* out) {
+    for (uint8_t i = 0; i < RADIO_SHARE_COUNT; i++) {
+        if (name && strcasecmp(name, SHARE_NAMES[i]) == 0) { *out = (RadioShare)i; return true; }
+    }
+    return false;
+}
+
+const char* radioUseName(RadioUse r) {
+    return r < RADIO_USE_COUNT ? USE_NAMES[r] : "?";
+}
+
+// ── Listeners and events ──────────────────────────────────────────────────
+
+void radioOn(RadioUse r, float airShare) {
+    uint32_t now = millis();
+    portENTER_CRITICAL(&radioMux);
+    RadioState& s = radios[r];
+    accrue(s, now);
+    s.on = true;
+    s.airShare = constrain(airShare, 0.0f, 1.0f);
+    s.onSince = now;
+    portEXIT_CRITICAL(&radioMux);
+}
+
+void radioOff(RadioUse r) {
+    uint32_t now = millis();
+    portENTER_CRITICAL(&radioMux);
+    accrue(radios[r], now);
+    radios[r].on = false;
+    portEXIT_CRITICAL(&radioMux);
+}
+
+bool radioIsOn(RadioUse r) { return radios[r].on; }
+
+void radioCount(RadioUse r, uint32_t n) {
+    portENTER_CRITICAL(&radioMux);
+    radios[r].events += n;
+    radios[r].windowEvents += n;
+    portEXIT_CRITICAL(&radioMux);
+}
+
+void radioDrop(RadioUse r) {
+    portENTER_CRITICAL(&radioMux);
+    radios[r].dropped++;
+    portEXIT_CRITICAL(&radioMux);
+}
+
+uint32_t radioEvents(RadioUse r) { return radios[r].events; }
+
+// ── Stats windows ─────────────────────────────────────────────────────────
+
+void radioWindowClose() {
+    uint32_t now = millis();
+    portENTER_CRITICAL(&radioMux);
+    float wall = (float)(now - windowStart);
+    if (wall >= 1.0f) {
+        for (uint8_t i = 0; i < RADIO_USE_COUNT; i++) {
+            RadioState& s = radios[i];
+            accrue(s, now);
+            s.dutyPct = 100.0f * s.windowMs / wall;
+            s.dutyAvgPct = windowStart ? s.dutyAvgPct + DUTY_SMOOTHING * (s.dutyPct - s.dutyAvgPct) : s.dutyPct;
+            s.eventsPerSec = s.windowEvents * 1000.0f / wall;
+            s.windowMs = 0;
+            s.windowEvents = 0;
+        }
+    }
+    windowStart = now;
+    portEXIT_CRITICAL(&radioMux);
+}
+
+void radioDuty(RadioUse r, RadioDuty* out) {
+    portENTER_CRITICAL(&radioMux);
+    const RadioState& s = radios[r];
+    out->dutyPct = s.dutyPct;
+    out->dutyAvgPct = s.dutyAvgPct;
+    out->eventsPerSec = s.eventsPerSec;
+    out->activeMs = (uint32_t)s.activeMs;
+    out->events = s.events;
+    out->dropped = s.dropped;
+    portEXIT_CRITICAL(&radioMux);
+}
@@ -0,0 +1,84 @@
+#include "scan_profile.h"
+
+// ── Profile table ─────────────────────────────────────────────────────────
+// NORMAL keeps the long-standing defaults (5 s cycle, 60/100 ms BLE,
+// 150 ms dwell = 2.4 s pass). QUICK listens to BLE without gaps and sweeps
+// in 1.6 s so each device reports twice as often. POWER_SAVE runs a 10 %
+// BLE window and one 1.2 s sweep every 15 s, with the WiFi receiver off in
+// between, and writes the SD card twice a minute.
+
+static const ScanProfile PROFILES[SCAN_MODE_COUNT] = {
+    //  cycle  bleInt bleWin dwell  park   log    display
+    {   2500,  100,   100,   100,   true,  1000,  1000  },   // QUICK
+    {   5000,  100,   60,    150,   true,  5000,  5000  },   // NORMAL
+    {  15000,  500,   50,    75,    false, 30000, 15000 },   // POWER_SAVE
+};
+
+static const char* const MODE_NAMES[SCAN_MODE_COUNT] = {"quick", "normal", "powersave"};
+
+const ScanProfile& scanProfile(ScanMode mode) {
+    return PROFILES[mode < SCAN_MODE_COUNT ? mode : SCAN_NORMAL];
+}
+
+const char* scanModeName(ScanMode mode) {
+    return mode < SCAN_MODE_COUNT ? MODE_NAMES[mode] : "?";
+}
+
+bool scanModeParse(const char* name, ScanMode* out) {
+    for (uint8_t i = 0; i < SCAN_MODE_COUNT; i++) {
+        if (name && strcasecmp(name, MODE_NAMES[i]) == 0) { *out = (ScanMode)i; return true; }
+    }
+    return false;
+}
+
+float scanProfileEstimateMa(ScanMode mode, bool portal, uint8_t brightness) {
+    const ScanProfile& p = scanProfile(mode);
+    float ble = (float)p.bleWindowMs / p.bleIntervalMs;
+    float pass = 16.0f * p.hopDwellMs;
+    float wifi = p.wifiPark ? 1.0f : min(1.0f, pass / p.cycleMs);
+    if (portal) wifi = 1.0f;
+    float rx = 1.0f - (1.0f - ble) * (1.0f - wifi);     // either one keeps the receiver on
+    return PROFILE_MA_BASE
+         + PROFILE_MA_BACKLIGHT * brightness / 255.0f
+         + PROFILE_MA_RX * rx
+         + PROFILE_MA_SD * (float)PROFILE_SD_BURST_MS / p.logFlushMs
+         + PROFILE_MA_REDRAW * (float)PROFILE_REDRAW_MS / p.displayRefreshMs;
+}
+
+// ── Yield accounting ──────────────────────────────────────────────────────
+
+static portMUX_TYPE profMux = portMUX_INITIALIZER_UNLOCKED;
+static ScanProfileStats pstats[SCAN_MODE_COUNT];
+static ScanMode active = SCAN_NORMAL;
+static uint32_t activeSince = 0;
+
+// Caller holds profMux
+static void accrue(uint32_t now) {
+    pstats[active].activeMs += now - activeSince;
+    activeSince = now;
+}
+
+void scanProfileActivate(ScanMode mode) {
+    if (mode >= SCAN_MODE_COUNT) mode = SCAN_NORMAL;
+    uint32_t now = millis();
+    portENTER_CRITICAL(&profMux);
+    if (activeSince) accrue(now);
+    active = mode;
+    activeSince = now ? now : 1;
+    portEXIT_CRITICAL(&profMux);
+}
+
+void scanProfileNoteDetection(bool newDevice) {
+    portENTER_CRITICAL(&profMux);
+    pstats[active].sightings++;
+    if (newDevice) pstats[active].newDevices++;
+    portEXIT_CRITICAL(&profMux);
+}
+
+void scanProfileStats(ScanMode mode, ScanProfileStats* out) {
+    if (mode >= SCAN_MODE_COUNT) mode = SCAN_NORMAL;
+    portENTER_CRITICAL(&profMux);
+    if (activeSince) accrue(millis());
+    *out = pstats[mode];
+    portEXIT_CRITICAL(&profMux);
+}
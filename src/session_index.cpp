@@ -0,0 +1,175 @@
+#include "session_index.h"
+#include <time.h>
+#include <math.h>
+#include <algorithm>
+
+// ── Running-session state ─────────────────────────────────────────────────
+// Everything here is fixed-size: the summary is maintained incrementally as
+// rows are logged, whatever the session length.
+
+#define SESSION_HEADER_SIZE   8
+#define SESSION_MAC_BITS      4096                 // linear-counting bitmap (512 bytes)
+#define SESSION_VENDOR_SLOTS  8                    // Space-Saving counters behind the top 3
+
+static portMUX_TYPE   sessionMux = portMUX_INITIALIZER_UNLOCKED;
+static SessionSummary current;
+static SessionVendor  vendorSlots[SESSION_VENDOR_SLOTS];
+static uint8_t        macBitmap[SESSION_MAC_BITS / 8];
+static uint16_t       macBitsSet = 0;
+static int32_t        slotIndex = -1;             // record index in index.bin, -1 = not begun
+static bool           dirty = false;           // guarded by sessionMux, set by any task
+
+static uint32_t fnv1a(const char* s) {
+    uint32_t h = 2166136261UL;
+    while (*s) { h ^= (uint8_t)*s++; h *= 16777619UL; }
+    return h;
+}
+
+static uint32_t nowEpoch() {
+    time_t t = time(nullptr);
+    return (t > 1000000000L) ? (uint32_t)t : 0;
+}
+
+bool sessionIndexBegin(fs::FS& fs, const char* sessionId) {
+    memset(&current, 0, sizeof(current));
+    memset(vendorSlots, 0, sizeof(vendorSlots));
+    memset(macBitmap, 0, sizeof(macBitmap));
+    macBitsSet = 0;
+    strncpy(current.sessionId, sessionId, sizeof(current.sessionId) - 1);
+    current.startEpoch = nowEpoch();
+
+    if (!fs.exists(SESSION_INDEX_PATH)) {
+        File f = fs.open(SESSION_INDEX_PATH, FILE_WRITE);
+        if (!f) return false;
+        uint32_t magic = SESSION_INDEX_MAGIC;
+        uint16_t ver = SESSION_INDEX_VERSION, recSize = sizeof(SessionSummary);
+        f.write((const uint8_t*)&magic, 4);
+        f.write((const uint8_t*)&ver, 2);
+        f.write((const uint8_t*)&recSize, 2);
+        f.close();
+    }
+
+    File f = fs.open(SESSION_INDEX_PATH, FILE_APPEND);
+    if (!f) return false;
+    size_t size = f.size();
+    if (size < SESSION_HEADER_SIZE) { f.close(); return false; }
+    // A torn final record (power lost mid-write) is overwritten by this session
+    slotIndex = (size - SESSION_HEADER_SIZE) / sizeof(SessionSummary);
+    f.close();
+    portENTER_CRITICAL(&sessionMux);
+    dirty = true;
+    portEXIT_CRITICAL(&sessionMux);
+    sessionIndexFlush(fs);
+    Serial.printf("[SESSION] Index slot %d for %s\n", (int)slotIndex, sessionId);
+    return true;
+}
+
+void sessionIndexRecord(const String& mac, const String& vendor, int priority) {
+    uint32_t macHash = fnv1a(mac.c_str()) % SESSION_MAC_BITS;
+
+    portENTER_CRITICAL(&sessionMux);
+    current.rows++;
+    if (priority > current.maxTier) current.maxTier = (uint8_t)priority;
+
+    uint8_t bit = 1 << (macHash & 7);
+    if (!(macBitmap[macHash >> 3] & bit)) { macBitmap[macHash >> 3] |= bit; macBitsSet++; }
+
+    // Space-Saving: bump a matching slot, else take an empty one, else replace the minimum
+    if (!vendor.isEmpty()) {
+        int match = -1, minIdx = 0;
+        for (int i = 0; i < SESSION_VENDOR_SLOTS; i++) {
+            if (vendorSlots[i].count && strncmp(vendorSlots[i].name, vendor.c_str(), SESSION_VENDOR_LEN - 1) == 0) {
+                match = i; break;
+            }
+            if (vendorSlots[i].count < vendorSlots[minIdx].count) minIdx = i;
+        }
+        if (match >= 0) {
+            vendorSlots[match].count++;
+        } else {
+            SessionVendor& v = vendorSlots[minIdx];
+            strncpy(v.name, vendor.c_str(), SESSION_VENDOR_LEN - 1);
+            v.name[SESSION_VENDOR_LEN - 1] = 0;
+            v.count++;
+        }
+    }
+    dirty = true;
+    portEXIT_CRITICAL(&sessionMux);
+}
+
+SessionSummary sessionIndexCurrent() {
+    SessionSummary s;
+    SessionVendor slots[SESSION_VENDOR_SLOTS];
+    uint16_t bitsSet;
+
+    portENTER_CRITICAL(&sessionMux);
+    s = current;
+    memcpy(slots, vendorSlots, sizeof(slots));
+    bitsSet = macBitsSet;
+    portEXIT_CRITICAL(&sessionMux);
+
+    // Linear counting: n ≈ -m·ln(zeroBits/m). A full bitmap has no zero bit left;
+    // report the m·ln(m) ceiling the last zero stood for and flag it as a lower bound.
+    uint32_t zeros = SESSION_MAC_BITS - bitsSet;
+    if (zeros) {
+        s.uniqueMacs = (uint32_t)lroundf(-(float)SESSION_MAC_BITS * logf((float)zeros / SESSION_MAC_BITS));
+    } else {
+        s.uniqueMacs = (uint32_t)lroundf((float)SESSION_MAC_BITS * logf((float)SESSION_MAC_BITS));
+        s.flags |= SESSION_FLAG_SATURATED;
+    }
+
+    std::sort(slots, slots + SESSION_VENDOR_SLOTS,
+              [](const SessionVendor& a, const SessionVendor& b) { return a.count > b.count; });
+    memcpy(s.topVendors, slots, sizeof(s.topVendors));
+
+    s.durationSec = millis() / 1000;
+    s.endEpoch    = nowEpoch();
+    // Clock synced after the session began — back-date the start from uptime
+    if (s.startEpoch == 0 && s.endEpoch) s.startEpoch = s.endEpoch - s.durationSec;
+    return s;
+}
+
+void sessionIndexFlush(fs::FS& fs, bool close) {
+    if (slotIndex < 0) return;
+    portENTER_CRITICAL(&sessionMux);
+    bool changed = dirty;
+    dirty = false;
+    portEXIT_CRITICAL(&sessionMux);
+    if (!changed && !close) return;
+
+    SessionSummary s = sessionIndexCurrent();
+    if (close) s.flags |= SESSION_FLAG_CLOSED;
+    portENTER_CRITICAL(&sessionMux);
+    current.startEpoch = s.startEpoch;
+    portEXIT_CRITICAL(&sessionMux);
+
+    File f = fs.open(SESSION_INDEX_PATH, "r+");
+    if (!f) {
+        portENTER_CRITICAL(&sessionMux);
+        dirty = true;
+        portEXIT_CRITICAL(&sessionMux);
+        return;
+    }
+    f.seek(SESSION_HEADER_SIZE + (uint32_t)slotIndex * sizeof(SessionSummary));
+    f.write((const uint8_t*)&s, sizeof(s));
+    f.close();
+}
+
+int sessionIndexForEach(fs::FS& fs, session_index_visitor_t visit, void* ctx) {
+    File f = fs.open(SESSION_INDEX_PATH, FILE_READ);
+    if (!f) return 0;
+    uint32_t magic = 0; uint16_t ver = 0, recSize = 0;
+    f.read((uint8_t*)&magic, 4);
+    f.read((uint8_t*)&ver, 2);
+    f.read((uint8_t*)&recSize, 2);
+    if (magic != SESSION_INDEX_MAGIC || recSize != sizeof(SessionSummary)) { f.close(); return 0; }
+
+    int n = 0;
+    SessionSummary s;
+    while (f.read((uint8_t*)&s, sizeof(s)) == sizeof(s)) {
+        s.sessionId[sizeof(s.sessionId) - 1] = 0;
+        n++;
+        if (!visit(s, ctx)) break;
+    }
+    f.close();
+    return n;
+}
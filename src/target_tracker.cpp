@@ -0,0 +1,118 @@
+#include "target_tracker.h"
+
+// ── State ─────────────────────────────────────────────────────────────────
+// Written by the radio callbacks (NimBLE host / WiFi driver task), read by
+// ScanTask and the web and UI tasks; every access goes through trackMux.
+
+struct TrackState {
+    volatile bool active;
+    uint8_t  mac[6];
+    bool     isBLE;
+    uint8_t  channel;
+    uint32_t startMs;
+    uint32_t lastMs;            // last sample
+    uint32_t forwardMs;         // last sample forwarded to the sighting queue
+    float    level;
+    float    trend;
+    float    rateHz;
+    int8_t   raw;
+    uint32_t samples;
+};
+
+static portMUX_TYPE trackMux = portMUX_INITIALIZER_UNLOCKED;
+static TrackState ts;
+
+#define RATE_SMOOTHING 0.2f     // EWMA weight of the newest inter-sample rate
+
+void trackerStart(const uint8_t* mac, bool isBLE, uint8_t channel) {
+    portENTER_CRITICAL(&trackMux);
+    ts = TrackState();
+    memcpy(ts.mac, mac, 6);
+    ts.isBLE = isBLE;
+    ts.channel = channel;
+    ts.startMs = millis();
+    ts.active = true;
+    portEXIT_CRITICAL(&trackMux);
+}
+
+void trackerStop() {
+    ts.active = false;
+}
+
+bool trackerActive() { return ts.active; }
+
+bool trackerMatch(const uint8_t* mac) {
+    portENTER_CRITICAL(&trackMux);
+    bool hit = ts.active && memcmp(mac, ts.mac, 6) == 0;
+    portEXIT_CRITICAL(&trackMux);
+    return hit;
+}
+
+// ── Alpha-beta filter ─────────────────────────────────────────────────────
+// Predict the level forward by trend x dt, then correct both by the
+// residual. Samples arrive irregularly (advert interval, frame bursts), so
+// dt is measured per sample and clamped: a long gap is a fresh start for
+// the trend, not a huge slope.
+
+bool trackerSample(int8_t rssi) {
+    uint32_t now = millis();
+    bool forward = false;
+    portENTER_CRITICAL(&trackMux);
+    if (ts.active) {
+        if (ts.samples == 0) {
+            ts.level = rssi;
+            ts.trend = 0;
+        } else {
+            float dt = (now - ts.lastMs) / 1000.0f;
+            if (dt > 2.0f) {
+                ts.trend = 0;
+                dt = 2.0f;
+            } else if (dt < 0.005f) {
+                dt = 0.005f;
+            }
+            float predicted = ts.level + ts.trend * dt;
+            float residual = rssi - predicted;
+            ts.level = predicted + TRACK_ALPHA * residual;
+            ts.trend = constrain(ts.trend + TRACK_BETA * residual / dt, -TRACK_TREND_MAX, TRACK_TREND_MAX);
+            float rate = 1.0f / dt;
+            ts.rateHz = ts.samples > 1 ? ts.rateHz + RATE_SMOOTHING * (rate - ts.rateHz) : rate;
+        }
+        ts.raw = rssi;
+        ts.samples++;
+        ts.lastMs = now;
+        if (ts.samples == 1 || now - ts.forwardMs >= TRACK_FORWARD_MS) {
+            ts.forwardMs = now;
+            forward = true;
+        }
+    }
+    portEXIT_CRITICAL(&trackMux);
+    return forward;
+}
+
+void trackerRead(TrackReading* out) {
+    uint32_t now = millis();
+    portENTER_CRITICAL(&trackMux);
+    out->active = ts.active;
+    memcpy(out->mac, ts.mac, 6);
+    out->isBLE = ts.isBLE;
+    out->channel = ts.channel;
+    out->rssi = ts.level;
+    out->trendDbps = ts.trend;
+    out->rawRssi = ts.raw;
+    out->samples = ts.samples;
+    out->elapsedMs = now - ts.startMs;
+    out->ageMs = now - (ts.samples ? ts.lastMs : ts.startMs);
+    // A rate only means something while samples keep coming
+    out->rateHz = out->ageMs < TRACK_STALE_MS ? ts.rateHz : 0.0f;
+    portEXIT_CRITICAL(&trackMux);
+}
+
+bool trackerParseMac(const char* str, uint8_t* mac) {
+    unsigned int b[6];
+    char tail;
+    if (!str || sscanf(str, "%2x:%2x:%2x:%2x:%2x:%2x%c", &b[0], &b[1], &b[2], &b[3], &b[4], &b[5], &tail) != 6) {
+        return false;
+    }
+    for (int i = 0; i < 6; i++) mac[i] = (uint8_t)b[i];
+    return true;
+}
@@ -99,9 +99,10 @@ canvas{width:100%;border-radius:10px;background:var(--card);border:1px solid var
 <div id="detections" class="page">
 <div class="filter-bar">
 <button class="filter-btn active" onclick="setFilter('all',this)">All</button>
-<button class="filter-btn" onclick="setFilter('high',this)">High</button>
-<button class="filter-btn" onclick="setFilter('medium',this)">Medium</button>
-<button class="filter-btn" onclick="setFilter('low',this)">Low</button>
+<button class="filter-btn" onclick="setFilter('high',this)">Tier 4-5</button>
+<button class="filter-btn" onclick="setFilter('medium',this)">Tier 3+</button>
+<button class="filter-btn" onclick="setFilter('ble',this)">BLE</button>
+<button class="filter-btn" onclick="setFilter('wifi',this)">WiFi</button>
 </div>
 <div id="detList"></div>
 </div>
@@ -117,6 +118,7 @@ canvas{width:100%;border-radius:10px;background:var(--card);border:1px solid var
 <h3>Scanning</h3>
 <div class="toggle-row"><span class="toggle-label">BLE Scanning</span><label class="toggle"><input type="checkbox" id="cfgBLE" onchange="updateConfig()"><span class="slider"></span></label></div>
 <div class="toggle-row"><span class="toggle-label">WiFi Scanning</span><label class="toggle"><input type="checkbox" id="cfgWiFi" onchange="updateConfig()"><span class="slider"></span></label></div>
+<div class="toggle-row"><span class="toggle-label">Scan Profile</span><select id="cfgProfile" onchange="updateConfig()" style="font-size:13px;background:#374151;color:#fff;border:none;border-radius:6px;padding:4px 8px"><option value="quick">Quick</option><option value="normal">Normal</option><option value="powersave">Power Save</option></select></div>
 </div>
 <div class="card">
 <h3>Logging</h3>
@@ -128,6 +130,13 @@ canvas{width:100%;border-radius:10px;background:var(--card);border:1px solid var
 <div class="toggle-row"><span class="toggle-label">Auto Brightness</span><label class="toggle"><input type="checkbox" id="cfgAutoBr" onchange="updateConfig()"><span class="slider"></span></label></div>
 <div class="toggle-row"><span class="toggle-label">Show Baseline</span><label class="toggle"><input type="checkbox" id="cfgBaseline" onchange="updateConfig()"><span class="slider"></span></label></div>
 </div>
+<div class="card">
+<h3>Priority Database</h3>
+<p style="color:var(--muted);font-size:13px;margin-bottom:12px">Upload priority.json or priority.bin. The new table is swapped in live &mdash; detections are kept.</p>
+<input type="file" id="priFile" accept=".json,.bin" style="font-size:13px;margin-bottom:8px">
+<button class="btn btn-primary" onclick="uploadPriority()">Upload</button>
+<div id="priStatus" style="color:var(--muted);font-size:12px;margin-top:8px"></div>
+</div>
 </div>
 
 <!-- LOGS -->
@@ -162,19 +171,28 @@ canvas{width:100%;border-radius:10px;background:var(--card);border:1px solid var
 
 <script>
 let allDetections=[],currentFilter='all';
+// Filtering and trimming happen on the device — each view only asks for the rows/fields it shows
+var FILTER_QUERY={all:'',high:'minPriority=4',medium:'minPriority=3',ble:'proto=ble',wifi:'proto=wifi'};
+var ROW_FIELDS='fields=mac,manufacturer,category,isBLE,rssi,sightings,priority,threat';
+function detQuery(){
+  var a=document.querySelector('.page.active'),page=a?a.id:'dashboard';
+  if(page==='dashboard')return '?limit=5&'+ROW_FIELDS;
+  if(page==='radar')return '?fields=mac,manufacturer,rssi,threat';
+  var q=FILTER_QUERY[currentFilter];return '?'+(q?q+'&':'')+ROW_FIELDS;
+}
 function showPage(id,el){
   document.querySelectorAll('.page').forEach(p=>p.classList.remove('active'));
   document.getElementById(id).classList.add('active');
   document.querySelectorAll('.nav a').forEach(a=>a.classList.remove('active'));
   if(el)el.classList.add('active');
-  if(id==='radar')drawRadar();
   if(id==='logs')loadLogs();
+  fetchData();
 }
 function setFilter(f,el){
   currentFilter=f;
   document.querySelectorAll('.filter-btn').forEach(b=>b.classList.remove('active'));
   el.classList.add('active');
-  renderDetections();
+  fetchData();
 }
 function threatClass(s){return s>=60?'threat-high':s>=30?'threat-med':'threat-low'}
 function prioClass(p){return p>=4?'high':p>=3?'medium':'low'}
@@ -185,7 +203,7 @@ function renderDetRow(d){
     '<div class="det-right"><div class="det-threat '+threatClass(d.threat)+'">'+d.threat+'</div><div class="det-rssi">'+d.mac.substring(0,8)+'</div></div></div>';
 }
 function renderDetections(){
-  var f=currentFilter==='all'?allDetections:allDetections.filter(function(d){return d.relevance.toLowerCase()===currentFilter});
+  var f=allDetections;
   document.getElementById('detList').innerHTML=f.length?f.map(renderDetRow).join(''):'<p style="color:var(--muted);text-align:center;padding:40px">No detections yet...</p>';
 }
 function drawRadar(){
@@ -209,9 +227,12 @@ function drawRadar(){
     ctx.fillStyle='#e2e8f0';ctx.font='10px sans-serif';ctx.fillText(d.manufacturer.substring(0,8),px+12,py+4);
   });
 }
+// Refresh latency as the user sees it, reported with the next status poll (failed refreshes count too)
+var lastRtt=0;
 async function fetchData(){
+  var t0=performance.now();
   try{
-    var res=await Promise.all([fetch('/api/detections').then(function(r){return r.json()}),fetch('/api/status').then(function(r){return r.json()})]);
+    var res=await Promise.all([fetch('/api/detections'+detQuery()).then(function(r){return r.json()}),fetch('/api/status'+(lastRtt?'?rtt='+lastRtt:'')).then(function(r){return r.json()})]);
     var det=res[0],st=res[1];
     allDetections=det.detections||[];
     document.getElementById('sTotal').textContent=det.total||0;
@@ -229,6 +250,7 @@ async function fetchData(){
     renderDetections();
     if(document.getElementById('radar').classList.contains('active'))drawRadar();
   }catch(e){console.error('Fetch error:',e);}
+  lastRtt=Math.max(1,Math.round(performance.now()-t0));
 }
 async function loadCfg(){
   try{
@@ -239,14 +261,26 @@ async function loadCfg(){
     document.getElementById('cfgSecure').checked=c.secure;
     document.getElementById('cfgAutoBr').checked=c.autoBrightness;
     document.getElementById('cfgBaseline').checked=c.showBaseline;
+    document.getElementById('cfgProfile').value=c.scanMode||'normal';
   }catch(e){}
 }
 async function updateConfig(){
   var body={ble:document.getElementById('cfgBLE').checked,wifi:document.getElementById('cfgWiFi').checked,
     logging:document.getElementById('cfgLog').checked,secure:document.getElementById('cfgSecure').checked,
-    autoBrightness:document.getElementById('cfgAutoBr').checked,showBaseline:document.getElementById('cfgBaseline').checked};
+    autoBrightness:document.getElementById('cfgAutoBr').checked,showBaseline:document.getElementById('cfgBaseline').checked,
+    scanMode:document.getElementById('cfgProfile').value};
   try{await fetch('/api/config',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(body)});}catch(e){}
 }
+async function uploadPriority(){
+  var f=document.getElementById('priFile').files[0],st=document.getElementById('priStatus');
+  if(!f){st.innerText='Choose a file first.';return;}
+  var fd=new FormData();fd.append('file',f,f.name);
+  st.innerText='Uploading...';
+  try{
+    var r=await fetch('/api/priority',{method:'POST',body:fd});var j=await r.json();
+    st.innerText=r.ok?'Uploaded \u2014 reloading priority table.':'Error: '+j.error;
+  }catch(e){st.innerText='Upload failed.';}
+}
 async function loadLogs(){
   try{
     var data=await fetch('/api/logs').then(function(r){return r.text()});
@@ -1,7 +1,24 @@
 #include "wifi_promiscuous.h"
+#include "esp_timer.h"
 
 static wifi_promiscuous_callback_t user_callback = nullptr;
 static uint8_t current_channel = 1;
+static uint8_t target_mac[6];
+static volatile bool target_set = false;
+
+// Hopper state shared with the packet handler (yield counters)
+static portMUX_TYPE hopMux = portMUX_INITIALIZER_UNLOCKED;
+static volatile bool hopping = false;
+static HopperStats hstats;
+
+// Per-channel counts since the last hopperAdaptPlan(), while hopping
+struct YieldWindow {
+    uint32_t newMacs;
+    uint32_t hits;
+    uint32_t dwellMs;
+};
+static YieldWindow ywin[WIFI_CHANNELS + 1];
+static bool yieldSeeded = false;
 
 // Larger hash cache reduces collisions during high-density scans
 static unsigned long detected_macs[256];
@@ -52,10 +69,14 @@ void resetDetectionCache() {
 //
 // Tagged parameter format: [tag_id(1)] [tag_len(1)] [data(tag_len)]
 // Tag 0 = SSID element
+// Tag 3 = DS Parameter Set: the AP's own channel. Beacons are often heard
+//         one or two channels off, so this beats the receive channel.
 // ──────────────────────────────────────────────────────────────
 static void extractSSID(const uint8_t* payload, int pkt_len,
-                        uint8_t frame_subtype, char* ssid_out, int ssid_max) {
+                        uint8_t frame_subtype, char* ssid_out, int ssid_max,
+                        uint8_t* ds_channel = nullptr) {
     ssid_out[0] = '\0';
+    bool need_ssid = true;
 
     // Body offset: probe requests have no fixed fields; beacons/responses have 12
     int body_off = (frame_subtype == 0x04) ? 24 : 36;
@@ -70,7 +91,7 @@ static void extractSSID(const uint8_t* payload, int pkt_len,
         uint8_t tag_id  = body[pos];
         uint8_t tag_len = body[pos + 1];
         if (pos + 2 + tag_len > body_len) break; // bounds guard
-        if (tag_id == 0) { // SSID element
+        if (tag_id == 0 && need_ssid) { // SSID element
             int copy_len = (tag_len < ssid_max - 1) ? tag_len : ssid_max - 1;
             // Filter non-printable bytes to keep strings clean
             for (int j = 0; j < copy_len; j++) {
@@ -78,30 +99,45 @@ static void extractSSID(const uint8_t* payload, int pkt_len,
                 ssid_out[j] = (c >= 0x20 && c < 0x7F) ? (char)c : '?';
             }
             ssid_out[copy_len] = '\0';
-            return;
+            need_ssid = false;
+            if (!ds_channel) return;
+        } else if (tag_id == 3 && tag_len == 1 && ds_channel) {
+            *ds_channel = body[pos + 2];
+            if (!need_ssid) return;
         }
-        if (tag_len == 0) break; // zero-length tag guard against infinite loop
-        pos += 2 + tag_len;
+        pos += 2 + tag_len;     // always advances, zero-length tags included
     }
 }
 
 // ──────────────────────────────────────────────────────────────
 // WiFi promiscuous mode packet callback
-// Captures management frames, extracts source MAC + SSID, deduplicates,
-// then fires user_callback.
+// Captures management frames, deduplicates by source MAC, then extracts
+// the SSID (and for beacons / probe responses the AP's channel) and fires
+// user_callback. Beacons and probe responses are the AP discovery path:
+// no active scan is needed to find networks.
 // ──────────────────────────────────────────────────────────────
 void wifi_sniffer_packet_handler(void* buff, wifi_promiscuous_pkt_type_t type) {
-    if (type != WIFI_PKT_MGMT || user_callback == nullptr) return;
+    if (user_callback == nullptr) return;
 
     const wifi_promiscuous_pkt_t    *ppkt = (wifi_promiscuous_pkt_t *)buff;
     const wifi_ieee80211_packet_t   *ipkt = (wifi_ieee80211_packet_t *)ppkt->payload;
     const wifi_ieee80211_mac_hdr_t  *hdr  = &ipkt->hdr;
 
+    // Target lock: any management or data frame the target transmits is one
+    // RSSI sample; everything else is ignored
+    if (target_set) {
+        if ((type == WIFI_PKT_MGMT || type == WIFI_PKT_DATA) && memcmp(hdr->addr2, target_mac, 6) == 0) {
+            user_callback(hdr->addr2, ppkt->rx_ctrl.rssi, ppkt->rx_ctrl.channel, ppkt->rx_ctrl.channel, "", false);
+        }
+        return;
+    }
+    if (type != WIFI_PKT_MGMT) return;
+
     uint8_t frame_type    = (hdr->frame_ctrl & 0x0C) >> 2;
     uint8_t frame_subtype = (hdr->frame_ctrl & 0xF0) >> 4;
 
     const uint8_t* source_mac = nullptr;
-    char ssid[33] = "";
+    bool from_ap = false;
 
     if (frame_type == 0) { // Management frame
         switch (frame_subtype) {
@@ -110,12 +146,11 @@ void wifi_sniffer_packet_handler(void* buff, wifi_promiscuous_pkt_type_t type) {
             case 0x02: // Reassociation Request
             case 0x0B: // Authentication
                 source_mac = hdr->addr2;
-                extractSSID(ppkt->payload, ppkt->rx_ctrl.sig_len, frame_subtype, ssid, sizeof(ssid));
                 break;
             case 0x08: // Beacon — AP advertising (reveals AP MAC + SSID)
             case 0x05: // Probe Response
                 source_mac = hdr->addr2;
-                extractSSID(ppkt->payload, ppkt->rx_ctrl.sig_len, frame_subtype, ssid, sizeof(ssid));
+                from_ap = true;
                 break;
         }
     }
@@ -123,8 +158,26 @@ void wifi_sniffer_packet_handler(void* buff, wifi_promiscuous_pkt_type_t type) {
     if (source_mac != nullptr) {
         // Only unicast MACs (bit 0 of first byte = 0 means unicast)
         if (!(source_mac[0] & 0x01)) {
-            if (!isRecentlyDetected(source_mac)) {
-                user_callback(source_mac, ppkt->rx_ctrl.rssi, ppkt->rx_ctrl.channel, ssid);
+            bool fresh = !isRecentlyDetected(source_mac);
+            uint8_t ch = ppkt->rx_ctrl.channel;
+            if (ch >= 1 && ch <= WIFI_CHANNELS) {
+                portENTER_CRITICAL(&hopMux);
+                hstats.ch[ch].frames++;
+                if (fresh) {
+                    hstats.ch[ch].newMacs++;
+                    if (hopping) ywin[ch].newMacs++;   // parked time is not part of the plan
+                }
+                portEXIT_CRITICAL(&hopMux);
+            }
+            if (fresh) {
+                // Body parsed once per MAC per pass, not for every repeat beacon
+                char ssid[33];
+                uint8_t ap_ch = 0;
+                extractSSID(ppkt->payload, ppkt->rx_ctrl.sig_len, frame_subtype, ssid, sizeof(ssid),
+                            from_ap ? &ap_ch : nullptr);
+                uint8_t rx_ch = ch;
+                if (ap_ch >= 1 && ap_ch <= WIFI_CHANNELS) ch = ap_ch;
+                user_callback(source_mac, ppkt->rx_ctrl.rssi, ch, rx_ch, ssid, from_ap);
             }
         }
     }
@@ -157,6 +210,16 @@ void stopWiFiPromiscuous() {
     Serial.println("WiFi promiscuous mode stopped");
 }
 
+void setPromiscuousTarget(const uint8_t* mac) {
+    target_set = false;
+    if (mac) memcpy(target_mac, mac, 6);
+    wifi_promiscuous_filter_t filter;
+    filter.filter_mask = mac ? (WIFI_PROMIS_FILTER_MASK_MGMT | WIFI_PROMIS_FILTER_MASK_DATA)
+                             : WIFI_PROMIS_FILTER_MASK_MGMT;
+    esp_wifi_set_promiscuous_filter(&filter);
+    target_set = (mac != nullptr);
+}
+
 void setPromiscuousChannel(uint8_t channel) {
     if (channel >= 1 && channel <= 13) {
         current_channel = channel;
@@ -165,26 +228,317 @@ void setPromiscuousChannel(uint8_t channel) {
 }
 
 // ──────────────────────────────────────────────────────────────
-// Full 13-channel scan with smart dwell times
-//
-// Non-overlapping primary channels (1, 6, 11) carry the most real-world
-// traffic so they get 2× dwell time. Overlapping secondary channels
-// (2-5, 7-10, 12-13) get standard dwell — still fully scanned to catch
-// surveillance devices configured on non-standard channels.
+// Timer-driven channel hopper
 //
-// Total scan time at dwell_time_ms=150: (3×300) + (10×150) = 2400 ms
-// vs the old 3-channel scan: (3×150) = 450 ms
+// The default plan keeps the old dwell split: non-overlapping primary
+// channels (1, 6, 11) carry the most real-world traffic so they get 2×
+// dwell; overlapping secondary channels (2-5, 7-10, 12-13) get 1× — still
+// fully covered to catch devices configured on non-standard channels.
+// At 150 ms: (3×300) + (10×150) = 2400 ms per pass, now spent capturing
+// in the background instead of blocking the scan task.
 // ──────────────────────────────────────────────────────────────
-void scanAllChannels(wifi_promiscuous_callback_t callback, int dwell_time_ms) {
-    user_callback = callback;
-    resetDetectionCache();
+static esp_timer_handle_t hopTimer = nullptr;
+
+static HopStep plan[HOP_PLAN_MAX];     // running plan, home returns included
+static uint8_t planLen = 0;
+static HopStep nextPlan[HOP_PLAN_MAX];  // base plan staged by hopperSetPlan(), expanded at pass start
+static uint8_t nextPlanLen = 0;
+static bool    nextPlanReady = false;
+
+static uint8_t  homeChannel = 0;
+static uint16_t homeMaxAwayMs = 0;
+static uint16_t homeHoldMs = 0;
+static int64_t  awayStartUs = 0;        // left home at; 0 = at home
+static int64_t  passAwayMaxUs = 0;
+
+static uint8_t hopIndex = 0;
+static uint8_t hopParkChannel = 1;
+static int64_t stepStartUs = 0;         // when the current channel was entered
+static int64_t stepDueUs = 0;           // when the timer should fire for the next hop
+static int64_t sweepStartUs = 0;
+
+static uint64_t jitterSumUs = 0;
+
+// Build the running plan from the base plan, inserting a hold on the home
+// channel whenever the next step would take the radio away for longer than
+// awayMs. Returns false if the result doesn't fit in HOP_PLAN_MAX.
+static bool expandPlan(uint32_t awayMs) {
+    uint8_t n = 0;
+    uint32_t away = 0;
+    for (uint8_t i = 0; i < nextPlanLen; i++) {
+        const HopStep& s = nextPlan[i];
+        if (awayMs == 0 || s.channel == homeChannel) {
+            if (n >= HOP_PLAN_MAX) return false;
+            plan[n++] = s;
+            away = s.channel == homeChannel ? 0 : away + s.dwellMs;
+            continue;
+        }
+        uint32_t left = s.dwellMs;
+        while (left > 0) {
+            uint32_t room = awayMs > away ? awayMs - away : 0;
+            // Too little room left for a useful slice: go home first
+            if (away > 0 && room < min(left, (uint32_t)HOP_MIN_DWELL_MS)) {
+                if (n >= HOP_PLAN_MAX) return false;
+                plan[n++] = {homeChannel, homeHoldMs};
+                away = 0;
+                room = awayMs;
+            }
+            uint32_t slice = min(left, room);
+            if (n >= HOP_PLAN_MAX) return false;
+            plan[n++] = {s.channel, (uint16_t)slice};
+            away += slice;
+            left -= slice;
+        }
+    }
+    planLen = n;
+    return true;
+}
+
+// Caller holds hopMux
+static void adoptNextPlan() {
+    if (!nextPlanReady) return;
+    uint32_t awayMs = homeChannel ? homeMaxAwayMs : 0;
+    // A bound too tight for the plan table is relaxed rather than dropping channels
+    while (!expandPlan(awayMs)) awayMs *= 2;
+    hstats.homeChannel = awayMs ? homeChannel : 0;
+    hstats.maxAwayMs = (uint16_t)min(awayMs, (uint32_t)UINT16_MAX);
+    nextPlanReady = false;
+    for (int c = 1; c <= WIFI_CHANNELS; c++) hstats.ch[c].planDwellMs = 0;
+    for (uint8_t i = 0; i < planLen; i++) hstats.ch[plan[i].channel].planDwellMs += plan[i].dwellMs;
+}
+
+// Caller holds hopMux. Track absences from the home channel.
+static void noteChannelEntry(uint8_t channel, int64_t now) {
+    if (!hstats.homeChannel) return;
+    if (channel != hstats.homeChannel) {
+        if (!awayStartUs) awayStartUs = now;
+        return;
+    }
+    if (awayStartUs) {
+        if (now - awayStartUs > passAwayMaxUs) passAwayMaxUs = now - awayStartUs;
+        awayStartUs = 0;
+    }
+}
+
+// Enter plan step idx at time now and arm the timer for its end. hopperStop()
+// may run on the other core at any point: `hopping` is re-checked under
+// hopMux before the switch and again before arming, and a stop that landed
+// in between gets its park channel back rather than the step's.
+static void enterStep(uint8_t idx, int64_t now) {
+    portENTER_CRITICAL(&hopMux);
+    bool live = hopping;
+    portEXIT_CRITICAL(&hopMux);
+    if (!live) return;
+    setPromiscuousChannel(plan[idx].channel);   // not under the mux: the driver call may block
+
+    portENTER_CRITICAL(&hopMux);
+    live = hopping;
+    if (live) {
+        stepStartUs = now;
+        stepDueUs += (int64_t)plan[idx].dwellMs * 1000;
+        if (stepDueUs < now) stepDueUs = now + (int64_t)plan[idx].dwellMs * 1000;   // fell behind: re-anchor
+        esp_timer_start_once(hopTimer, (uint64_t)(stepDueUs - now));
+    }
+    portEXIT_CRITICAL(&hopMux);
+    if (!live) setPromiscuousChannel(hopParkChannel);
+}
+
+static void onHopTimer(void*) {
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&hopMux);
+    if (!hopping) {
+        portEXIT_CRITICAL(&hopMux);
+        return;
+    }
+    uint32_t jitter = (uint32_t)(now > stepDueUs ? now - stepDueUs : stepDueUs - now);
+    jitterSumUs += jitter;
+    if (jitter > hstats.jitterMaxUs) hstats.jitterMaxUs = jitter;
+    hstats.hops++;
+    hstats.jitterAvgUs = (uint32_t)(jitterSumUs / hstats.hops);
+    HopChannelStats& cs = hstats.ch[plan[hopIndex].channel];
+    uint32_t dwellMs = (uint32_t)((now - stepStartUs) / 1000);
+    cs.visits++;
+    cs.dwellMs += dwellMs;
+    cs.lastDwellMs = (uint16_t)dwellMs;
+    ywin[plan[hopIndex].channel].dwellMs += dwellMs;
+
+    bool passDone = ++hopIndex >= planLen;
+    if (passDone) {
+        noteChannelEntry(hopParkChannel, now);
+        hstats.sweeps++;
+        hstats.lastSweepMs = (uint32_t)((now - sweepStartUs) / 1000);
+        hstats.lastAwayMaxMs = (uint32_t)(passAwayMaxUs / 1000);
+        hopIndex = 0;
+        sweepStartUs = now;
+        hopping = false;
+        adoptNextPlan();
+    } else {
+        uint8_t next = plan[hopIndex].channel;
+        if (next == hstats.homeChannel && next != plan[hopIndex - 1].channel) hstats.homeReturns++;
+        noteChannelEntry(next, now);
+    }
+    portEXIT_CRITICAL(&hopMux);
+
+    if (passDone) {
+        setPromiscuousChannel(hopParkChannel);
+        return;
+    }
+    enterStep(hopIndex, now);
+}
+
+void hopperSetPlan(const HopStep* steps, uint8_t n) {
+    uint8_t m = 0;
+    HopStep tmp[HOP_PLAN_MAX];
+    for (uint8_t i = 0; i < n && m < HOP_PLAN_MAX; i++) {
+        if (steps[i].channel < 1 || steps[i].channel > WIFI_CHANNELS || steps[i].dwellMs == 0) continue;
+        tmp[m++] = steps[i];
+    }
+    if (m == 0) return;
+    portENTER_CRITICAL(&hopMux);
+    memcpy(nextPlan, tmp, sizeof(HopStep) * m);
+    nextPlanLen = m;
+    nextPlanReady = true;
+    if (!hopping) adoptNextPlan();
+    portEXIT_CRITICAL(&hopMux);
+}
+
+void hopperSetHome(uint8_t channel, uint16_t maxAwayMs, uint16_t holdMs) {
+    if (channel < 1 || channel > WIFI_CHANNELS || holdMs == 0) maxAwayMs = 0;
+    if (maxAwayMs && maxAwayMs < HOP_MIN_DWELL_MS) maxAwayMs = HOP_MIN_DWELL_MS;
+    portENTER_CRITICAL(&hopMux);
+    homeChannel = maxAwayMs ? channel : 0;
+    homeMaxAwayMs = maxAwayMs;
+    homeHoldMs = holdMs;
+    nextPlanReady = nextPlanLen > 0;
+    if (!hopping) adoptNextPlan();
+    portEXIT_CRITICAL(&hopMux);
+}
+
+void hopperDefaultPlan(uint16_t dwellMs) {
+    static const bool primary[WIFI_CHANNELS] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0};
+    HopStep steps[WIFI_CHANNELS];
+    for (uint8_t i = 0; i < WIFI_CHANNELS; i++) {
+        steps[i].channel = i + 1;
+        steps[i].dwellMs = primary[i] ? dwellMs * 2 : dwellMs;
+    }
+    hopperSetPlan(steps, WIFI_CHANNELS);
+}
+
+uint8_t hopperGetPlan(HopStep* out, uint8_t max) {
+    portENTER_CRITICAL(&hopMux);
+    uint8_t n = planLen < max ? planLen : max;
+    memcpy(out, plan, sizeof(HopStep) * n);
+    portEXIT_CRITICAL(&hopMux);
+    return n;
+}
+
+bool hopperSweep(uint8_t parkChannel) {
+    if (hopping) return false;
+    if (!hopTimer) {
+        esp_timer_create_args_t args = {};
+        args.callback = &onHopTimer;
+        args.name = "hop";
+        if (esp_timer_create(&args, &hopTimer) != ESP_OK) {
+            Serial.println("[HOP] Timer create failed");
+            return false;
+        }
+    }
+    portENTER_CRITICAL(&hopMux);
+    adoptNextPlan();
+    portEXIT_CRITICAL(&hopMux);
+    if (planLen == 0) hopperDefaultPlan(150);
+
+    hopParkChannel = parkChannel;
+    resetDetectionCache();          // dedupe is per pass (and the parked time after it)
+    int64_t now = esp_timer_get_time();
+    hopIndex = 0;
+    sweepStartUs = now;
+    stepDueUs = now;
+    portENTER_CRITICAL(&hopMux);
+    awayStartUs = 0;                // starts from the park channel
+    passAwayMaxUs = 0;
+    if (current_channel != hstats.homeChannel) noteChannelEntry(current_channel, now);
+    noteChannelEntry(plan[0].channel, now);
+    hopping = true;
+    portEXIT_CRITICAL(&hopMux);
+    enterStep(0, now);
+    return true;
+}
+
+void hopperStop(uint8_t parkChannel) {
+    portENTER_CRITICAL(&hopMux);
+    hopping = false;
+    hopParkChannel = parkChannel;   // where an enterStep() caught mid-switch goes back to
+    awayStartUs = 0;
+    portEXIT_CRITICAL(&hopMux);
+    if (hopTimer) esp_timer_stop(hopTimer);
+    setPromiscuousChannel(parkChannel);
+}
+
+bool hopperActive() { return hopping; }
+
+void hopperStats(HopperStats* out) {
+    portENTER_CRITICAL(&hopMux);
+    *out = hstats;
+    portEXIT_CRITICAL(&hopMux);
+    out->channel = current_channel;
+    out->active = hopping;
+}
+
+// ── Adaptive dwell ────────────────────────────────────────────────────────
+
+// Only frames heard during a hop step count: a hit while parked would credit
+// the park channel with time the plan never gave it. Frames are queued, so a
+// hop-step hit can arrive just after the pass ends; the caller tags them.
+void hopperCreditHit(uint8_t channel) {
+    if (channel < 1 || channel > WIFI_CHANNELS) return;
+    portENTER_CRITICAL(&hopMux);
+    hstats.ch[channel].hits++;
+    ywin[channel].hits++;
+    portEXIT_CRITICAL(&hopMux);
+}
+
+void hopperAdaptPlan(uint32_t budgetMs, uint8_t explorePct) {
+    float yield[WIFI_CHANNELS + 1];
+    float total = 0;
+    bool seeded;
+
+    // Fold the window into the smoothed yield. Channels not visited this
+    // window (plan changed mid-way) keep their previous estimate.
+    portENTER_CRITICAL(&hopMux);
+    for (int c = 1; c <= WIFI_CHANNELS; c++) {
+        HopChannelStats& cs = hstats.ch[c];
+        YieldWindow& w = ywin[c];
+        if (w.dwellMs > 0) {
+            float inst = (w.newMacs + HOP_HIT_WEIGHT * (float)w.hits) * 1000.0f / w.dwellMs;
+            cs.yield = yieldSeeded ? cs.yield + HOP_YIELD_SMOOTHING * (inst - cs.yield) : inst;
+        }
+        w = YieldWindow();
+        yield[c] = cs.yield;
+        total += cs.yield;
+    }
+    yieldSeeded = true;
+    seeded = total > 0;
+    portEXIT_CRITICAL(&hopMux);
+
+    if (!seeded) {
+        hopperDefaultPlan((uint16_t)(budgetMs / 16));   // 3 x 2 + 10 x 1 shares
+        return;
+    }
 
-    static const uint8_t channels[] = { 1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13};
-    static const bool    primary[]  = { 1,  0,  0,  0,  0,  1,  0,  0,  0,  0,  1,  0,  0};
-    const int num_channels = 13;
+    if (explorePct > 100) explorePct = 100;
+    uint32_t floorMs = budgetMs * explorePct / 100 / WIFI_CHANNELS;
+    if (floorMs < HOP_MIN_DWELL_MS) floorMs = HOP_MIN_DWELL_MS;
+    uint32_t floorTotal = floorMs * WIFI_CHANNELS;
+    float spread = budgetMs > floorTotal ? (float)(budgetMs - floorTotal) : 0.0f;
 
-    for (int i = 0; i < num_channels; i++) {
-        setPromiscuousChannel(channels[i]);
-        delay(primary[i] ? dwell_time_ms * 2 : dwell_time_ms);
+    HopStep steps[WIFI_CHANNELS];
+    for (int c = 1; c <= WIFI_CHANNELS; c++) {
+        uint32_t dwell = floorMs + (uint32_t)(spread * yield[c] / total + 0.5f);
+        if (dwell > HOP_MAX_DWELL_MS) dwell = HOP_MAX_DWELL_MS;
+        steps[c - 1].channel = c;
+        steps[c - 1].dwellMs = (uint16_t)dwell;
     }
+    hopperSetPlan(steps, WIFI_CHANNELS);
 }
@@ -0,0 +1,247 @@
+// Host microbenchmark: per-advert decode cost in the BLE scan callback, the
+// old NimBLE accessor sequence vs the single-pass parser in src/ble_adv.cpp.
+//
+// Build and run from the repository root:
+//   g++ -O2 -std=c++17 -Iinclude tools/bench/ble_adv_bench.cpp src/ble_adv.cpp -o /tmp/advbench
+//   /tmp/advbench [adverts]
+//
+// The accessor side reproduces what NimBLE-Arduino 1.4 does behind each call
+// the old callback made: every have*/get* re-walks the payload for its AD
+// type, getName() / getManufacturerData() return a std::string copy,
+// getServiceUUID(i) walks to the i-th UUID across all list fields, and the
+// address goes through toString(). Only 16-bit list UUIDs were looked at.
+// The parser side is the new callback: one bleAdvParse() plus
+// bleAdvShortUuids(). Both sides must agree on company ID, name and TX power.
+// Host std::string keeps short strings inline, so the heap traffic the old
+// path causes on the ESP32 (every copy is a malloc) is understated here.
+//
+// Payloads are a mix seen in a typical UK street scan: Apple Continuity,
+// Google Fast Pair, Eddystone, Microsoft CDP, a named wearable with a scan
+// response, a 128-bit vendor service, and a Xiaomi sensor that only sends service data.
+
+#include "ble_adv.h"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+typedef std::vector<uint8_t> Payload;
+
+static void field(Payload& p, uint8_t type, std::initializer_list<uint8_t> v) {
+    p.push_back((uint8_t)(v.size() + 1));
+    p.push_back(type);
+    p.insert(p.end(), v);
+}
+
+static void nameField(Payload& p, uint8_t type, const char* s) {
+    p.push_back((uint8_t)(strlen(s) + 1));
+    p.push_back(type);
+    p.insert(p.end(), s, s + strlen(s));
+}
+
+static std::vector<Payload> samples() {
+    std::vector<Payload> out;
+    Payload p;
+
+    field(p, 0x01, {0x1A});                                         // Apple Continuity
+    field(p, 0xFF, {0x4C, 0x00, 0x10, 0x05, 0x01, 0x18, 0x4E, 0x21, 0x7A});
+    field(p, 0x0A, {0x0C});
+    out.push_back(p); p.clear();
+
+    field(p, 0x01, {0x06});                                         // Google Fast Pair
+    field(p, 0x03, {0x2C, 0xFE});
+    field(p, 0x16, {0x2C, 0xFE, 0x00, 0xC3, 0x5E});
+    field(p, 0x0A, {0xF6});
+    out.push_back(p); p.clear();
+
+    field(p, 0x01, {0x06});                                         // Eddystone URL
+    field(p, 0x03, {0xAA, 0xFE});
+    field(p, 0x16, {0xAA, 0xFE, 0x10, 0xEB, 0x03, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 0x07});
+    out.push_back(p); p.clear();
+
+    field(p, 0xFF, {0x06, 0x00, 0x01, 0x09, 0x20, 0x02, 0x6B, 0x13, 0xD8, 0x5F,   // Microsoft CDP
+                    0x48, 0xA5, 0x3C, 0x61, 0x12, 0x99, 0x0E, 0x2A, 0x07, 0x44, 0x51, 0x07, 0x8E});
+    out.push_back(p); p.clear();
+
+    field(p, 0x01, {0x06});                                         // Wearable + scan response
+    field(p, 0x03, {0x0D, 0x18, 0x0F, 0x18, 0x0A, 0x18});
+    field(p, 0xFF, {0x59, 0x00, 0x01, 0x02});
+    nameField(p, 0x09, "Forerunner 255");
+    field(p, 0x0A, {0x04});
+    out.push_back(p); p.clear();
+
+    field(p, 0x01, {0x06});                                         // 128-bit vendor service
+    field(p, 0x07, {0x9E, 0xCA, 0xDC, 0x24, 0x0E, 0xE5, 0xA9, 0xE0, 0x93, 0xF3, 0xA3, 0xB5, 0x01, 0x00, 0x40, 0x6E});
+    nameField(p, 0x08, "AXON Body");
+    out.push_back(p); p.clear();
+
+    field(p, 0x01, {0x06});                                         // Xiaomi MiBeacon: service data only
+    field(p, 0x16, {0x95, 0xFE, 0x30, 0x58, 0x5B, 0x05, 0x01, 0x8C, 0x3B, 0x11, 0x7F, 0x20, 0x4E});
+    out.push_back(p); p.clear();
+
+    return out;
+}
+
+// ── Old path: NimBLE 1.4 accessor semantics ───────────────────────────────
+
+struct AccessorDevice {
+    const Payload& p;
+    uint8_t addr[6];
+
+    static const size_t NONE = (size_t)-1;
+
+    // NimBLEAdvertisedDevice::findAdvField(): offset of the first field of
+    // this type. Every accessor calls it.
+    size_t findAdvField(uint8_t type) const {
+        for (size_t off = 0; off + 1 < p.size() && p[off] && off + 1 + p[off] <= p.size(); off += p[off] + 1) {
+            if (p[off + 1] == type) return off;
+        }
+        return NONE;
+    }
+    std::string fieldString(size_t at) const { return std::string((const char*)&p[at + 2], p[at] - 1); }
+
+    bool haveName() const { return findAdvField(0x09) != NONE || findAdvField(0x08) != NONE; }
+    std::string getName() const {
+        size_t at = findAdvField(0x09);
+        if (at == NONE) at = findAdvField(0x08);
+        return at == NONE ? "" : fieldString(at);
+    }
+    bool haveManufacturerData() const { return findAdvField(0xFF) != NONE; }
+    std::string getManufacturerData() const {
+        size_t at = findAdvField(0xFF);
+        return at == NONE ? "" : fieldString(at);
+    }
+    size_t uuidsIn(uint8_t type, uint8_t size) const {
+        size_t total = 0;
+        for (size_t off = 0; off + 1 < p.size() && p[off]; off += p[off] + 1) {
+            if (p[off + 1] == type) total += (p[off] - 1) / size;
+        }
+        return total;
+    }
+    size_t getServiceUUIDCount() const {
+        return uuidsIn(0x02, 2) + uuidsIn(0x03, 2) + uuidsIn(0x04, 4) + uuidsIn(0x05, 4)
+             + uuidsIn(0x06, 16) + uuidsIn(0x07, 16);
+    }
+    // (bits, 16-bit value) of the index-th UUID across all list fields
+    std::pair<int, uint16_t> getServiceUUID(size_t index) const {
+        static const uint8_t TYPES[6] = {0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+        static const uint8_t SIZES[6] = {2, 2, 4, 4, 16, 16};
+        for (int t = 0; t < 6; t++) {
+            for (size_t off = 0; off + 1 < p.size() && p[off]; off += p[off] + 1) {
+                if (p[off + 1] != TYPES[t]) continue;
+                size_t n = (p[off] - 1) / SIZES[t];
+                if (index < n) {
+                    const uint8_t* u = &p[off + 2 + index * SIZES[t]];
+                    return {SIZES[t] * 8, (uint16_t)(u[0] | (u[1] << 8))};
+                }
+                index -= n;
+            }
+        }
+        return {0, 0};
+    }
+    bool haveTXPower() const { return findAdvField(0x0A) != NONE; }
+    int8_t getTXPower() const {
+        size_t at = findAdvField(0x0A);
+        return at == NONE ? -99 : (int8_t)p[at + 2];
+    }
+    std::string addressString() const {
+        char buf[18];
+        snprintf(buf, sizeof(buf), "%02x:%02x:%02x:%02x:%02x:%02x", addr[5], addr[4], addr[3], addr[2], addr[1], addr[0]);
+        return buf;
+    }
+};
+
+struct Result { uint32_t company; std::string name; int tx; size_t uuids; size_t mac; };
+
+static Result oldCallback(const AccessorDevice& d) {
+    Result r{0xFFFFFFFF, "", -128, 0, 0};
+    std::string name = d.haveName() ? d.getName() : "";
+    r.name = std::string(name.c_str());                             // String(bleName)
+    if (d.haveManufacturerData()) {
+        std::string mfr = d.getManufacturerData();
+        if (mfr.size() >= 2) r.company = (uint8_t)mfr[0] | ((uint8_t)mfr[1] << 8);
+    }
+    for (size_t i = 0; i < d.getServiceUUIDCount(); i++) {
+        auto u = d.getServiceUUID(i);
+        if (u.first == 16) r.uuids++;
+    }
+    if (d.haveTXPower()) r.tx = d.getTXPower();
+    std::string mac = d.addressString();
+    r.mac = std::string(mac.c_str()).size();                        // String(toString().c_str())
+    return r;
+}
+
+// ── New path ──────────────────────────────────────────────────────────────
+
+static Result newCallback(const Payload& p, const uint8_t* addr, size_t& allUuids) {
+    Result r{0xFFFFFFFF, "", -128, 0, 0};
+    BleAdv adv;
+    bleAdvParse(p.data(), p.size(), adv);
+    if (adv.name) r.name.assign(adv.name, adv.nameLen);             // String::concat
+    if (adv.hasCompanyId()) r.company = adv.companyId();
+    uint16_t uuids[BLE_ADV_MAX_UUID16];
+    allUuids += bleAdvShortUuids(adv, uuids, BLE_ADV_MAX_UUID16);
+    r.uuids = adv.n16;
+    if (adv.hasTxPower) r.tx = adv.txPower;
+    char mac[18];
+    snprintf(mac, sizeof(mac), "%02X:%02X:%02X:%02X:%02X:%02X", addr[5], addr[4], addr[3], addr[2], addr[1], addr[0]);
+    r.mac = strlen(mac);
+    return r;
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? (size_t)atoll(argv[1]) : 1000000;
+    std::vector<Payload> kinds = samples();
+    std::mt19937 rng(7);
+
+    std::vector<size_t> pick(n);
+    std::vector<std::array<uint8_t, 6>> addrs(n);
+    for (size_t i = 0; i < n; i++) {
+        pick[i] = rng() % kinds.size();
+        for (auto& b : addrs[i]) b = (uint8_t)rng();
+    }
+
+    // Correctness first: both paths must decode the same fields
+    for (size_t k = 0; k < kinds.size(); k++) {
+        uint8_t addr[6] = {1, 2, 3, 4, 5, 6};
+        size_t all = 0;
+        Result a = oldCallback(AccessorDevice{kinds[k], {1, 2, 3, 4, 5, 6}});
+        Result b = newCallback(kinds[k], addr, all);
+        if (a.company != b.company || a.name != b.name || a.tx != b.tx || a.uuids != b.uuids) {
+            fprintf(stderr, "MISMATCH on sample %zu\n", k);
+            return 1;
+        }
+    }
+
+    size_t sumOld = 0, sumNew = 0, allUuids = 0, listUuids = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        AccessorDevice d{kinds[pick[i]], {}};
+        memcpy(d.addr, addrs[i].data(), 6);
+        Result r = oldCallback(d);
+        sumOld += r.company + r.name.size() + r.uuids + r.mac;
+        listUuids += r.uuids;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+        Result r = newCallback(kinds[pick[i]], addrs[i].data(), allUuids);
+        sumNew += r.company + r.name.size() + r.uuids + r.mac;
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    if (sumOld != sumNew) {
+        fprintf(stderr, "MISMATCH: accessors=%zu parser=%zu\n", sumOld, sumNew);
+        return 1;
+    }
+    double nsOld = std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+    double nsNew = std::chrono::duration<double, std::nano>(t2 - t1).count() / n;
+    printf("adverts=%zu (%zu payload kinds)\n", n, kinds.size());
+    printf("uuids:  accessors saw %zu (16-bit list only), parser sees %zu\n", listUuids, allUuids);
+    printf("decode: accessors %8.1f ns   parser %8.1f ns   speedup x%.2f\n", nsOld, nsNew, nsOld / nsNew);
+    return 0;
+}
@@ -0,0 +1,136 @@
+// Host microbenchmark: priority OUI lookup, std::map<String, Entry*> (the old
+// priorityLookup) vs the flat sorted key array + branchless binary search in
+// include/oui_key.h.
+//
+// Build and run from the repository root:
+//   g++ -O2 -std=c++17 -Iinclude tools/bench/priority_lookup_bench.cpp -o /tmp/plbench
+//   /tmp/plbench sd_card/priority.json
+//
+// Keys are taken from priority.json ("oui": "AA:BB:CC"). Queries are OUI
+// strings, as checkOUI() has them, with a configurable hit ratio (default 10%:
+// most traffic near the device is not in the priority list). std::string
+// stands in for Arduino String; both keep short strings inline, so the map's
+// per-node cost is comparable. Absolute times are host times — compare the
+// ratio, not the nanoseconds.
+
+#include "oui_key.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct Entry {
+    uint32_t key;
+    char oui[9];
+    int priority;
+};
+
+static std::vector<std::string> loadOuis(const char* path) {
+    std::vector<std::string> out;
+    std::ifstream in(path);
+    if (!in) return out;
+    std::stringstream ss;
+    ss << in.rdbuf();
+    std::string text = ss.str();
+    size_t pos = 0;
+    while ((pos = text.find("\"oui\"", pos)) != std::string::npos) {
+        size_t q = text.find('"', text.find(':', pos + 5) + 1);
+        if (q == std::string::npos) break;
+        out.push_back(text.substr(q + 1, 8));
+        pos = q + 9;
+    }
+    return out;
+}
+
+static std::string randomOui(std::mt19937& rng) {
+    char buf[9];
+    snprintf(buf, sizeof(buf), "%02X:%02X:%02X", (unsigned)(rng() & 0xFC), (unsigned)(rng() & 0xFF),
+             (unsigned)(rng() & 0xFF));
+    return buf;
+}
+
+template <typename F>
+static double timeNs(F&& fn, size_t ops) {
+    auto t0 = std::chrono::steady_clock::now();
+    fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / ops;
+}
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : "sd_card/priority.json";
+    double hitRatio = argc > 2 ? atof(argv[2]) : 0.10;
+    const size_t queries = 2000000;
+
+    std::mt19937 rng(42);
+    std::vector<std::string> ouis = loadOuis(path);
+    if (ouis.empty()) {
+        fprintf(stderr, "No OUIs read from %s — using 183 random keys\n", path);
+        for (int i = 0; i < 183; i++) ouis.push_back(randomOui(rng));
+    }
+
+    std::vector<Entry> entries(ouis.size());
+    for (size_t i = 0; i < ouis.size(); i++) {
+        snprintf(entries[i].oui, sizeof(entries[i].oui), "%s", ouis[i].c_str());
+        entries[i].priority = (int)(i % 5) + 1;
+    }
+
+    // Old: String-keyed red-black tree
+    auto m0 = std::chrono::steady_clock::now();
+    std::map<std::string, Entry*> tree;
+    for (auto& e : entries) tree[e.oui] = &e;
+    auto m1 = std::chrono::steady_clock::now();
+
+    // New: entries sorted by packed key + parallel key array (as PriorityTable::index())
+    std::vector<Entry> sorted = entries;
+    for (auto& e : sorted) e.key = ouiKey(e.oui);
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Entry& a, const Entry& b) { return a.key < b.key; });
+    std::vector<uint32_t> keys;
+    keys.reserve(sorted.size());
+    for (auto& e : sorted) keys.push_back(e.key);
+    auto m2 = std::chrono::steady_clock::now();
+
+    std::vector<std::string> q(queries);
+    size_t hits = 0;
+    for (auto& s : q) {
+        bool hit = std::uniform_real_distribution<double>(0, 1)(rng) < hitRatio;
+        s = hit ? ouis[rng() % ouis.size()] : randomOui(rng);
+    }
+
+    long sumMap = 0, sumFlat = 0;
+    double nsMap = timeNs([&] {
+        for (auto& s : q) {
+            auto it = tree.find(s);
+            if (it != tree.end()) sumMap += it->second->priority;
+        }
+    }, queries);
+    double nsFlat = timeNs([&] {
+        for (auto& s : q) {
+            int i = ouiKeyFind(keys.data(), keys.size(), ouiKey(s.c_str()));
+            if (i >= 0) { sumFlat += sorted[i].priority; hits++; }
+        }
+    }, queries);
+
+    if (sumMap != sumFlat) {
+        fprintf(stderr, "MISMATCH: map=%ld flat=%ld\n", sumMap, sumFlat);
+        return 1;
+    }
+
+    printf("entries=%zu queries=%zu hit-ratio=%.2f (actual %.3f)\n",
+           entries.size(), queries, hitRatio, (double)hits / queries);
+    printf("build:  map %8.1f us   flat %8.1f us\n",
+           std::chrono::duration<double, std::micro>(m1 - m0).count(),
+           std::chrono::duration<double, std::micro>(m2 - m1).count());
+    printf("lookup: map %8.1f ns   flat %8.1f ns   speedup x%.2f\n", nsMap, nsFlat, nsMap / nsFlat);
+    printf("memory: map ~%zu B (node+key per entry)   flat %zu B (keys)\n",
+           entries.size() * (32 + sizeof(std::string) + sizeof(Entry*)), keys.size() * sizeof(uint32_t));
+    return 0;
+}
@@ -0,0 +1,196 @@
+#!/usr/bin/env python3
+"""
+UK-OUI-SPY Bluetooth SIG Company Database Builder
+
+Builds both forms of the BT SIG company-ID table from the SIG's
+company_identifiers.yaml:
+
+    sd_card/btcompany.bin        SD card image, sorted 32-byte records
+                                 (uint32 count, then uint16 LE ID + 30-byte
+                                 NUL-padded name)
+    src/bt_company_table.cpp     flash-resident dense table compiled into the
+                                 firmware (see include/bt_company_table.h)
+
+The dense table is a uint16 index with one slot per company ID, holding the
+offset of the name in a NUL-separated pool, in 2-byte units (names are padded
+to even length so a 16-bit offset reaches 128 KB of pool). Offset 0 is "no
+name". Identical names share one pool entry. The few short names the firmware
+used to carry as a RAM fallback are merged in for IDs the SIG list lacks.
+
+Usage:
+    python tools/build_bt_db.py [company_identifiers.yaml] [btcompany.bin] [table.cpp]
+
+If the YAML is not found locally it is downloaded from the SIG repository;
+if that fails too, the existing sd_card/btcompany.bin is used as the source
+so the firmware table can still be regenerated offline.
+"""
+
+import os
+import re
+import struct
+import sys
+import urllib.request
+
+YAML_URL = ("https://bitbucket.org/bluetooth-SIG/public/raw/main/"
+            "assigned_numbers/company_identifiers/company_identifiers.yaml")
+
+RECORD_SIZE = 32
+NAME_LEN = RECORD_SIZE - 2 - 1      # name bytes before the forced NUL
+MAX_POOL = 2 * 0xFFFF               # uint16 offsets in 2-byte units
+
+# Former RAM fallback in main.cpp; only fills IDs missing from the SIG list
+FALLBACK = {
+    0x0002: "Intel",        0x0006: "Microsoft",   0x000F: "Broadcom",
+    0x0013: "Texas Instr.", 0x0019: "Qualcomm",    0x0024: "STMicro",
+    0x0046: "Parrot",       0x0059: "Nordic Semi", 0x0075: "Samsung",
+    0x004C: "Apple",        0x00E0: "Google",      0x011B: "Amazon",
+    0x0138: "Xiaomi",       0x02E5: "Espressif",   0x1049: "DJI Drone",
+}
+
+
+def utf8_truncate(s, n):
+    """Truncate to at most n UTF-8 bytes without splitting a character."""
+    b = (s or "").strip().encode("utf-8")[:n]
+    return b.decode("utf-8", "ignore").encode("utf-8")
+
+
+def read_yaml(path):
+    """{id: name} from company_identifiers.yaml (local or downloaded), or {}."""
+    if os.path.exists(path):
+        with open(path, "rb") as f:
+            raw = f.read()
+    else:
+        print(f"  Downloading {YAML_URL} ...")
+        try:
+            req = urllib.request.Request(YAML_URL, headers={"User-Agent": "uk-oui-spy"})
+            with urllib.request.urlopen(req, timeout=60) as r:
+                raw = r.read()
+        except OSError as err:
+            print(f"  ! {path}: {err}")
+            return {}
+
+    # Flat list of "- value: 0x004C" / "name: 'Apple, Inc.'" pairs; no PyYAML needed
+    out, value = {}, None
+    for line in raw.decode("utf-8", "replace").splitlines():
+        m = re.match(r"\s*-?\s*value:\s*(0x[0-9A-Fa-f]+|\d+)", line)
+        if m:
+            value = int(m.group(1), 0)
+            continue
+        m = re.match(r"\s*name:\s*(.*)$", line)
+        if m and value is not None:
+            name = m.group(1).strip()
+            if len(name) >= 2 and name[0] == name[-1] and name[0] in "'\"":
+                name = name[1:-1].replace("''", "'") if name[0] == "'" else name[1:-1]
+            out[value] = name
+            value = None
+    return out
+
+
+def read_bin(path):
+    """{id: name} from an existing btcompany.bin, or {}."""
+    if not os.path.exists(path):
+        return {}
+    with open(path, "rb") as f:
+        data = f.read()
+    (count,) = struct.unpack_from("<I", data)
+    out = {}
+    for i in range(count):
+        off = 4 + i * RECORD_SIZE
+        if off + RECORD_SIZE > len(data):
+            break
+        (cid,) = struct.unpack_from("<H", data, off)
+        out[cid] = data[off + 2:off + RECORD_SIZE].split(b"\0")[0].decode("utf-8", "ignore")
+    return out
+
+
+def build_bin(companies):
+    body = bytearray(struct.pack("<I", len(companies)))
+    for cid in sorted(companies):
+        body += struct.pack("<H", cid) + utf8_truncate(companies[cid], NAME_LEN).ljust(RECORD_SIZE - 2, b"\0")
+    return bytes(body)
+
+
+def c_string(b):
+    """bytes -> C string literal body (octal escapes keep it ASCII and unambiguous)."""
+    out = []
+    for c in b:
+        if c in (0x22, 0x5C):
+            out.append("\\" + chr(c))
+        elif 0x20 <= c < 0x7F and c != 0x3F:        # '?' escaped: no trigraphs
+            out.append(chr(c))
+        else:
+            out.append("\\%03o" % c)
+    return "".join(out)
+
+
+def build_table(companies):
+    names = {cid: utf8_truncate(n, NAME_LEN) for cid, n in companies.items() if n.strip()}
+    limit = max(names) + 1 if names else 1
+
+    chunks, offsets, index = [b"\0\0"], {}, [0] * limit
+    size = 2
+    for cid in sorted(names):
+        name = names[cid]
+        if name not in offsets:
+            offsets[name] = size // 2
+            chunk = name + b"\0"
+            chunk += b"\0" * (len(chunk) & 1)
+            chunks.append(chunk)
+            size += len(chunk)
+        index[cid] = offsets[name]
+    pool = b"".join(chunks)
+    if len(pool) > MAX_POOL:
+        sys.exit(f"✗ Name pool is {len(pool)} bytes, over the {MAX_POOL}-byte limit of 16-bit offsets")
+
+    lines = [
+        "// Generated by tools/build_bt_db.py - do not edit.",
+        "// Bluetooth SIG company identifiers; see include/bt_company_table.h.",
+        "",
+        '#include "bt_company_table.h"',
+        "",
+        f"const uint16_t BT_COMPANY_ID_LIMIT = {limit};",
+        "",
+        f"const uint16_t BT_COMPANY_INDEX[{limit}] = {{",
+    ]
+    for i in range(0, limit, 12):
+        lines.append("    " + " ".join("%5d," % v for v in index[i:i + 12]))
+    # One pool entry per line; +1 for the literal's own terminating NUL
+    lines += ["};", "", f"const char BT_COMPANY_POOL[{len(pool) + 1}] ="]
+    for e in chunks:
+        lines.append(f'    "{c_string(e)}"')
+    lines[-1] += ";"
+    lines.append("")
+    return "\n".join(lines), limit, len(pool), len(offsets)
+
+
+def main():
+    args = sys.argv[1:]
+    yaml_path = args[0] if len(args) > 0 else "company_identifiers.yaml"
+    bin_path = args[1] if len(args) > 1 else "sd_card/btcompany.bin"
+    cpp_path = args[2] if len(args) > 2 else "src/bt_company_table.cpp"
+
+    companies = read_yaml(yaml_path)
+    if not companies:
+        companies = read_bin(bin_path)
+        if not companies:
+            sys.exit("✗ No company identifiers read — nothing written")
+        print(f"  Using existing {bin_path} as the source")
+    else:
+        image = build_bin(companies)
+        with open(bin_path, "wb") as f:
+            f.write(image)
+        print(f"✓ {bin_path}: {len(companies)} companies, {len(image)} bytes")
+
+    merged = dict(companies)
+    for cid, name in FALLBACK.items():
+        merged.setdefault(cid, name)
+
+    source, limit, pool_size, unique = build_table(merged)
+    with open(cpp_path, "w", encoding="ascii", newline="\n") as f:
+        f.write(source)
+    print(f"✓ {cpp_path}: IDs 0-{limit - 1}, {unique} names, "
+          f"{limit * 2} B index + {pool_size} B pool in flash")
+
+
+if __name__ == "__main__":
+    main()
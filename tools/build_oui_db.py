@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+UK-OUI-SPY IEEE OUI Database Builder
+
+Builds oui.bin, the SD card manufacturer lookup, from the IEEE registries:
+
+    MA-L  oui.csv    24-bit OUIs
+    MA-M  mam.csv    28-bit blocks carved out of an IEEE-owned OUI
+    MA-S  oui36.csv  36-bit blocks
+
+Layout (little-endian; see sdLookupOUI() in src/main.cpp):
+
+    uint32 count
+    count x 35 bytes    3-byte OUI + 32-byte NUL-padded name, sorted by OUI
+    -- extension, skipped by firmware that predates it --
+    "OUIX", uint32 parentCount, uint32 subCount
+    parentCount x 12    uint32 oui, uint32 first, uint16 n28, uint16 n36
+    subCount x 35       uint16 sub-prefix + 33-byte name; per parent its
+                        MA-M blocks then its MA-S blocks, each sorted by sub
+
+MAC addresses inside an MA-M/MA-S block then resolve to the block's owner
+instead of "IEEE Registration Authority". Missing MA-M/MA-S files just give
+an image without the extension.
+
+Usage:
+    python tools/build_oui_db.py [oui.csv] [mam.csv] [oui36.csv] [oui.bin]
+
+CSV files that are not found locally are downloaded from standards-oui.ieee.org.
+Defaults write sd_card/oui.bin.
+"""
+
+import csv
+import io
+import os
+import struct
+import sys
+import urllib.request
+
+SOURCES = [
+    ("oui.csv",   "https://standards-oui.ieee.org/oui/oui.csv",     6),
+    ("mam.csv",   "https://standards-oui.ieee.org/oui28/mam.csv",   7),
+    ("oui36.csv", "https://standards-oui.ieee.org/oui36/oui36.csv", 9),
+]
+
+RECORD_SIZE = 35
+MAL_NAME = RECORD_SIZE - 3 - 1      # name bytes before the forced NUL
+SUB_NAME = RECORD_SIZE - 2 - 1
+EXT_MAGIC = b"OUIX"
+PARENT = struct.Struct("<IIHH")
+
+
+def utf8_truncate(s, n):
+    """Truncate to at most n UTF-8 bytes without splitting a character."""
+    b = (s or "").strip().encode("utf-8")[:n]
+    return b.decode("utf-8", "ignore").encode("utf-8")
+
+
+def read_registry(path, url, digits):
+    """{assignment int: organisation name} for one IEEE CSV."""
+    if os.path.exists(path):
+        with open(path, "rb") as f:
+            raw = f.read()
+    else:
+        print(f"  Downloading {url} ...")
+        try:
+            req = urllib.request.Request(url, headers={"User-Agent": "uk-oui-spy"})
+            with urllib.request.urlopen(req, timeout=60) as r:
+                raw = r.read()
+        except OSError as err:
+            print(f"  ! {path}: {err} — skipped")
+            return {}
+
+    out = {}
+    for row in csv.DictReader(io.StringIO(raw.decode("utf-8", "replace"))):
+        assignment = (row.get("Assignment") or "").strip()
+        if len(assignment) != digits:
+            continue
+        try:
+            out[int(assignment, 16)] = row.get("Organization Name") or ""
+        except ValueError:
+            continue
+    return out
+
+
+def build(mal, mam, mas):
+    body = bytearray(struct.pack("<I", len(mal)))
+    for oui in sorted(mal):
+        body += oui.to_bytes(3, "big") + utf8_truncate(mal[oui], MAL_NAME).ljust(RECORD_SIZE - 3, b"\0")
+
+    parents = sorted({k >> 4 for k in mam} | {k >> 12 for k in mas})
+    if not parents:
+        return bytes(body), 0, 0
+
+    table, records = bytearray(), bytearray()
+    for oui in parents:
+        first = len(records) // RECORD_SIZE
+        m28 = sorted(k & 0xF for k in mam if k >> 4 == oui)
+        m36 = sorted(k & 0xFFF for k in mas if k >> 12 == oui)
+        for sub in m28:
+            records += struct.pack("<H", sub) + utf8_truncate(mam[(oui << 4) | sub], SUB_NAME).ljust(RECORD_SIZE - 2, b"\0")
+        for sub in m36:
+            records += struct.pack("<H", sub) + utf8_truncate(mas[(oui << 12) | sub], SUB_NAME).ljust(RECORD_SIZE - 2, b"\0")
+        table += PARENT.pack(oui, first, len(m28), len(m36))
+
+    n_sub = len(records) // RECORD_SIZE
+    body += EXT_MAGIC + struct.pack("<II", len(parents), n_sub) + table + records
+    return bytes(body), len(parents), n_sub
+
+
+def main():
+    args = sys.argv[1:]
+    paths = [args[i] if len(args) > i else name for i, (name, _, _) in enumerate(SOURCES)]
+    out_path = args[3] if len(args) > 3 else "sd_card/oui.bin"
+
+    mal, mam, mas = (read_registry(p, url, digits) for p, (_, url, digits) in zip(paths, SOURCES))
+    if not mal:
+        sys.exit("✗ No MA-L entries read — oui.bin not written")
+
+    image, n_parents, n_sub = build(mal, mam, mas)
+    with open(out_path, "wb") as f:
+        f.write(image)
+    print(f"✓ {out_path}: {len(mal)} OUIs, {len(mam)} MA-M + {len(mas)} MA-S blocks "
+          f"under {n_parents} OUIs, {len(image)} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""
+UK-OUI-SPY Priority Database Compiler
+
+Compiles priority.json into priority.bin, a flat binary image the firmware
+loads in a single read with no JSON parsing (see include/priority_bin.h for
+the layout). Copy both files to the SD card root: the device prefers
+priority.bin and falls back to priority.json when the .bin is missing,
+invalid, or out of date with the .json. Re-run after editing priority.json.
+
+Usage:
+    python tools/build_priority_bin.py [priority.json] [priority.bin]
+
+Defaults to sd_card/priority.json -> sd_card/priority.bin.
+"""
+
+import json
+import struct
+import sys
+
+MAGIC = 0x42495250          # "PRIB"
+VERSION = 2
+MAX_GROUPS = 64             # ID 0 is reserved for "no group"
+MAX_GROUP_MINS = 4
+MAX_STRINGS = 0xFFFF        # offsets are uint16
+MAX_SIZE = 64 * 1024        # PRIORITY_BIN_MAX_SIZE
+
+# Field lengths kept by the firmware's PriorityEntry (char[32], char[48])
+LABEL_LEN = 31
+CONTEXT_LEN = 47
+
+HEADER = struct.Struct("<IHHHHBBBBIII")
+ENTRY = struct.Struct("<IHHBBHBBH")
+RULE = struct.Struct("<QQQHHHHHHf4s4sB7x")
+
+
+class StringTable:
+    def __init__(self):
+        self.data = bytearray(b"\0")      # offset 0 = ""
+        self.index = {"": 0}
+
+    def add(self, s):
+        s = s or ""
+        if s not in self.index:
+            self.index[s] = len(self.data)
+            self.data += s.encode("utf-8") + b"\0"
+            if len(self.data) > MAX_STRINGS:
+                sys.exit("✗ String table exceeds 64 KB")
+        return self.index[s]
+
+
+def utf8_truncate(s, n):
+    """Truncate to at most n UTF-8 bytes without splitting a character."""
+    b = (s or "").encode("utf-8")[:n]
+    return b.decode("utf-8", "ignore")
+
+
+class Groups:
+    def __init__(self):
+        self.names = []
+
+    def intern(self, name):
+        if not name:
+            return 0
+        if name in self.names:
+            return self.names.index(name) + 1
+        if len(self.names) + 1 >= MAX_GROUPS:
+            print(f"  ! Correlation group table full — '{name}' ignored")
+            return 0
+        self.names.append(name)
+        return len(self.names)
+
+
+def prefix_key(oui):
+    """"AA:BB:CC" (MA-L), "AA:BB:CC:D" (MA-M) or "AA:BB:CC:DD:E" (MA-S)
+    -> (bits, key), key being the prefix as an integer."""
+    digits = "".join(c for c in oui if c in "0123456789abcdefABCDEF")
+    if len(digits) not in (6, 7, 9):
+        raise ValueError(f"bad OUI/prefix '{oui}'")
+    return len(digits) * 4, int(digits, 16)
+
+
+def mask(groups, names):
+    m = 0
+    for name in names or []:
+        gid = groups.intern(name)
+        if gid:
+            m |= 1 << gid
+    return m
+
+
+def compile_db(src, source_size):
+    strings = StringTable()
+    groups = Groups()
+
+    entries = {}
+    for e in src.get("entries", []):
+        try:
+            key = prefix_key(e.get("oui", ""))
+        except ValueError as err:
+            print(f"  ! Skipping entry: {err}")
+            continue
+        if key in entries:
+            print(f"  ! Duplicate OUI {e['oui']} — later entry wins")
+        bits, value = key
+        entries[key] = ENTRY.pack(
+            value & 0xFFFFFFFF,
+            strings.add(utf8_truncate(e.get("label"), LABEL_LEN)),
+            strings.add(utf8_truncate(e.get("context"), CONTEXT_LEN)),
+            groups.intern(e.get("correlation_group", "")),
+            max(0, min(255, int(e.get("priority", 0)))),
+            max(0, min(10000, round(float(e.get("confidence", 0.0)) * 10000))),
+            bits, value >> 32, 0,
+        )
+
+    rules = []
+    for r in src.get("correlation_rules", []):
+        any_mask = mask(groups, r.get("required_groups"))
+        all_mask = mask(groups, r.get("all_groups"))
+        exclude_mask = mask(groups, r.get("exclude_groups"))
+        min_group, min_count = bytearray(4), bytearray(4)
+        pairs = 0
+        for name, count in (r.get("group_min") or {}).items():
+            if int(count) < 1:
+                print(f"  ! Rule '{r.get('id', '')}' group_min {name}: count must be >= 1 — ignored")
+                continue
+            gid = groups.intern(name)
+            if gid and pairs < MAX_GROUP_MINS:
+                min_group[pairs] = gid
+                min_count[pairs] = min(255, int(count))
+                pairs += 1
+        # Same test as CorrelationRule::hasCondition(): something must need a sighting
+        if not (all_mask or pairs or (any_mask and int(r.get("min_devices", 0)) > 0)):
+            print(f"  ! Rule '{r.get('id', '')}' has no condition that needs a sighting — skipped")
+            continue
+        rules.append(RULE.pack(
+            any_mask, all_mask, exclude_mask,
+            strings.add(r.get("id", "")),
+            strings.add(r.get("name", "")),
+            strings.add(r.get("description", "")),
+            strings.add(r.get("alert_level", "")),
+            max(0, min(0xFFFF, int(r.get("min_devices", 0)))),
+            max(0, min(0xFFFF, int(r.get("window_sec", 0)))),
+            float(r.get("min_score", 0.0)),
+            bytes(min_group), bytes(min_count), pairs,
+        ))
+
+    group_table = b"".join(struct.pack("<H", strings.add(n)) for n in groups.names)
+    body = (group_table
+            + b"".join(entries[k] for k in sorted(entries))
+            + b"".join(rules)
+            + bytes(strings.data))
+    total = HEADER.size + len(body)
+    if total > MAX_SIZE:
+        sys.exit(f"✗ Image is {total} bytes, firmware limit is {MAX_SIZE}")
+
+    header = HEADER.pack(MAGIC, VERSION, HEADER.size, len(entries), len(rules),
+                         len(groups.names), ENTRY.size, RULE.size, 0,
+                         len(strings.data), total, source_size)
+    return header + body, len(entries), len(rules), len(groups.names)
+
+
+def main():
+    src_path = sys.argv[1] if len(sys.argv) > 1 else "sd_card/priority.json"
+    out_path = sys.argv[2] if len(sys.argv) > 2 else "sd_card/priority.bin"
+    try:
+        with open(src_path, "rb") as f:
+            raw = f.read()
+        src = json.loads(raw.decode("utf-8"))
+    except (OSError, ValueError) as err:
+        sys.exit(f"✗ Cannot read {src_path}: {err}")
+
+    image, n_entries, n_rules, n_groups = compile_db(src, len(raw))
+    with open(out_path, "wb") as f:
+        f.write(image)
+    print(f"✓ {out_path}: {n_entries} entries, {n_rules} rules, "
+          f"{n_groups} groups, {len(image)} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""
+UK-OUI-SPY Scan Profile Benchmark
+
+Runs each scan profile on a live device for a few minutes and prints
+detections per minute against the firmware's estimated current, so the
+profiles can be compared in the place they will actually be used.
+
+For every profile the script selects it (POST /api/config {"scanMode"}),
+lets it settle for one scan cycle, snapshots the per-profile counters from
+GET /api/profiles, waits, and reports the difference. The profile that was
+active beforehand is restored at the end.
+
+Usage:
+    python tools/profile_bench.py [host] [minutes-per-profile] [rounds]
+
+    host      device address (default 192.168.4.1, the hotspot)
+    minutes   time on each profile per round (default 3)
+    rounds    passes over all profiles (default 1); more rounds average out
+              people and vehicles coming and going
+
+The current figures are the firmware's model, not a measurement. While the
+script talks to the device over its hotspot the Wi-Fi receiver is on all the
+time, so the estimates include it; put a USB power meter in line for real
+numbers.
+"""
+
+import json
+import sys
+import time
+import urllib.request
+
+PROFILES = ["quick", "normal", "powersave"]
+
+
+def get_json(host, path):
+    with urllib.request.urlopen(f"http://{host}{path}", timeout=10) as r:
+        return json.load(r)
+
+
+def post_json(host, path, body):
+    req = urllib.request.Request(f"http://{host}{path}", data=json.dumps(body).encode(),
+                                 headers={"Content-Type": "application/json"}, method="POST")
+    with urllib.request.urlopen(req, timeout=10) as r:
+        return json.load(r)
+
+
+def snapshot(host):
+    doc = get_json(host, "/api/profiles")
+    return doc["active"], {p["name"]: p for p in doc["profiles"]}
+
+
+def main():
+    args = sys.argv[1:]
+    host = args[0] if len(args) > 0 else "192.168.4.1"
+    minutes = float(args[1]) if len(args) > 1 else 3.0
+    rounds = int(args[2]) if len(args) > 2 else 1
+
+    original, profiles = snapshot(host)
+    totals = {name: [0.0, 0, 0] for name in PROFILES}     # seconds, new devices, sightings
+    print(f"Benchmarking {len(PROFILES)} profiles on {host}: "
+          f"{minutes:g} min each, {rounds} round(s); active profile is '{original}'")
+
+    try:
+        for rnd in range(rounds):
+            for name in PROFILES:
+                post_json(host, "/api/config", {"scanMode": name})
+                time.sleep(profiles[name]["cycleMs"] / 1000.0)    # first cycle under the new settings
+                _, before = snapshot(host)
+                print(f"  round {rnd + 1}: {name} ...", flush=True)
+                time.sleep(minutes * 60)
+                _, after = snapshot(host)
+                t = totals[name]
+                t[0] += after[name]["activeSec"] - before[name]["activeSec"]
+                t[1] += after[name]["newDevices"] - before[name]["newDevices"]
+                t[2] += after[name]["sightings"] - before[name]["sightings"]
+                profiles = after
+    finally:
+        post_json(host, "/api/config", {"scanMode": original})
+
+    print()
+    print(f"{'profile':<10} {'est mA':>7} {'new/min':>8} {'sight/min':>10} {'sight/min/mA':>13}")
+    for name in PROFILES:
+        secs, new, seen = totals[name]
+        ma = profiles[name]["estMa"]
+        per_min = 60.0 / secs if secs > 0 else 0.0
+        new_rate, seen_rate = new * per_min, seen * per_min
+        eff = seen_rate / ma if ma else 0.0
+        print(f"{name:<10} {ma:>7.0f} {new_rate:>8.1f} {seen_rate:>10.1f} {eff:>13.3f}")
+
+
+if __name__ == "__main__":
+    main()